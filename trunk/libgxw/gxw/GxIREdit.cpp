@@ -344,6 +344,70 @@ static void next_regular_tick(GxIREdit *ir_edit, gdouble calc_tick)
 	ir_edit->fmt = g_strdup(s);
 }
 
+/*
+** min/max pyramid of the display data: level n holds one (min, max)
+** pair per 2^(n+1) samples, each level built from the one below, so
+** the whole pyramid has about the size of the data itself.
+** It lives only as long as the loaded data and is rebuilt on each
+** load in the GUI thread, so loading still costs time proportional
+** to the file length (there is no on-disk peaks cache and no paging
+** of the visible samples: IRWindow needs the complete buffer anyway)
+*/
+static void ir_edit_build_peaks(GxIREdit *ir_edit)
+{
+	g_free(ir_edit->peaks);
+	ir_edit->peaks = NULL;
+	ir_edit->peak_levels = 0;
+	if (!ir_edit->data) {
+		return;
+	}
+	int total = 0;
+	int len = ir_edit->odata_len;
+	int levels = 0;
+	while (len > 1 && levels < GX_IR_EDIT_PEAK_LEVELS) {
+		len = (len + 1) / 2;
+		ir_edit->peak_offset[levels] = total;
+		ir_edit->peak_len[levels] = len;
+		total += 2 * len;
+		levels++;
+	}
+	if (!levels) {
+		return;
+	}
+	float *p = (float*)g_malloc(total*sizeof(float));
+	const float *d = ir_edit->data;
+	for (int i = 0; i < ir_edit->peak_len[0]; i++) {
+		float a = d[2*i];
+		float b = (2*i+1 < ir_edit->odata_len) ? d[2*i+1] : a;
+		p[2*i] = min(a, b);
+		p[2*i+1] = max(a, b);
+	}
+	for (int k = 1; k < levels; k++) {
+		const float *s = p + ir_edit->peak_offset[k-1];
+		int slen = ir_edit->peak_len[k-1];
+		float *t = p + ir_edit->peak_offset[k];
+		for (int i = 0; i < ir_edit->peak_len[k]; i++) {
+			int i2 = min(2*i+1, slen-1);
+			t[2*i] = min(s[4*i], s[2*i2]);
+			t[2*i+1] = max(s[4*i+1], s[2*i2+1]);
+		}
+	}
+	ir_edit->peaks = p;
+	ir_edit->peak_levels = levels;
+}
+
+/* coarsest pyramid level with at least 4 buckets per pixel, -1 if the
+** samples should be used directly
+*/
+static int ir_edit_peak_level(GxIREdit *ir_edit)
+{
+	int level = -1;
+	while (level+1 < ir_edit->peak_levels && (8 << (level+1)) <= ir_edit->scale) {
+		level++;
+	}
+	return level;
+}
+
 static void ir_edit_precalc(GxIREdit *ir_edit)
 {
 	if (!ir_edit->width) {
@@ -358,6 +422,39 @@ static void ir_edit_precalc(GxIREdit *ir_edit)
 	float *l = (float*)g_malloc(sizeof(float)*2*n);
 	int t = 0;
 	int j = 0;
+	int level = ir_edit_peak_level(ir_edit);
+	if (level >= 0) {
+		// fold the pyramid buckets of each pixel instead of the
+		// samples: cost depends on the number of pixels of the
+		// zoomed data (at most 4 buckets each), not on the number
+		// of samples
+		const float *p = ir_edit->peaks + ir_edit->peak_offset[level];
+		int len = ir_edit->peak_len[level];
+		double bsize = 2 << level;
+		for (int i = 0; i < n; i++) {
+			float mn = 1000000.0;
+			float mx = -1000000.0;
+			while (t < len) {
+				if (t*bsize >= (i+0.5)*ir_edit->scale) {
+					break;
+				}
+				float v1 = (p[2*t]-ir_edit->max_y)*ir_edit->scale_height;
+				float v2 = (p[2*t+1]-ir_edit->max_y)*ir_edit->scale_height;
+				mn = min(mn, min(v1, v2));
+				mx = max(mx, max(v1, v2));
+				t += 1;
+			}
+			l[j] = mn;
+			l[j+1] = mx;
+			j += 2;
+		}
+		if (ir_edit->bdata) {
+			g_free(ir_edit->bdata);
+		}
+		ir_edit->bdata = l;
+		ir_edit->bdata_len = n;
+		return;
+	}
 	for (int i = 0; i < n; i++) {
 		float mn = 1000000.0;
 		float mx = -1000000.0;
@@ -565,6 +662,9 @@ static void gx_ir_edit_destroy(GtkWidget* object)
 			ir_edit->cursor[i] = NULL;
 		}
 	}
+	g_free(ir_edit->peaks);
+	ir_edit->peaks = NULL;
+	ir_edit->peak_levels = 0;
 	GTK_WIDGET_CLASS(gx_ir_edit_parent_class)->destroy(object);
 }
 
@@ -1548,6 +1648,7 @@ static void ir_edit_prepare_data(GxIREdit *ir_edit)
 			ir_edit->data[i] = 10*log10(ir_edit->data[i]/mx+1e-20);
 		}
 	}
+	ir_edit_build_peaks(ir_edit);
 }
 
 /****************************************************************
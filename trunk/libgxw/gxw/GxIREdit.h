@@ -31,6 +31,8 @@ G_BEGIN_DECLS
 #define GX_IS_IR_EDIT_CLASS(obj) (G_TYPE_CHECK_CLASS_TYPE ((klass),  GX_TYPE_IR_EDIT))
 #define GX_IR_EDIT_GET_CLASS(obj)  (G_TYPE_INSTANCE_GET_CLASS ((obj), GX_TYPE_IR_EDIT, GxIREditClass))
 
+#define GX_IR_EDIT_PEAK_LEVELS 24
+
 typedef struct _GxIREdit GxIREdit;
 typedef struct _GxIREditClass GxIREditClass;
 
@@ -84,6 +86,11 @@ struct _GxIREdit {
 	float *data; // odata_len samples
 	float *bdata;
 	gint bdata_len;
+	// min/max pairs of data over 2^(n+1) samples for level n
+	float *peaks;
+	gint peak_levels;
+	gint peak_offset[GX_IR_EDIT_PEAK_LEVELS];
+	gint peak_len[GX_IR_EDIT_PEAK_LEVELS];
 	int locked;
 	// output parameters
 	gint cutoff_low;
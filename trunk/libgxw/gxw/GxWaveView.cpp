@@ -217,15 +217,12 @@ static gboolean gx_wave_view_draw (GtkWidget *widget, cairo_t *cr)
 
 	float wave_go = 0;
 	float sc = 280.0/waveview->priv->frame_size;
-	float sc1 = liveviewx+280+sc;
 	float sc2 = liveviewy+40;
-	//----- draw the frame
-	//for (int i = 0; i < waveview->priv->frame_size; i++)
-	for (int i = waveview->priv->frame_size;i>0; i--)
+	//----- draw the frame (oldest sample left)
+	for (int i = 0; i < waveview->priv->frame_size; i++)
 	{
 		float x_in = waveview->priv->frame[i];
-		cairo_line_to (cr, sc1 - sc*(i+1), sc2 - x_in*waveview->priv->m_wave);
-		//cairo_line_to (cr, sc1 - sc*(i+1), sc2 + x_in*waveview->priv->m_wave);
+		cairo_line_to (cr, liveviewx + sc*(i+1), sc2 - x_in*waveview->priv->m_wave);
 		wave_go = fmax(wave_go, fabs(x_in));
 	}
 
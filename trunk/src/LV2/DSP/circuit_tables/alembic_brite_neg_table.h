@@ -6,25 +6,9 @@
  // --table_div  2.624830
  // --table_op  0.250000
 
-struct tablealembic_brite_neg { // 1-dimensional function table
-    float low;
-    float high;
-    float istep;
-    int size;
-    float data[];
-};
-
-template <int tab_size>
-struct tablealembic_brite_neg_imp {
-    float low;
-    float high;
-    float istep;
-    int size;
-    float data[tab_size];
-    operator tablealembic_brite_neg&() const { return *(tablealembic_brite_neg*)this; }
-};
+#include "gx_nltable.h"
 
- static tablealembic_brite_neg_imp<200> alembic_brite_neg_table __rt_data = {
+ static nltable_imp<200> alembic_brite_neg_table __rt_data = {
 	0,0.709061,99.5,200, {
 	0.000000000000,0.016239521366,0.028340428309,0.037476970437,0.044487771980,
 	0.049972504317,0.054360603207,0.057960130568,0.060992531450,0.063617369378,
@@ -70,17 +54,6 @@ struct tablealembic_brite_neg_imp {
 };
 
 double always_inline alembic_brite_negclip(double x) {
-    double f = fabs(x);
-    f = f * alembic_brite_neg_table.istep;
-    int i = static_cast<int>(f);
-    if (i < 0) {
-        f = alembic_brite_neg_table.data[0];
-    } else if (i >= alembic_brite_neg_table.size-1) {
-        f = alembic_brite_neg_table.data[alembic_brite_neg_table.size-1];
-    } else {
-    f -= i;
-    f = alembic_brite_neg_table.data[i]*(1-f) + alembic_brite_neg_table.data[i+1]*f;
-    }
-    return copysign(f, x);
+    return nltable_lookup_odd<1>(alembic_brite_neg_table, x);
 }
 
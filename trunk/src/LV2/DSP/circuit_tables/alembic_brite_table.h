@@ -6,25 +6,9 @@
  // --table_div  2.624830
  // --table_op  0.250000
 
-struct tablealembic_brite { // 1-dimensional function table
-    float low;
-    float high;
-    float istep;
-    int size;
-    float data[];
-};
-
-template <int tab_size>
-struct tablealembic_brite_imp {
-    float low;
-    float high;
-    float istep;
-    int size;
-    float data[tab_size];
-    operator tablealembic_brite&() const { return *(tablealembic_brite*)this; }
-};
+#include "gx_nltable.h"
 
- static tablealembic_brite_imp<200> alembic_brite_table __rt_data = {
+ static nltable_imp<200> alembic_brite_table __rt_data = {
 	0,-0.833309,99.5,200, {
 	0.000000000000,-0.016281378935,-0.028448874763,-0.037669841617,-0.044778139761,
 	-0.050370154903,-0.054873062693,-0.058593376510,-0.061751486560,-0.064506243972,
@@ -70,17 +54,6 @@ struct tablealembic_brite_imp {
 };
 
 double always_inline alembic_briteclip(double x) {
-    double f = fabs(x);
-    f = f * alembic_brite_table.istep;
-    int i = static_cast<int>(f);
-    if (i < 0) {
-        f = alembic_brite_table.data[0];
-    } else if (i >= alembic_brite_table.size-1) {
-        f = alembic_brite_table.data[alembic_brite_table.size-1];
-    } else {
-    f -= i;
-    f = alembic_brite_table.data[i]*(1-f) + alembic_brite_table.data[i+1]*f;
-    }
-    return copysign(f, x);
+    return nltable_lookup_odd<1>(alembic_brite_table, x);
 }
 
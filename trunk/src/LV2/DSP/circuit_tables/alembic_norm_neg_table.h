@@ -6,25 +6,9 @@
  // --table_div  2.578949
  // --table_op  0.250000
 
-struct tablealembic_norm_neg { // 1-dimensional function table
-    float low;
-    float high;
-    float istep;
-    int size;
-    float data[];
-};
-
-template <int tab_size>
-struct tablealembic_norm_neg_imp {
-    float low;
-    float high;
-    float istep;
-    int size;
-    float data[tab_size];
-    operator tablealembic_norm_neg&() const { return *(tablealembic_norm_neg*)this; }
-};
+#include "gx_nltable.h"
 
- static tablealembic_norm_neg_imp<200> alembic_norm_neg_table __rt_data = {
+ static nltable_imp<200> alembic_norm_neg_table __rt_data = {
 	0,0.710293,99.5,200, {
 	0.000000000000,0.009458983398,0.017690162983,0.024879727704,0.031186387875,
 	0.036745427321,0.041672157650,0.046064862957,0.050007310167,0.053570889135,
@@ -70,17 +54,6 @@ struct tablealembic_norm_neg_imp {
 };
 
 double always_inline alembic_norm_negclip(double x) {
-    double f = fabs(x);
-    f = f * alembic_norm_neg_table.istep;
-    int i = static_cast<int>(f);
-    if (i < 0) {
-        f = alembic_norm_neg_table.data[0];
-    } else if (i >= alembic_norm_neg_table.size-1) {
-        f = alembic_norm_neg_table.data[alembic_norm_neg_table.size-1];
-    } else {
-    f -= i;
-    f = alembic_norm_neg_table.data[i]*(1-f) + alembic_norm_neg_table.data[i+1]*f;
-    }
-    return copysign(f, x);
+    return nltable_lookup_odd<1>(alembic_norm_neg_table, x);
 }
 
@@ -6,25 +6,9 @@
  // --table_div  2.578949
  // --table_op  0.250000
 
-struct tablealembic_norm { // 1-dimensional function table
-    float low;
-    float high;
-    float istep;
-    int size;
-    float data[];
-};
-
-template <int tab_size>
-struct tablealembic_norm_imp {
-    float low;
-    float high;
-    float istep;
-    int size;
-    float data[tab_size];
-    operator tablealembic_norm&() const { return *(tablealembic_norm*)this; }
-};
+#include "gx_nltable.h"
 
- static tablealembic_norm_imp<200> alembic_norm_table __rt_data = {
+ static nltable_imp<200> alembic_norm_table __rt_data = {
 	0,-0.83333,99.5,200, {
 	0.000000000000,-0.009470083223,-0.017731640171,-0.024967931771,-0.031335264428,
 	-0.036966948878,-0.041976678005,-0.046461408795,-0.050503821185,-0.054174415857,
@@ -70,17 +54,6 @@ struct tablealembic_norm_imp {
 };
 
 double always_inline alembic_normclip(double x) {
-    double f = fabs(x);
-    f = f * alembic_norm_table.istep;
-    int i = static_cast<int>(f);
-    if (i < 0) {
-        f = alembic_norm_table.data[0];
-    } else if (i >= alembic_norm_table.size-1) {
-        f = alembic_norm_table.data[alembic_norm_table.size-1];
-    } else {
-    f -= i;
-    f = alembic_norm_table.data[i]*(1-f) + alembic_norm_table.data[i+1]*f;
-    }
-    return copysign(f, x);
+    return nltable_lookup_odd<1>(alembic_norm_table, x);
 }
 
@@ -6,25 +6,9 @@
  // --table_div  92.013825
  // --table_op  0.250000
 
-struct tablealembic_out_neg { // 1-dimensional function table
-    float low;
-    float high;
-    float istep;
-    int size;
-    float data[];
-};
-
-template <int tab_size>
-struct tablealembic_out_neg_imp {
-    float low;
-    float high;
-    float istep;
-    int size;
-    float data[tab_size];
-    operator tablealembic_out_neg&() const { return *(tablealembic_out_neg*)this; }
-};
+#include "gx_nltable.h"
 
- static tablealembic_out_neg_imp<200> alembic_out_neg_table __rt_data = {
+ static nltable_imp<200> alembic_out_neg_table __rt_data = {
 	0,0.388692,16.5833,200, {
 	0.000000000000,0.004791170118,0.009562118140,0.014312633699,0.019042505689,
 	0.023751522214,0.028439470554,0.033106137116,0.037751307401,0.042374765953,
@@ -70,17 +54,6 @@ struct tablealembic_out_neg_imp {
 };
 
 double always_inline alembic_out_negclip(double x) {
-    double f = fabs(x);
-    f = f * alembic_out_neg_table.istep;
-    int i = static_cast<int>(f);
-    if (i < 0) {
-        f = alembic_out_neg_table.data[0];
-    } else if (i >= alembic_out_neg_table.size-1) {
-        f = alembic_out_neg_table.data[alembic_out_neg_table.size-1];
-    } else {
-    f -= i;
-    f = alembic_out_neg_table.data[i]*(1-f) + alembic_out_neg_table.data[i+1]*f;
-    }
-    return copysign(f, x);
+    return nltable_lookup_odd<1>(alembic_out_neg_table, x);
 }
 
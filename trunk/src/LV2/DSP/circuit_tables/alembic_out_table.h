@@ -6,25 +6,9 @@
  // --table_div  92.013825
  // --table_op  0.250000
 
-struct tablealembic_out { // 1-dimensional function table
-    float low;
-    float high;
-    float istep;
-    int size;
-    float data[];
-};
-
-template <int tab_size>
-struct tablealembic_out_imp {
-    float low;
-    float high;
-    float istep;
-    int size;
-    float data[tab_size];
-    operator tablealembic_out&() const { return *(tablealembic_out*)this; }
-};
+#include "gx_nltable.h"
 
- static tablealembic_out_imp<200> alembic_out_table __rt_data = {
+ static nltable_imp<200> alembic_out_table __rt_data = {
 	0,-0.833333,16.5833,200, {
 	0.000000000000,-0.004810042467,-0.009637593449,-0.014482420501,-0.019344292150,
 	-0.024222977849,-0.029118247932,-0.034029873577,-0.038957626757,-0.043901280204,
@@ -70,17 +54,6 @@ struct tablealembic_out_imp {
 };
 
 double always_inline alembic_outclip(double x) {
-    double f = fabs(x);
-    f = f * alembic_out_table.istep;
-    int i = static_cast<int>(f);
-    if (i < 0) {
-        f = alembic_out_table.data[0];
-    } else if (i >= alembic_out_table.size-1) {
-        f = alembic_out_table.data[alembic_out_table.size-1];
-    } else {
-    f -= i;
-    f = alembic_out_table.data[i]*(1-f) + alembic_out_table.data[i+1]*f;
-    }
-    return copysign(f, x);
+    return nltable_lookup_odd<1>(alembic_out_table, x);
 }
 
@@ -8,25 +8,9 @@
  // --table_div  9.127496
  // --table_op  0.002000
 
-struct tablebigchumppower_neg { // 1-dimensional function table
-    float low;
-    float high;
-    float istep;
-    int size;
-    float data[];
-};
-
-template <int tab_size>
-struct tablebigchumppower_neg_imp {
-    float low;
-    float high;
-    float istep;
-    int size;
-    float data[tab_size];
-    operator tablebigchumppower_neg&() const { return *(tablebigchumppower_neg*)this; }
-};
+#include "gx_nltable.h"
 
- static tablebigchumppower_neg_imp<2048> bigchumppower_neg_table __rt_data = {
+ static nltable_imp<2048> bigchumppower_neg_table __rt_data = {
 	0,0.163303,0.8188,2048, {
 	0.000000000000,-0.026879808459,-0.053348238319,-0.079398030312,-0.105023297469,
 	-0.130219460064,-0.154983175678,-0.179312265571,-0.203205638689,-0.226663214495,
@@ -442,18 +426,7 @@ struct tablebigchumppower_neg_imp {
 };
 
 double always_inline bigchumppower_negclip(double x) {
-    double f = fabs(x);
-    f = f * bigchumppower_neg_table.istep;
-    int i = static_cast<int>(f);
-    if (i < 0) {
-        f = bigchumppower_neg_table.data[0];
-    } else if (i >= bigchumppower_neg_table.size-1) {
-        f = bigchumppower_neg_table.data[bigchumppower_neg_table.size-1];
-    } else {
-    f -= i;
-    f = bigchumppower_neg_table.data[i]*(1-f) + bigchumppower_neg_table.data[i+1]*f;
-    }
-    return copysign(f, x);
+    return nltable_lookup_odd<1>(bigchumppower_neg_table, x);
 }
 
 #endif //_BIGCHUMPPOWER_NEG_H_
@@ -7,25 +7,9 @@
  // --table_div  9.127496
  // --table_op  0.002000
 
-struct tablebigchumppower { // 1-dimensional function table
-    float low;
-    float high;
-    float istep;
-    int size;
-    float data[];
-};
-
-template <int tab_size>
-struct tablebigchumppower_imp {
-    float low;
-    float high;
-    float istep;
-    int size;
-    float data[tab_size];
-    operator tablebigchumppower&() const { return *(tablebigchumppower*)this; }
-};
+#include "gx_nltable.h"
 
- static tablebigchumppower_imp<2048> bigchumppower_table __rt_data = {
+ static nltable_imp<2048> bigchumppower_table __rt_data = {
 	0,0.833333,0.8188,2048, {
 	0.000000000000,0.026881587742,0.053355325982,0.079413890819,0.105051321689,
 	0.130262957880,0.155045369615,0.179396285807,0.203314519063,0.226799889648,
@@ -441,18 +425,7 @@ struct tablebigchumppower_imp {
 };
 
 double always_inline bigchumppowerclip(double x) {
-    double f = fabs(x);
-    f = f * bigchumppower_table.istep;
-    int i = static_cast<int>(f);
-    if (i < 0) {
-        f = bigchumppower_table.data[0];
-    } else if (i >= bigchumppower_table.size-1) {
-        f = bigchumppower_table.data[bigchumppower_table.size-1];
-    } else {
-    f -= i;
-    f = bigchumppower_table.data[i]*(1-f) + bigchumppower_table.data[i+1]*f;
-    }
-    return copysign(f, x);
+    return nltable_lookup_odd<1>(bigchumppower_table, x);
 }
 
 #endif //_BIGCHUMPPOWER_H_
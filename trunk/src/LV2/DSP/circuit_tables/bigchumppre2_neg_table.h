@@ -8,25 +8,9 @@
  // --table_div  103.329115
  // --table_op  0.100000
 
-struct tablebigchumppre2_neg { // 1-dimensional function table
-    float low;
-    float high;
-    float istep;
-    int size;
-    float data[];
-};
-
-template <int tab_size>
-struct tablebigchumppre2_neg_imp {
-    float low;
-    float high;
-    float istep;
-    int size;
-    float data[tab_size];
-    operator tablebigchumppre2_neg&() const { return *(tablebigchumppre2_neg*)this; }
-};
+#include "gx_nltable.h"
 
- static tablebigchumppre2_neg_imp<2048> bigchumppre2_neg_table __rt_data = {
+ static nltable_imp<2048> bigchumppre2_neg_table __rt_data = {
 	0,0.357489,40.94,2048, {
 	0.000000000000,0.001388545238,0.002775222683,0.004160032833,0.005542976182,
 	0.006924053227,0.008303264465,0.009680610392,0.011056091506,0.012429708302,
@@ -442,18 +426,7 @@ struct tablebigchumppre2_neg_imp {
 };
 
 double always_inline bigchumppre2_negclip(double x) {
-    double f = fabs(x);
-    f = f * bigchumppre2_neg_table.istep;
-    int i = static_cast<int>(f);
-    if (i < 0) {
-        f = bigchumppre2_neg_table.data[0];
-    } else if (i >= bigchumppre2_neg_table.size-1) {
-        f = bigchumppre2_neg_table.data[bigchumppre2_neg_table.size-1];
-    } else {
-    f -= i;
-    f = bigchumppre2_neg_table.data[i]*(1-f) + bigchumppre2_neg_table.data[i+1]*f;
-    }
-    return copysign(f, x);
+    return nltable_lookup_odd<1>(bigchumppre2_neg_table, x);
 }
 
 #endif //_BIGCHUMPPRE2_NEG_H_
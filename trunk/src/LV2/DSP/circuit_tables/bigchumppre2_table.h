@@ -8,25 +8,9 @@
  // --table_div  103.329115
  // --table_op  0.100000
 
-struct tablebigchumppre2 { // 1-dimensional function table
-    float low;
-    float high;
-    float istep;
-    int size;
-    float data[];
-};
-
-template <int tab_size>
-struct tablebigchumppre2_imp {
-    float low;
-    float high;
-    float istep;
-    int size;
-    float data[tab_size];
-    operator tablebigchumppre2&() const { return *(tablebigchumppre2*)this; }
-};
+#include "gx_nltable.h"
 
- static tablebigchumppre2_imp<2048> bigchumppre2_table __rt_data = {
+ static nltable_imp<2048> bigchumppre2_table __rt_data = {
 	0,-0.833333,40.94,2048, {
 	0.000000000000,-0.001389398516,-0.002778634193,-0.004167704815,-0.005556608173,
 	-0.006945342060,-0.008333904279,-0.009722292634,-0.011110504938,-0.012498539008,
@@ -442,18 +426,7 @@ struct tablebigchumppre2_imp {
 };
 
 double always_inline bigchumppre2clip(double x) {
-    double f = fabs(x);
-    f = f * bigchumppre2_table.istep;
-    int i = static_cast<int>(f);
-    if (i < 0) {
-        f = bigchumppre2_table.data[0];
-    } else if (i >= bigchumppre2_table.size-1) {
-        f = bigchumppre2_table.data[bigchumppre2_table.size-1];
-    } else {
-    f -= i;
-    f = bigchumppre2_table.data[i]*(1-f) + bigchumppre2_table.data[i+1]*f;
-    }
-    return copysign(f, x);
+    return nltable_lookup_odd<1>(bigchumppre2_table, x);
 }
 
 #endif //_BIGCHUMPPRE2_H_
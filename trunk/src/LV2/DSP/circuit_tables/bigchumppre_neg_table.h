@@ -8,25 +8,9 @@
  // --table_div  26.013498
  // --table_op  0.500000
 
-struct tablebigchumppre_neg { // 1-dimensional function table
-    float low;
-    float high;
-    float istep;
-    int size;
-    float data[];
-};
-
-template <int tab_size>
-struct tablebigchumppre_neg_imp {
-    float low;
-    float high;
-    float istep;
-    int size;
-    float data[tab_size];
-    operator tablebigchumppre_neg&() const { return *(tablebigchumppre_neg*)this; }
-};
+#include "gx_nltable.h"
 
- static tablebigchumppre_neg_imp<2048> bigchumppre_neg_table __rt_data = {
+ static nltable_imp<2048> bigchumppre_neg_table __rt_data = {
 	0,0.622726,682.333,2048, {
 	0.000000000000,0.000225868279,0.000456501002,0.000691816022,0.000931733592,
 	0.001176176268,0.001425068823,0.001678338159,0.001935913228,0.002197724949,
@@ -442,18 +426,7 @@ struct tablebigchumppre_neg_imp {
 };
 
 double always_inline bigchumppre_negclip(double x) {
-    double f = fabs(x);
-    f = f * bigchumppre_neg_table.istep;
-    int i = static_cast<int>(f);
-    if (i < 0) {
-        f = bigchumppre_neg_table.data[0];
-    } else if (i >= bigchumppre_neg_table.size-1) {
-        f = bigchumppre_neg_table.data[bigchumppre_neg_table.size-1];
-    } else {
-    f -= i;
-    f = bigchumppre_neg_table.data[i]*(1-f) + bigchumppre_neg_table.data[i+1]*f;
-    }
-    return copysign(f, x);
+    return nltable_lookup_odd<1>(bigchumppre_neg_table, x);
 }
 
 #endif //_BIGCHUMPPRE_NEG_H_
@@ -8,25 +8,9 @@
  // --table_div  26.013498
  // --table_op  0.500000
 
-struct tablebigchumppre { // 1-dimensional function table
-    float low;
-    float high;
-    float istep;
-    int size;
-    float data[];
-};
-
-template <int tab_size>
-struct tablebigchumppre_imp {
-    float low;
-    float high;
-    float istep;
-    int size;
-    float data[tab_size];
-    operator tablebigchumppre&() const { return *(tablebigchumppre*)this; }
-};
+#include "gx_nltable.h"
 
- static tablebigchumppre_imp<2048> bigchumppre_table __rt_data = {
+ static nltable_imp<2048> bigchumppre_table __rt_data = {
 	0,-0.833333,682.333,2048, {
 	0.000000000000,-0.000225910485,-0.000456670557,-0.000692199602,-0.000932419379,
 	-0.001177253928,-0.001426629478,-0.001680474365,-0.001938718950,-0.002201295540,
@@ -442,18 +426,7 @@ struct tablebigchumppre_imp {
 };
 
 double always_inline bigchumppreclip(double x) {
-    double f = fabs(x);
-    f = f * bigchumppre_table.istep;
-    int i = static_cast<int>(f);
-    if (i < 0) {
-        f = bigchumppre_table.data[0];
-    } else if (i >= bigchumppre_table.size-1) {
-        f = bigchumppre_table.data[bigchumppre_table.size-1];
-    } else {
-    f -= i;
-    f = bigchumppre_table.data[i]*(1-f) + bigchumppre_table.data[i+1]*f;
-    }
-    return copysign(f, x);
+    return nltable_lookup_odd<1>(bigchumppre_table, x);
 }
 
 #endif //_BIGCHUMPPRE_H_
@@ -6,25 +6,9 @@
  // --table_div  24.120176
  // --table_op  0.050000
 
-struct tablecopicat1_neg { // 1-dimensional function table
-    float low;
-    float high;
-    float istep;
-    int size;
-    float data[];
-};
-
-template <int tab_size>
-struct tablecopicat1_neg_imp {
-    float low;
-    float high;
-    float istep;
-    int size;
-    float data[tab_size];
-    operator tablecopicat1_neg&() const { return *(tablecopicat1_neg*)this; }
-};
+#include "gx_nltable.h"
 
- static tablecopicat1_neg_imp<2048> copicat1_neg_table __rt_data = {
+ static nltable_imp<2048> copicat1_neg_table __rt_data = {
 	0,0.674414,68.2333,2048, {
 	0.000000000000,0.000724173087,0.001447728523,0.002170666820,0.002892988495,
 	0.003614694060,0.004335784028,0.005056258914,0.005776119229,0.006495365485,
@@ -440,17 +424,6 @@ struct tablecopicat1_neg_imp {
 };
 
 double always_inline copicat1_negclip(double x) {
-    double f = fabs(x);
-    f = f * copicat1_neg_table.istep;
-    int i = static_cast<int>(f);
-    if (i < 0) {
-        f = copicat1_neg_table.data[0];
-    } else if (i >= copicat1_neg_table.size-1) {
-        f = copicat1_neg_table.data[copicat1_neg_table.size-1];
-    } else {
-    f -= i;
-    f = copicat1_neg_table.data[i]*(1-f) + copicat1_neg_table.data[i+1]*f;
-    }
-    return copysign(f, x);
+    return nltable_lookup_odd<1>(copicat1_neg_table, x);
 }
 
@@ -6,25 +6,9 @@
  // --table_div  24.120176
  // --table_op  0.050000
 
-struct tablecopicat1 { // 1-dimensional function table
-    float low;
-    float high;
-    float istep;
-    int size;
-    float data[];
-};
-
-template <int tab_size>
-struct tablecopicat1_imp {
-    float low;
-    float high;
-    float istep;
-    int size;
-    float data[tab_size];
-    operator tablecopicat1&() const { return *(tablecopicat1*)this; }
-};
+#include "gx_nltable.h"
 
- static tablecopicat1_imp<2048> copicat1_table __rt_data = {
+ static nltable_imp<2048> copicat1_table __rt_data = {
 	0,-0.833333,68.2333,2048, {
 	0.000000000000,-0.000724265940,-0.001448099739,-0.002171501586,-0.002894471673,
 	-0.003617010189,-0.004339117326,-0.005060793273,-0.005782038223,-0.006502852365,
@@ -440,17 +424,6 @@ struct tablecopicat1_imp {
 };
 
 double always_inline copicat1clip(double x) {
-    double f = fabs(x);
-    f = f * copicat1_table.istep;
-    int i = static_cast<int>(f);
-    if (i < 0) {
-        f = copicat1_table.data[0];
-    } else if (i >= copicat1_table.size-1) {
-        f = copicat1_table.data[copicat1_table.size-1];
-    } else {
-    f -= i;
-    f = copicat1_table.data[i]*(1-f) + copicat1_table.data[i+1]*f;
-    }
-    return copysign(f, x);
+    return nltable_lookup_odd<1>(copicat1_table, x);
 }
 
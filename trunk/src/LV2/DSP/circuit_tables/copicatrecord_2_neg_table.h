@@ -6,25 +6,9 @@
  // --table_div  90.560287
  // --table_op  0.025000
 
-struct tablecopicatrecord_2_neg { // 1-dimensional function table
-    float low;
-    float high;
-    float istep;
-    int size;
-    float data[];
-};
-
-template <int tab_size>
-struct tablecopicatrecord_2_neg_imp {
-    float low;
-    float high;
-    float istep;
-    int size;
-    float data[tab_size];
-    operator tablecopicatrecord_2_neg&() const { return *(tablecopicatrecord_2_neg*)this; }
-};
+#include "gx_nltable.h"
 
- static tablecopicatrecord_2_neg_imp<2048> copicatrecord_2_neg_table __rt_data = {
+ static nltable_imp<2048> copicatrecord_2_neg_table __rt_data = {
 	0,0.454165,34.1167,2048, {
 	0.000000000000,0.000130504252,0.000488004380,0.001006033473,0.001637333092,
 	0.002348303370,0.003115056386,0.003920609813,0.004752891478,0.005603320535,
@@ -440,17 +424,6 @@ struct tablecopicatrecord_2_neg_imp {
 };
 
 double always_inline copicatrecord_2_negclip(double x) {
-    double f = fabs(x);
-    f = f * copicatrecord_2_neg_table.istep;
-    int i = static_cast<int>(f);
-    if (i < 0) {
-        f = copicatrecord_2_neg_table.data[0];
-    } else if (i >= copicatrecord_2_neg_table.size-1) {
-        f = copicatrecord_2_neg_table.data[copicatrecord_2_neg_table.size-1];
-    } else {
-    f -= i;
-    f = copicatrecord_2_neg_table.data[i]*(1-f) + copicatrecord_2_neg_table.data[i+1]*f;
-    }
-    return copysign(f, x);
+    return nltable_lookup_odd<1>(copicatrecord_2_neg_table, x);
 }
 
@@ -6,25 +6,9 @@
  // --table_div  90.560287
  // --table_op  0.025000
 
-struct tablecopicatrecord_2 { // 1-dimensional function table
-    float low;
-    float high;
-    float istep;
-    int size;
-    float data[];
-};
-
-template <int tab_size>
-struct tablecopicatrecord_2_imp {
-    float low;
-    float high;
-    float istep;
-    int size;
-    float data[tab_size];
-    operator tablecopicatrecord_2&() const { return *(tablecopicatrecord_2*)this; }
-};
+#include "gx_nltable.h"
 
- static tablecopicatrecord_2_imp<2048> copicatrecord_2_table __rt_data = {
+ static nltable_imp<2048> copicatrecord_2_table __rt_data = {
 	0,-0.498741,34.1167,2048, {
 	0.000000000000,-0.000134668088,-0.000495240002,-0.001015667437,-0.001648979644,
 	-0.002361773567,-0.003130295546,-0.003937654695,-0.004771841032,-0.005624315928,
@@ -440,17 +424,6 @@ struct tablecopicatrecord_2_imp {
 };
 
 double always_inline copicatrecord_2clip(double x) {
-    double f = fabs(x);
-    f = f * copicatrecord_2_table.istep;
-    int i = static_cast<int>(f);
-    if (i < 0) {
-        f = copicatrecord_2_table.data[0];
-    } else if (i >= copicatrecord_2_table.size-1) {
-        f = copicatrecord_2_table.data[copicatrecord_2_table.size-1];
-    } else {
-    f -= i;
-    f = copicatrecord_2_table.data[i]*(1-f) + copicatrecord_2_table.data[i+1]*f;
-    }
-    return copysign(f, x);
+    return nltable_lookup_odd<1>(copicatrecord_2_table, x);
 }
 
@@ -6,25 +6,9 @@
  // --table_div  44.133383
  // --table_op  0.040000
 
-struct tablecopicatreplay1_neg { // 1-dimensional function table
-    float low;
-    float high;
-    float istep;
-    int size;
-    float data[];
-};
-
-template <int tab_size>
-struct tablecopicatreplay1_neg_imp {
-    float low;
-    float high;
-    float istep;
-    int size;
-    float data[tab_size];
-    operator tablecopicatreplay1_neg&() const { return *(tablecopicatreplay1_neg*)this; }
-};
+#include "gx_nltable.h"
 
- static tablecopicatreplay1_neg_imp<2048> copicatreplay1_neg_table __rt_data = {
+ static nltable_imp<2048> copicatreplay1_neg_table __rt_data = {
 	0,0.601351,81.88,2048, {
 	0.000000000000,0.000552182129,0.001104014429,0.001655497089,0.002206630296,
 	0.002757414239,0.003307849105,0.003857935082,0.004407672358,0.004957061121,
@@ -440,17 +424,6 @@ struct tablecopicatreplay1_neg_imp {
 };
 
 double always_inline copicatreplay1_negclip(double x) {
-    double f = fabs(x);
-    f = f * copicatreplay1_neg_table.istep;
-    int i = static_cast<int>(f);
-    if (i < 0) {
-        f = copicatreplay1_neg_table.data[0];
-    } else if (i >= copicatreplay1_neg_table.size-1) {
-        f = copicatreplay1_neg_table.data[copicatreplay1_neg_table.size-1];
-    } else {
-    f -= i;
-    f = copicatreplay1_neg_table.data[i]*(1-f) + copicatreplay1_neg_table.data[i+1]*f;
-    }
-    return copysign(f, x);
+    return nltable_lookup_odd<1>(copicatreplay1_neg_table, x);
 }
 
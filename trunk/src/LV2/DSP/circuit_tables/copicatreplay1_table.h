@@ -6,25 +6,9 @@
  // --table_div  44.133383
  // --table_op  0.040000
 
-struct tablecopicatreplay1 { // 1-dimensional function table
-    float low;
-    float high;
-    float istep;
-    int size;
-    float data[];
-};
-
-template <int tab_size>
-struct tablecopicatreplay1_imp {
-    float low;
-    float high;
-    float istep;
-    int size;
-    float data[tab_size];
-    operator tablecopicatreplay1&() const { return *(tablecopicatreplay1*)this; }
-};
+#include "gx_nltable.h"
 
- static tablecopicatreplay1_imp<2048> copicatreplay1_table __rt_data = {
+ static nltable_imp<2048> copicatreplay1_table __rt_data = {
 	0,-0.833333,81.88,2048, {
 	0.000000000000,-0.000552293731,-0.001104460682,-0.001656500787,-0.002208413977,
 	-0.002760200186,-0.003311859348,-0.003863391395,-0.004414796261,-0.004966073879,
@@ -440,17 +424,6 @@ struct tablecopicatreplay1_imp {
 };
 
 double always_inline copicatreplay1clip(double x) {
-    double f = fabs(x);
-    f = f * copicatreplay1_table.istep;
-    int i = static_cast<int>(f);
-    if (i < 0) {
-        f = copicatreplay1_table.data[0];
-    } else if (i >= copicatreplay1_table.size-1) {
-        f = copicatreplay1_table.data[copicatreplay1_table.size-1];
-    } else {
-    f -= i;
-    f = copicatreplay1_table.data[i]*(1-f) + copicatreplay1_table.data[i+1]*f;
-    }
-    return copysign(f, x);
+    return nltable_lookup_odd<1>(copicatreplay1_table, x);
 }
 
@@ -6,25 +6,9 @@
  // --table_div  9.124721
  // --table_op  2.000000
 
-struct tablecopicatreplay2_neg { // 1-dimensional function table
-    float low;
-    float high;
-    float istep;
-    int size;
-    float data[];
-};
-
-template <int tab_size>
-struct tablecopicatreplay2_neg_imp {
-    float low;
-    float high;
-    float istep;
-    int size;
-    float data[tab_size];
-    operator tablecopicatreplay2_neg&() const { return *(tablecopicatreplay2_neg*)this; }
-};
+#include "gx_nltable.h"
 
- static tablecopicatreplay2_neg_imp<2048> copicatreplay2_neg_table __rt_data = {
+ static nltable_imp<2048> copicatreplay2_neg_table __rt_data = {
 	0,0.714937,682.333,2048, {
 	0.000000000000,0.000757713156,0.001514764563,0.002271154801,0.003026884455,
 	0.003781954107,0.004536364340,0.005290115736,0.006043208876,0.006795644343,
@@ -440,17 +424,6 @@ struct tablecopicatreplay2_neg_imp {
 };
 
 double always_inline copicatreplay2_negclip(double x) {
-    double f = fabs(x);
-    f = f * copicatreplay2_neg_table.istep;
-    int i = static_cast<int>(f);
-    if (i < 0) {
-        f = copicatreplay2_neg_table.data[0];
-    } else if (i >= copicatreplay2_neg_table.size-1) {
-        f = copicatreplay2_neg_table.data[copicatreplay2_neg_table.size-1];
-    } else {
-    f -= i;
-    f = copicatreplay2_neg_table.data[i]*(1-f) + copicatreplay2_neg_table.data[i+1]*f;
-    }
-    return copysign(f, x);
+    return nltable_lookup_odd<1>(copicatreplay2_neg_table, x);
 }
 
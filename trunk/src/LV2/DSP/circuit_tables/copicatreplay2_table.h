@@ -6,25 +6,9 @@
  // --table_div  9.124721
  // --table_op  2.000000
 
-struct tablecopicatreplay2 { // 1-dimensional function table
-    float low;
-    float high;
-    float istep;
-    int size;
-    float data[];
-};
-
-template <int tab_size>
-struct tablecopicatreplay2_imp {
-    float low;
-    float high;
-    float istep;
-    int size;
-    float data[tab_size];
-    operator tablecopicatreplay2&() const { return *(tablecopicatreplay2*)this; }
-};
+#include "gx_nltable.h"
 
- static tablecopicatreplay2_imp<2048> copicatreplay2_table __rt_data = {
+ static nltable_imp<2048> copicatreplay2_table __rt_data = {
 	0,-0.833333,682.333,2048, {
 	0.000000000000,-0.000757812579,-0.001515162001,-0.002272048429,-0.003028472031,
 	-0.003784432974,-0.004539931424,-0.005294967551,-0.006049541521,-0.006803653502,
@@ -440,17 +424,6 @@ struct tablecopicatreplay2_imp {
 };
 
 double always_inline copicatreplay2clip(double x) {
-    double f = fabs(x);
-    f = f * copicatreplay2_table.istep;
-    int i = static_cast<int>(f);
-    if (i < 0) {
-        f = copicatreplay2_table.data[0];
-    } else if (i >= copicatreplay2_table.size-1) {
-        f = copicatreplay2_table.data[copicatreplay2_table.size-1];
-    } else {
-    f -= i;
-    f = copicatreplay2_table.data[i]*(1-f) + copicatreplay2_table.data[i+1]*f;
-    }
-    return copysign(f, x);
+    return nltable_lookup_odd<1>(copicatreplay2_table, x);
 }
 
@@ -6,25 +6,9 @@
  // --table_div  7.844688
  // --table_op  0.250000
 
-struct tableinput12au7_neg { // 1-dimensional function table
-    float low;
-    float high;
-    float istep;
-    int size;
-    float data[];
-};
-
-template <int tab_size>
-struct tableinput12au7_neg_imp {
-    float low;
-    float high;
-    float istep;
-    int size;
-    float data[tab_size];
-    operator tableinput12au7_neg&() const { return *(tableinput12au7_neg*)this; }
-};
+#include "gx_nltable.h"
 
- static tableinput12au7_neg_imp<2048> input12au7_neg_table __rt_data = {
+ static nltable_imp<2048> input12au7_neg_table __rt_data = {
 	0,0.801348,341.167,2048, {
 	0.000000000000,0.000617075314,0.001233855485,0.001850340646,0.002466530934,
 	0.003082426484,0.003698027434,0.004313333919,0.004928346075,0.005543064038,
@@ -440,17 +424,6 @@ struct tableinput12au7_neg_imp {
 };
 
 double always_inline input12au7_negclip(double x) {
-    double f = fabs(x);
-    f = f * input12au7_neg_table.istep;
-    int i = static_cast<int>(f);
-    if (i < 0) {
-        f = input12au7_neg_table.data[0];
-    } else if (i >= input12au7_neg_table.size-1) {
-        f = input12au7_neg_table.data[input12au7_neg_table.size-1];
-    } else {
-    f -= i;
-    f = input12au7_neg_table.data[i]*(1-f) + input12au7_neg_table.data[i+1]*f;
-    }
-    return copysign(f, x);
+    return nltable_lookup_odd<1>(input12au7_neg_table, x);
 }
 
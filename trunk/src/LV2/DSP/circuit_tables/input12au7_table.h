@@ -6,25 +6,9 @@
  // --table_div  7.844688
  // --table_op  0.250000
 
-struct tableinput12au7 { // 1-dimensional function table
-    float low;
-    float high;
-    float istep;
-    int size;
-    float data[];
-};
-
-template <int tab_size>
-struct tableinput12au7_imp {
-    float low;
-    float high;
-    float istep;
-    int size;
-    float data[tab_size];
-    operator tableinput12au7&() const { return *(tableinput12au7*)this; }
-};
+#include "gx_nltable.h"
 
- static tableinput12au7_imp<2048> input12au7_table __rt_data = {
+ static nltable_imp<2048> input12au7_table __rt_data = {
 	0,-0.833333,341.167,2048, {
 	0.000000000000,-0.000617085606,-0.001233896646,-0.001850433245,-0.002466695530,
 	-0.003082683628,-0.003698397665,-0.004313837768,-0.004929004064,-0.005543896679,
@@ -440,17 +424,6 @@ struct tableinput12au7_imp {
 };
 
 double always_inline input12au7clip(double x) {
-    double f = fabs(x);
-    f = f * input12au7_table.istep;
-    int i = static_cast<int>(f);
-    if (i < 0) {
-        f = input12au7_table.data[0];
-    } else if (i >= input12au7_table.size-1) {
-        f = input12au7_table.data[input12au7_table.size-1];
-    } else {
-    f -= i;
-    f = input12au7_table.data[i]*(1-f) + input12au7_table.data[i+1]*f;
-    }
-    return copysign(f, x);
+    return nltable_lookup_odd<1>(input12au7_table, x);
 }
 
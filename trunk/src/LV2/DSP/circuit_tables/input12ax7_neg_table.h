@@ -6,25 +6,9 @@
  // --table_div  20.270230
  // --table_op  0.250000
 
-struct tableinput12ax7_neg { // 1-dimensional function table
-    float low;
-    float high;
-    float istep;
-    int size;
-    float data[];
-};
-
-template <int tab_size>
-struct tableinput12ax7_neg_imp {
-    float low;
-    float high;
-    float istep;
-    int size;
-    float data[tab_size];
-    operator tableinput12ax7_neg&() const { return *(tableinput12ax7_neg*)this; }
-};
+#include "gx_nltable.h"
 
- static tableinput12ax7_neg_imp<2048> input12ax7_neg_table __rt_data = {
+ static nltable_imp<2048> input12ax7_neg_table __rt_data = {
 	0,0.783755,341.167,2048, {
 	0.000000000000,0.000605224955,0.001210164651,0.001814819210,0.002419188754,
 	0.003023273409,0.003627073297,0.004230588542,0.004833819266,0.005436765595,
@@ -440,17 +424,6 @@ struct tableinput12ax7_neg_imp {
 };
 
 double always_inline input12ax7_negclip(double x) {
-    double f = fabs(x);
-    f = f * input12ax7_neg_table.istep;
-    int i = static_cast<int>(f);
-    if (i < 0) {
-        f = input12ax7_neg_table.data[0];
-    } else if (i >= input12ax7_neg_table.size-1) {
-        f = input12ax7_neg_table.data[input12ax7_neg_table.size-1];
-    } else {
-    f -= i;
-    f = input12ax7_neg_table.data[i]*(1-f) + input12ax7_neg_table.data[i+1]*f;
-    }
-    return copysign(f, x);
+    return nltable_lookup_odd<1>(input12ax7_neg_table, x);
 }
 
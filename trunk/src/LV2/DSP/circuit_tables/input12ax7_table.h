@@ -6,25 +6,9 @@
  // --table_div  20.270230
  // --table_op  0.250000
 
-struct tableinput12ax7 { // 1-dimensional function table
-    float low;
-    float high;
-    float istep;
-    int size;
-    float data[];
-};
-
-template <int tab_size>
-struct tableinput12ax7_imp {
-    float low;
-    float high;
-    float istep;
-    int size;
-    float data[tab_size];
-    operator tableinput12ax7&() const { return *(tableinput12ax7*)this; }
-};
+#include "gx_nltable.h"
 
- static tableinput12ax7_imp<2048> input12ax7_table __rt_data = {
+ static nltable_imp<2048> input12ax7_table __rt_data = {
 	0,-0.833333,341.167,2048, {
 	0.000000000000,-0.000605240466,-0.001210226689,-0.001814958776,-0.002419436836,
 	-0.003023660979,-0.003627631314,-0.004231347950,-0.004834810997,-0.005438020565,
@@ -440,17 +424,6 @@ struct tableinput12ax7_imp {
 };
 
 double always_inline input12ax7clip(double x) {
-    double f = fabs(x);
-    f = f * input12ax7_table.istep;
-    int i = static_cast<int>(f);
-    if (i < 0) {
-        f = input12ax7_table.data[0];
-    } else if (i >= input12ax7_table.size-1) {
-        f = input12ax7_table.data[input12ax7_table.size-1];
-    } else {
-    f -= i;
-    f = input12ax7_table.data[i]*(1-f) + input12ax7_table.data[i+1]*f;
-    }
-    return copysign(f, x);
+    return nltable_lookup_odd<1>(input12ax7_table, x);
 }
 
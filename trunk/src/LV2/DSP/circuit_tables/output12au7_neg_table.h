@@ -6,25 +6,9 @@
  // --table_div  15.263200
  // --table_op  1.000000
 
-struct tableoutput12au7_neg { // 1-dimensional function table
-    float low;
-    float high;
-    float istep;
-    int size;
-    float data[];
-};
-
-template <int tab_size>
-struct tableoutput12au7_neg_imp {
-    float low;
-    float high;
-    float istep;
-    int size;
-    float data[tab_size];
-    operator tableoutput12au7_neg&() const { return *(tableoutput12au7_neg*)this; }
-};
+#include "gx_nltable.h"
 
- static tableoutput12au7_neg_imp<2048> output12au7_neg_table __rt_data = {
+ static nltable_imp<2048> output12au7_neg_table __rt_data = {
 	0,0.733182,682.333,2048, {
 	0.000000000000,0.000592541863,0.001184774742,0.001776698757,0.002368314053,
 	0.002959620777,0.003550619072,0.004141309084,0.004731690959,0.005321764841,
@@ -440,17 +424,6 @@ struct tableoutput12au7_neg_imp {
 };
 
 double always_inline output12au7_negclip(double x) {
-    double f = fabs(x);
-    f = f * output12au7_neg_table.istep;
-    int i = static_cast<int>(f);
-    if (i < 0) {
-        f = output12au7_neg_table.data[0];
-    } else if (i >= output12au7_neg_table.size-1) {
-        f = output12au7_neg_table.data[output12au7_neg_table.size-1];
-    } else {
-    f -= i;
-    f = output12au7_neg_table.data[i]*(1-f) + output12au7_neg_table.data[i+1]*f;
-    }
-    return copysign(f, x);
+    return nltable_lookup_odd<1>(output12au7_neg_table, x);
 }
 
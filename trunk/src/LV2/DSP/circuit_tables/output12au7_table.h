@@ -6,25 +6,9 @@
  // --table_div  15.263200
  // --table_op  1.000000
 
-struct tableoutput12au7 { // 1-dimensional function table
-    float low;
-    float high;
-    float istep;
-    int size;
-    float data[];
-};
-
-template <int tab_size>
-struct tableoutput12au7_imp {
-    float low;
-    float high;
-    float istep;
-    int size;
-    float data[tab_size];
-    operator tableoutput12au7&() const { return *(tableoutput12au7*)this; }
-};
+#include "gx_nltable.h"
 
- static tableoutput12au7_imp<2048> output12au7_table __rt_data = {
+ static nltable_imp<2048> output12au7_table __rt_data = {
 	0,-0.833333,682.333,2048, {
 	0.000000000000,-0.000592578143,-0.001184919845,-0.001777025193,-0.002368894299,
 	-0.002960527276,-0.003551924234,-0.004143085288,-0.004734010547,-0.005324700124,
@@ -440,17 +424,6 @@ struct tableoutput12au7_imp {
 };
 
 double always_inline output12au7clip(double x) {
-    double f = fabs(x);
-    f = f * output12au7_table.istep;
-    int i = static_cast<int>(f);
-    if (i < 0) {
-        f = output12au7_table.data[0];
-    } else if (i >= output12au7_table.size-1) {
-        f = output12au7_table.data[output12au7_table.size-1];
-    } else {
-    f -= i;
-    f = output12au7_table.data[i]*(1-f) + output12au7_table.data[i+1]*f;
-    }
-    return copysign(f, x);
+    return nltable_lookup_odd<1>(output12au7_table, x);
 }
 
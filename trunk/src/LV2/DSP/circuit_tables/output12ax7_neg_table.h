@@ -6,25 +6,9 @@
  // --table_div  73.995059
  // --table_op  0.100000
 
-struct tableoutput12ax7_neg { // 1-dimensional function table
-    float low;
-    float high;
-    float istep;
-    int size;
-    float data[];
-};
-
-template <int tab_size>
-struct tableoutput12ax7_neg_imp {
-    float low;
-    float high;
-    float istep;
-    int size;
-    float data[tab_size];
-    operator tableoutput12ax7_neg&() const { return *(tableoutput12ax7_neg*)this; }
-};
+#include "gx_nltable.h"
 
- static tableoutput12ax7_neg_imp<2048> output12ax7_neg_table __rt_data = {
+ static nltable_imp<2048> output12ax7_neg_table __rt_data = {
 	0,0.575793,68.2333,2048, {
 	0.000000000000,0.000586859355,0.001173400184,0.001759622579,0.002345526633,
 	0.002931112438,0.003516380084,0.004101329664,0.004685961270,0.005270274992,
@@ -440,17 +424,6 @@ struct tableoutput12ax7_neg_imp {
 };
 
 double always_inline output12ax7_negclip(double x) {
-    double f = fabs(x);
-    f = f * output12ax7_neg_table.istep;
-    int i = static_cast<int>(f);
-    if (i < 0) {
-        f = output12ax7_neg_table.data[0];
-    } else if (i >= output12ax7_neg_table.size-1) {
-        f = output12ax7_neg_table.data[output12ax7_neg_table.size-1];
-    } else {
-    f -= i;
-    f = output12ax7_neg_table.data[i]*(1-f) + output12ax7_neg_table.data[i+1]*f;
-    }
-    return copysign(f, x);
+    return nltable_lookup_odd<1>(output12ax7_neg_table, x);
 }
 
@@ -6,25 +6,9 @@
  // --table_div  73.995059
  // --table_op  0.100000
 
-struct tableoutput12ax7 { // 1-dimensional function table
-    float low;
-    float high;
-    float istep;
-    int size;
-    float data[];
-};
-
-template <int tab_size>
-struct tableoutput12ax7_imp {
-    float low;
-    float high;
-    float istep;
-    int size;
-    float data[tab_size];
-    operator tableoutput12ax7&() const { return *(tableoutput12ax7*)this; }
-};
+#include "gx_nltable.h"
 
- static tableoutput12ax7_imp<2048> output12ax7_table __rt_data = {
+ static nltable_imp<2048> output12ax7_table __rt_data = {
 	0,-0.833333,68.2333,2048, {
 	0.000000000000,-0.000586917199,-0.001173631533,-0.001760143043,-0.002346451768,
 	-0.002932557749,-0.003518461024,-0.004104161635,-0.004689659621,-0.005274955022,
@@ -440,17 +424,6 @@ struct tableoutput12ax7_imp {
 };
 
 double always_inline output12ax7clip(double x) {
-    double f = fabs(x);
-    f = f * output12ax7_table.istep;
-    int i = static_cast<int>(f);
-    if (i < 0) {
-        f = output12ax7_table.data[0];
-    } else if (i >= output12ax7_table.size-1) {
-        f = output12ax7_table.data[output12ax7_table.size-1];
-    } else {
-    f -= i;
-    f = output12ax7_table.data[i]*(1-f) + output12ax7_table.data[i+1]*f;
-    }
-    return copysign(f, x);
+    return nltable_lookup_odd<1>(output12ax7_table, x);
 }
 
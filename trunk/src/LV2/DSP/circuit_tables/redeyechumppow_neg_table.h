@@ -6,25 +6,9 @@
  // --table_div  4.770702
  // --table_op  0.050000
 
-struct tableredeyechumppow_neg { // 1-dimensional function table
-    float low;
-    float high;
-    float istep;
-    int size;
-    float data[];
-};
-
-template <int tab_size>
-struct tableredeyechumppow_neg_imp {
-    float low;
-    float high;
-    float istep;
-    int size;
-    float data[tab_size];
-    operator tableredeyechumppow_neg&() const { return *(tableredeyechumppow_neg*)this; }
-};
+#include "gx_nltable.h"
 
- static tableredeyechumppow_neg_imp<200> redeyechumppow_neg_table __rt_data = {
+ static nltable_imp<200> redeyechumppow_neg_table __rt_data = {
 	0,-1.94395,3.31667,200, {
 	0.000000000000,-0.028613654473,-0.057661518858,-0.087127795156,-0.116996134984,
 	-0.147249682562,-0.177871117130,-0.208842694497,-0.240146287453,-0.271763424806,
@@ -70,17 +54,6 @@ struct tableredeyechumppow_neg_imp {
 };
 
 double always_inline redeyechumppow_negclip(double x) {
-    double f = fabs(x);
-    f = f * redeyechumppow_neg_table.istep;
-    int i = static_cast<int>(f);
-    if (i < 0) {
-        f = redeyechumppow_neg_table.data[0];
-    } else if (i >= redeyechumppow_neg_table.size-1) {
-        f = redeyechumppow_neg_table.data[redeyechumppow_neg_table.size-1];
-    } else {
-    f -= i;
-    f = redeyechumppow_neg_table.data[i]*(1-f) + redeyechumppow_neg_table.data[i+1]*f;
-    }
-    return copysign(f, x);
+    return nltable_lookup_odd<1>(redeyechumppow_neg_table, x);
 }
 
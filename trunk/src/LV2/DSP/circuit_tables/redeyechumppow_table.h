@@ -6,25 +6,9 @@
  // --table_div  4.770702
  // --table_op  0.050000
 
-struct tableredeyechumppow { // 1-dimensional function table
-    float low;
-    float high;
-    float istep;
-    int size;
-    float data[];
-};
-
-template <int tab_size>
-struct tableredeyechumppow_imp {
-    float low;
-    float high;
-    float istep;
-    int size;
-    float data[tab_size];
-    operator tableredeyechumppow&() const { return *(tableredeyechumppow*)this; }
-};
+#include "gx_nltable.h"
 
- static tableredeyechumppow_imp<200> redeyechumppow_table __rt_data = {
+ static nltable_imp<200> redeyechumppow_table __rt_data = {
 	0,0.833333,3.31667,200, {
 	0.000000000000,0.028060390881,0.055458689166,0.082195955794,0.108274014339,
 	0.133695428026,0.158463476394,0.182582131682,0.206056035114,0.228890473555,
@@ -70,17 +54,6 @@ struct tableredeyechumppow_imp {
 };
 
 double always_inline redeyechumppowclip(double x) {
-    double f = fabs(x);
-    f = f * redeyechumppow_table.istep;
-    int i = static_cast<int>(f);
-    if (i < 0) {
-        f = redeyechumppow_table.data[0];
-    } else if (i >= redeyechumppow_table.size-1) {
-        f = redeyechumppow_table.data[redeyechumppow_table.size-1];
-    } else {
-    f -= i;
-    f = redeyechumppow_table.data[i]*(1-f) + redeyechumppow_table.data[i+1]*f;
-    }
-    return copysign(f, x);
+    return nltable_lookup_odd<1>(redeyechumppow_table, x);
 }
 
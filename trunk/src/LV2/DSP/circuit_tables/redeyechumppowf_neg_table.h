@@ -6,25 +6,9 @@
  // --table_div  4.771952
  // --table_op  0.100000
 
-struct tableredeyechumppowf_neg { // 1-dimensional function table
-    float low;
-    float high;
-    float istep;
-    int size;
-    float data[];
-};
-
-template <int tab_size>
-struct tableredeyechumppowf_neg_imp {
-    float low;
-    float high;
-    float istep;
-    int size;
-    float data[tab_size];
-    operator tableredeyechumppowf_neg&() const { return *(tableredeyechumppowf_neg*)this; }
-};
+#include "gx_nltable.h"
 
- static tableredeyechumppowf_neg_imp<200> redeyechumppowf_neg_table __rt_data = {
+ static nltable_imp<200> redeyechumppowf_neg_table __rt_data = {
 	0,-1.96437,6.63333,200, {
 	0.000000000000,-0.018477652059,-0.037053928402,-0.055724469953,-0.074484995101,
 	-0.093331299675,-0.112259256702,-0.131264815964,-0.150344003382,-0.169492920248,
@@ -70,17 +54,6 @@ struct tableredeyechumppowf_neg_imp {
 };
 
 double always_inline redeyechumppowf_negclip(double x) {
-    double f = fabs(x);
-    f = f * redeyechumppowf_neg_table.istep;
-    int i = static_cast<int>(f);
-    if (i < 0) {
-        f = redeyechumppowf_neg_table.data[0];
-    } else if (i >= redeyechumppowf_neg_table.size-1) {
-        f = redeyechumppowf_neg_table.data[redeyechumppowf_neg_table.size-1];
-    } else {
-    f -= i;
-    f = redeyechumppowf_neg_table.data[i]*(1-f) + redeyechumppowf_neg_table.data[i+1]*f;
-    }
-    return copysign(f, x);
+    return nltable_lookup_odd<1>(redeyechumppowf_neg_table, x);
 }
 
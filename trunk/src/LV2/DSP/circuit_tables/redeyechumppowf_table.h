@@ -6,25 +6,9 @@
  // --table_div  4.771952
  // --table_op  0.100000
 
-struct tableredeyechumppowf { // 1-dimensional function table
-    float low;
-    float high;
-    float istep;
-    int size;
-    float data[];
-};
-
-template <int tab_size>
-struct tableredeyechumppowf_imp {
-    float low;
-    float high;
-    float istep;
-    int size;
-    float data[tab_size];
-    operator tableredeyechumppowf&() const { return *(tableredeyechumppowf*)this; }
-};
+#include "gx_nltable.h"
 
- static tableredeyechumppowf_imp<200> redeyechumppowf_table __rt_data = {
+ static nltable_imp<200> redeyechumppowf_table __rt_data = {
 	0,0.833333,6.63333,200, {
 	0.000000000000,0.018331792286,0.036471929206,0.054418192007,0.072168378064,
 	0.089720303052,0.107071803332,0.124220738536,0.141164994385,0.157902485736,
@@ -70,17 +54,6 @@ struct tableredeyechumppowf_imp {
 };
 
 double always_inline redeyechumppowfclip(double x) {
-    double f = fabs(x);
-    f = f * redeyechumppowf_table.istep;
-    int i = static_cast<int>(f);
-    if (i < 0) {
-        f = redeyechumppowf_table.data[0];
-    } else if (i >= redeyechumppowf_table.size-1) {
-        f = redeyechumppowf_table.data[redeyechumppowf_table.size-1];
-    } else {
-    f -= i;
-    f = redeyechumppowf_table.data[i]*(1-f) + redeyechumppowf_table.data[i+1]*f;
-    }
-    return copysign(f, x);
+    return nltable_lookup_odd<1>(redeyechumppowf_table, x);
 }
 
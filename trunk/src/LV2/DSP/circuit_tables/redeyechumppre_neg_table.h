@@ -8,25 +8,9 @@
  // --table_div  32.006667
  // --table_op  3.000000
 
-struct tableredeyechumppre_neg { // 1-dimensional function table
-    float low;
-    float high;
-    float istep;
-    int size;
-    float data[];
-};
-
-template <int tab_size>
-struct tableredeyechumppre_neg_imp {
-    float low;
-    float high;
-    float istep;
-    int size;
-    float data[tab_size];
-    operator tableredeyechumppre_neg&() const { return *(tableredeyechumppre_neg*)this; }
-};
+#include "gx_nltable.h"
 
- static tableredeyechumppre_neg_imp<200> redeyechumppre_neg_table __rt_data = {
+ static nltable_imp<200> redeyechumppre_neg_table __rt_data = {
 	0,0.610985,398,200, {
 	0.000000000000,0.001886690064,0.003809887092,0.005768824333,0.007762755758,
 	0.009790955256,0.011852715864,0.013947349028,0.016074183896,0.018232566638,
@@ -72,18 +56,7 @@ struct tableredeyechumppre_neg_imp {
 };
 
 double always_inline redeyechumppre_negclip(double x) {
-    double f = fabs(x);
-    f = f * redeyechumppre_neg_table.istep;
-    int i = static_cast<int>(f);
-    if (i < 0) {
-        f = redeyechumppre_neg_table.data[0];
-    } else if (i >= redeyechumppre_neg_table.size-1) {
-        f = redeyechumppre_neg_table.data[redeyechumppre_neg_table.size-1];
-    } else {
-    f -= i;
-    f = redeyechumppre_neg_table.data[i]*(1-f) + redeyechumppre_neg_table.data[i+1]*f;
-    }
-    return copysign(f, x);
+    return nltable_lookup_odd<1>(redeyechumppre_neg_table, x);
 }
 
 #endif // _REDEYE_CHUMPPRE_NEG_H_
@@ -8,25 +8,9 @@
  // --table_div  32.006667
  // --table_op  3.000000
 
-struct tableredeyechumppre { // 1-dimensional function table
-    float low;
-    float high;
-    float istep;
-    int size;
-    float data[];
-};
-
-template <int tab_size>
-struct tableredeyechumppre_imp {
-    float low;
-    float high;
-    float istep;
-    int size;
-    float data[tab_size];
-    operator tableredeyechumppre&() const { return *(tableredeyechumppre*)this; }
-};
+#include "gx_nltable.h"
 
- static tableredeyechumppre_imp<200> redeyechumppre_table __rt_data = {
+ static nltable_imp<200> redeyechumppre_table __rt_data = {
 	0,-0.833333,398,200, {
 	0.000000000000,-0.001890319703,-0.003824468511,-0.005801811652,-0.007821732924,
 	-0.009883633954,-0.011986933481,-0.014131066671,-0.016315484463,-0.018539652942,
@@ -72,18 +56,7 @@ struct tableredeyechumppre_imp {
 };
 
 double always_inline redeyechumppreclip(double x) {
-    double f = fabs(x);
-    f = f * redeyechumppre_table.istep;
-    int i = static_cast<int>(f);
-    if (i < 0) {
-        f = redeyechumppre_table.data[0];
-    } else if (i >= redeyechumppre_table.size-1) {
-        f = redeyechumppre_table.data[redeyechumppre_table.size-1];
-    } else {
-    f -= i;
-    f = redeyechumppre_table.data[i]*(1-f) + redeyechumppre_table.data[i+1]*f;
-    }
-    return copysign(f, x);
+    return nltable_lookup_odd<1>(redeyechumppre_table, x);
 }
 #endif // _REDEYE_CHUMPPRE_H_
 
@@ -6,25 +6,9 @@
  // --table_div  1.700617
  // --table_op  1.000000
 
-struct tabletiltdrivepro_in_neg { // 1-dimensional function table
-    float low;
-    float high;
-    float istep;
-    int size;
-    float data[];
-};
-
-template <int tab_size>
-struct tabletiltdrivepro_in_neg_imp {
-    float low;
-    float high;
-    float istep;
-    int size;
-    float data[tab_size];
-    operator tabletiltdrivepro_in_neg&() const { return *(tabletiltdrivepro_in_neg*)this; }
-};
+#include "gx_nltable.h"
 
- static tabletiltdrivepro_in_neg_imp<2048> tiltdrivepro_in_neg_table __rt_data = {
+ static nltable_imp<2048> tiltdrivepro_in_neg_table __rt_data = {
 	0,0.715658,1364.67,2048, {
 	0.000000000000,0.001433353226,0.002879693202,0.004337116098,0.005803835880,
 	0.007278178271,0.008758574994,0.010243558293,0.011731755709,0.013221885110,
@@ -440,17 +424,6 @@ struct tabletiltdrivepro_in_neg_imp {
 };
 
 double always_inline tiltdrivepro_in_negclip(double x) {
-    double f = fabs(x);
-    f = f * tiltdrivepro_in_neg_table.istep;
-    int i = static_cast<int>(f);
-    if (i < 0) {
-        f = tiltdrivepro_in_neg_table.data[0];
-    } else if (i >= tiltdrivepro_in_neg_table.size-1) {
-        f = tiltdrivepro_in_neg_table.data[tiltdrivepro_in_neg_table.size-1];
-    } else {
-    f -= i;
-    f = tiltdrivepro_in_neg_table.data[i]*(1-f) + tiltdrivepro_in_neg_table.data[i+1]*f;
-    }
-    return copysign(f, x);
+    return nltable_lookup_odd<1>(tiltdrivepro_in_neg_table, x);
 }
 
@@ -6,25 +6,9 @@
  // --table_div  1.700617
  // --table_op  1.000000
 
-struct tabletiltdrivepro_in { // 1-dimensional function table
-    float low;
-    float high;
-    float istep;
-    int size;
-    float data[];
-};
-
-template <int tab_size>
-struct tabletiltdrivepro_in_imp {
-    float low;
-    float high;
-    float istep;
-    int size;
-    float data[tab_size];
-    operator tabletiltdrivepro_in&() const { return *(tabletiltdrivepro_in*)this; }
-};
+#include "gx_nltable.h"
 
- static tabletiltdrivepro_in_imp<2048> tiltdrivepro_in_table __rt_data = {
+ static nltable_imp<2048> tiltdrivepro_in_table __rt_data = {
 	0,-0.833333,1364.67,2048, {
 	0.000000000000,-0.001434182008,-0.002882956218,-0.004344346759,-0.005816497532,
 	-0.007297666177,-0.008786218339,-0.010280622178,-0.011779443156,-0.013281339047,
@@ -440,17 +424,6 @@ struct tabletiltdrivepro_in_imp {
 };
 
 double always_inline tiltdrivepro_inclip(double x) {
-    double f = fabs(x);
-    f = f * tiltdrivepro_in_table.istep;
-    int i = static_cast<int>(f);
-    if (i < 0) {
-        f = tiltdrivepro_in_table.data[0];
-    } else if (i >= tiltdrivepro_in_table.size-1) {
-        f = tiltdrivepro_in_table.data[tiltdrivepro_in_table.size-1];
-    } else {
-    f -= i;
-    f = tiltdrivepro_in_table.data[i]*(1-f) + tiltdrivepro_in_table.data[i+1]*f;
-    }
-    return copysign(f, x);
+    return nltable_lookup_odd<1>(tiltdrivepro_in_table, x);
 }
 
@@ -6,25 +6,9 @@
  // --table_div  80.394349
  // --table_op  0.500000
 
-struct tabletiltdrivepro_out_3_neg { // 1-dimensional function table
-    float low;
-    float high;
-    float istep;
-    int size;
-    float data[];
-};
-
-template <int tab_size>
-struct tabletiltdrivepro_out_3_neg_imp {
-    float low;
-    float high;
-    float istep;
-    int size;
-    float data[tab_size];
-    operator tabletiltdrivepro_out_3_neg&() const { return *(tabletiltdrivepro_out_3_neg*)this; }
-};
+#include "gx_nltable.h"
 
- static tabletiltdrivepro_out_3_neg_imp<2048> tiltdrivepro_out_3_neg_table __rt_data = {
+ static nltable_imp<2048> tiltdrivepro_out_3_neg_table __rt_data = {
 	0,0.319855,170.583,2048, {
 	0.000000000000,0.000426308354,0.000852498576,0.001278570556,0.001704524183,
 	0.002130359347,0.002556075936,0.002981673838,0.003407152943,0.003832513137,
@@ -440,17 +424,6 @@ struct tabletiltdrivepro_out_3_neg_imp {
 };
 
 double always_inline tiltdrivepro_out_3_negclip(double x) {
-    double f = fabs(x);
-    f = f * tiltdrivepro_out_3_neg_table.istep;
-    int i = static_cast<int>(f);
-    if (i < 0) {
-        f = tiltdrivepro_out_3_neg_table.data[0];
-    } else if (i >= tiltdrivepro_out_3_neg_table.size-1) {
-        f = tiltdrivepro_out_3_neg_table.data[tiltdrivepro_out_3_neg_table.size-1];
-    } else {
-    f -= i;
-    f = tiltdrivepro_out_3_neg_table.data[i]*(1-f) + tiltdrivepro_out_3_neg_table.data[i+1]*f;
-    }
-    return copysign(f, x);
+    return nltable_lookup_odd<1>(tiltdrivepro_out_3_neg_table, x);
 }
 
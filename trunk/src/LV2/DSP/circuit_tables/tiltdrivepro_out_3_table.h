@@ -6,25 +6,9 @@
  // --table_div  80.394349
  // --table_op  0.500000
 
-struct tabletiltdrivepro_out_3 { // 1-dimensional function table
-    float low;
-    float high;
-    float istep;
-    int size;
-    float data[];
-};
-
-template <int tab_size>
-struct tabletiltdrivepro_out_3_imp {
-    float low;
-    float high;
-    float istep;
-    int size;
-    float data[tab_size];
-    operator tabletiltdrivepro_out_3&() const { return *(tabletiltdrivepro_out_3*)this; }
-};
+#include "gx_nltable.h"
 
- static tabletiltdrivepro_out_3_imp<2048> tiltdrivepro_out_3_table __rt_data = {
+ static nltable_imp<2048> tiltdrivepro_out_3_table __rt_data = {
 	0,-0.833333,170.583,2048, {
 	0.000000000000,-0.000426384949,-0.000852804951,-0.001279259879,-0.001705749610,
 	-0.002132274020,-0.002558832984,-0.002985426378,-0.003412054081,-0.003838715967,
@@ -440,17 +424,6 @@ struct tabletiltdrivepro_out_3_imp {
 };
 
 double always_inline tiltdrivepro_out_3clip(double x) {
-    double f = fabs(x);
-    f = f * tiltdrivepro_out_3_table.istep;
-    int i = static_cast<int>(f);
-    if (i < 0) {
-        f = tiltdrivepro_out_3_table.data[0];
-    } else if (i >= tiltdrivepro_out_3_table.size-1) {
-        f = tiltdrivepro_out_3_table.data[tiltdrivepro_out_3_table.size-1];
-    } else {
-    f -= i;
-    f = tiltdrivepro_out_3_table.data[i]*(1-f) + tiltdrivepro_out_3_table.data[i+1]*f;
-    }
-    return copysign(f, x);
+    return nltable_lookup_odd<1>(tiltdrivepro_out_3_table, x);
 }
 
@@ -6,25 +6,9 @@
  // --table_div  1.604485
  // --table_op  0.012500
 
-struct tablew20_1_neg { // 1-dimensional function table
-    float low;
-    float high;
-    float istep;
-    int size;
-    float data[];
-};
-
-template <int tab_size>
-struct tablew20_1_neg_imp {
-    float low;
-    float high;
-    float istep;
-    int size;
-    float data[tab_size];
-    operator tablew20_1_neg&() const { return *(tablew20_1_neg*)this; }
-};
+#include "gx_nltable.h"
 
- static tablew20_1_neg_imp<2048> w20_1_neg_table __rt_data = {
+ static nltable_imp<2048> w20_1_neg_table __rt_data = {
 	0,0.58808,17.0583,2048, {
 	0.000000000000,0.023698998688,0.043512932492,0.060728273727,0.076191503079,
 	0.090459737345,0.103899788828,0.116753311426,0.129179643916,0.141283985921,
@@ -440,17 +424,6 @@ struct tablew20_1_neg_imp {
 };
 
 double always_inline w20_1_negclip(double x) {
-    double f = fabs(x);
-    f = f * w20_1_neg_table.istep;
-    int i = static_cast<int>(f);
-    if (i < 0) {
-        f = w20_1_neg_table.data[0];
-    } else if (i >= w20_1_neg_table.size-1) {
-        f = w20_1_neg_table.data[w20_1_neg_table.size-1];
-    } else {
-    f -= i;
-    f = w20_1_neg_table.data[i]*(1-f) + w20_1_neg_table.data[i+1]*f;
-    }
-    return copysign(f, x);
+    return nltable_lookup_odd<1>(w20_1_neg_table, x);
 }
 
@@ -6,25 +6,9 @@
  // --table_div  1.604485
  // --table_op  0.012500
 
-struct tablew20_1 { // 1-dimensional function table
-    float low;
-    float high;
-    float istep;
-    int size;
-    float data[];
-};
-
-template <int tab_size>
-struct tablew20_1_imp {
-    float low;
-    float high;
-    float istep;
-    int size;
-    float data[tab_size];
-    operator tablew20_1&() const { return *(tablew20_1*)this; }
-};
+#include "gx_nltable.h"
 
- static tablew20_1_imp<2048> w20_1_table __rt_data = {
+ static nltable_imp<2048> w20_1_table __rt_data = {
 	0,-0.833333,17.0583,2048, {
 	0.000000000000,-0.023703513691,-0.043530065375,-0.060764735321,-0.076253119252,
 	-0.090551762388,-0.104027099795,-0.116920529122,-0.129391208557,-0.141544204718,
@@ -440,17 +424,6 @@ struct tablew20_1_imp {
 };
 
 double always_inline w20_1clip(double x) {
-    double f = fabs(x);
-    f = f * w20_1_table.istep;
-    int i = static_cast<int>(f);
-    if (i < 0) {
-        f = w20_1_table.data[0];
-    } else if (i >= w20_1_table.size-1) {
-        f = w20_1_table.data[w20_1_table.size-1];
-    } else {
-    f -= i;
-    f = w20_1_table.data[i]*(1-f) + w20_1_table.data[i+1]*f;
-    }
-    return copysign(f, x);
+    return nltable_lookup_odd<1>(w20_1_table, x);
 }
 
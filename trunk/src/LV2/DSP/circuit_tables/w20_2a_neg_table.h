@@ -6,25 +6,9 @@
  // --table_div  1.000000
  // --table_op  0.020000
 
-struct tablew20_2a_neg { // 1-dimensional function table
-    float low;
-    float high;
-    float istep;
-    int size;
-    float data[];
-};
-
-template <int tab_size>
-struct tablew20_2a_neg_imp {
-    float low;
-    float high;
-    float istep;
-    int size;
-    float data[tab_size];
-    operator tablew20_2a_neg&() const { return *(tablew20_2a_neg*)this; }
-};
+#include "gx_nltable.h"
 
- static tablew20_2a_neg_imp<2048> w20_2a_neg_table __rt_data = {
+ static nltable_imp<2048> w20_2a_neg_table __rt_data = {
 	0,0.00185676,4.094,2048, {
 	0.000000000000,0.072348300926,0.140660805033,0.176034316294,0.189144547117,
 	0.196235506581,0.200912692525,0.204320969364,0.206954482669,0.209068764162,
@@ -440,17 +424,6 @@ struct tablew20_2a_neg_imp {
 };
 
 double always_inline w20_2a_negclip(double x) {
-    double f = fabs(x);
-    f = f * w20_2a_neg_table.istep;
-    int i = static_cast<int>(f);
-    if (i < 0) {
-        f = w20_2a_neg_table.data[0];
-    } else if (i >= w20_2a_neg_table.size-1) {
-        f = w20_2a_neg_table.data[w20_2a_neg_table.size-1];
-    } else {
-    f -= i;
-    f = w20_2a_neg_table.data[i]*(1-f) + w20_2a_neg_table.data[i+1]*f;
-    }
-    return copysign(f, x);
+    return nltable_lookup_odd<1>(w20_2a_neg_table, x);
 }
 
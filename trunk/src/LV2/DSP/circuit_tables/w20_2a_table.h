@@ -6,25 +6,9 @@
  // --table_div  1.000000
  // --table_op  0.020000
 
-struct tablew20_2a { // 1-dimensional function table
-    float low;
-    float high;
-    float istep;
-    int size;
-    float data[];
-};
-
-template <int tab_size>
-struct tablew20_2a_imp {
-    float low;
-    float high;
-    float istep;
-    int size;
-    float data[tab_size];
-    operator tablew20_2a&() const { return *(tablew20_2a*)this; }
-};
+#include "gx_nltable.h"
 
- static tablew20_2a_imp<2048> w20_2a_table __rt_data = {
+ static nltable_imp<2048> w20_2a_table __rt_data = {
 	0,-0.186024,4.094,2048, {
 	0.000000000000,-0.072331728515,-0.138143979450,-0.168307280988,-0.180067238815,
 	-0.186686541813,-0.191136422906,-0.194414538831,-0.196965536775,-0.199024012289,
@@ -440,17 +424,6 @@ struct tablew20_2a_imp {
 };
 
 double always_inline w20_2aclip(double x) {
-    double f = fabs(x);
-    f = f * w20_2a_table.istep;
-    int i = static_cast<int>(f);
-    if (i < 0) {
-        f = w20_2a_table.data[0];
-    } else if (i >= w20_2a_table.size-1) {
-        f = w20_2a_table.data[w20_2a_table.size-1];
-    } else {
-    f -= i;
-    f = w20_2a_table.data[i]*(1-f) + w20_2a_table.data[i+1]*f;
-    }
-    return copysign(f, x);
+    return nltable_lookup_odd<1>(w20_2a_table, x);
 }
 
@@ -29,6 +29,10 @@
 #include <cstring>
 #include <unistd.h>
 
+// table lookup for the nonlinearities (needs to be outside of the
+// plugin namespaces)
+#include "gx_nltable.h"
+
 ///////////////////////// DENORMAL PROTECTION WITH SSE /////////////////
 
 #ifdef __SSE__
@@ -20,11 +20,151 @@
 #include "gx_convolver.h"
 #include "gx_compiler.h"
 #include <string.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <unistd.h>
+#include <pthread.h>
+#include <sys/utsname.h>
 /****************************************************************
  ** some pieces in this file are copied from jconvolver
  */
 
 #define max(x, y) (((x) > (y)) ? (x) : (y))
+/****************************************************************
+ ** convolver profile
+ **
+ ** partition layouts measured by the guitarix engine for this
+ ** machine (see ConvolverTuner in src/headers/gx_convtune.h, keep
+ ** the file format and cpu_signature() in sync); read only, the
+ ** plugins don't run the benchmark
+ */
+
+struct ProfileEntry
+{
+  uint32_t nchan;
+  uint32_t quantum;
+  uint32_t minpart;
+  uint32_t size;
+  uint32_t maxpart;
+};
+
+static const int max_profile_entries = 256;
+static ProfileEntry profile[max_profile_entries];
+static int profile_entries = 0;
+static pthread_once_t profile_once = PTHREAD_ONCE_INIT;
+
+static void cpu_signature(char *s, size_t len)
+{
+  struct utsname u;
+  snprintf(s, len, "%s %ld", uname(&u) == 0 ? u.machine : "",
+           sysconf(_SC_NPROCESSORS_ONLN));
+  FILE *f = fopen("/proc/cpuinfo", "r");
+  if (!f)
+    {
+      return;
+    }
+  char line[256];
+  while (fgets(line, sizeof(line), f))
+    {
+      line[strcspn(line, "\n")] = 0;
+      char *p = strchr(line, ':');
+      if (!p)
+        {
+          continue;
+        }
+      char *e = p;
+      while (e > line && (e[-1] == ' ' || e[-1] == '\t'))
+        {
+          e--;
+        }
+      *e = 0;
+      if (strcmp(line, "model name") == 0 ||  // x86
+          strcmp(line, "CPU part") == 0 ||    // arm
+          strcmp(line, "cpu") == 0)           // ppc
+        {
+          p += 1 + strspn(p + 1, " \t");
+          if (*p)
+            {
+              size_t n = strlen(s);
+              snprintf(s + n, len - n, " %s", p);
+            }
+          break;
+        }
+    }
+  fclose(f);
+}
+
+static void load_profile()
+{
+  char fname[1024];
+  const char *conf = getenv("XDG_CONFIG_HOME");
+  if (conf && *conf)
+    {
+      snprintf(fname, sizeof(fname), "%s/guitarix/convolver-profile", conf);
+    }
+  else if ((conf = getenv("HOME")))
+    {
+      snprintf(fname, sizeof(fname), "%s/.config/guitarix/convolver-profile", conf);
+    }
+  else
+    {
+      return;
+    }
+  FILE *f = fopen(fname, "r");
+  if (!f)
+    {
+      return;
+    }
+  char line[512];
+  char cpu[512];
+  cpu_signature(cpu, sizeof(cpu));
+  if (fgets(line, sizeof(line), f)
+      && strcmp(line, "guitarix-convolver-profile 1\n") == 0
+      && fgets(line, sizeof(line), f)
+      && strncmp(line, "cpu ", 4) == 0)
+    {
+      line[strcspn(line, "\n")] = 0;
+      if (strcmp(line + 4, cpu) == 0)
+        {
+          while (profile_entries < max_profile_entries && fgets(line, sizeof(line), f))
+            {
+              ProfileEntry& e = profile[profile_entries];
+              if (sscanf(line, "%u %u %u %u %u", &e.nchan, &e.quantum,
+                         &e.minpart, &e.size, &e.maxpart) == 5)
+                {
+                  profile_entries++;
+                }
+            }
+        }
+    }
+  fclose(f);
+}
+
+// maxpart: default for layouts not in the profile
+static uint32_t profile_maxpart(uint32_t nchan, uint32_t size, uint32_t quantum,
+                                uint32_t minpart, uint32_t maxpart)
+{
+  pthread_once(&profile_once, load_profile);
+  uint32_t sz = 1;
+  while (sz < size && sz < 0x80000000u)
+    {
+      sz <<= 1;
+    }
+  for (int i = 0; i < profile_entries; i++)
+    {
+      const ProfileEntry& e = profile[i];
+      if (e.nchan == nchan && e.quantum == quantum && e.minpart == minpart && e.size == sz)
+        {
+          if (e.maxpart >= minpart && e.maxpart <= (uint32_t)Convproc::MAXPART)
+            {
+              return e.maxpart;
+            }
+          break;
+        }
+    }
+  return maxpart;
+}
+
 /****************************************************************
  ** GxConvolverBase
  */
@@ -183,13 +323,13 @@ bool GxSimpleConvolver::configure(int32_t count, float *impresp, uint32_t imprat
     }
 #if ZITA_CONVOLVER_VERSION == 4
         if (Convproc::configure(1, 1, count, buffersize,
-                                bufsize, Convproc::MAXPART,0.0)) {
+                                bufsize, profile_maxpart(1, count, buffersize, bufsize, Convproc::MAXPART),0.0)) {
             printf("no configure\n");
             return false;
         }        
 #else 
   if (Convproc::configure(1, 1, count, buffersize,
-                          bufsize, bufsize)) // Convproc::MAXPART
+                          bufsize, profile_maxpart(1, count, buffersize, bufsize, bufsize))) // Convproc::MAXPART
     {
       printf("no configure\n");
       return false;
@@ -318,14 +458,14 @@ bool GxSimpleConvolver::configure_stereo(int32_t count, float *impresp, uint32_t
     }
 #if ZITA_CONVOLVER_VERSION == 4
       if (Convproc::configure(2, 2, count, buffersize,
-                              bufsize, bufsize,0.0)) // Convproc::MAXPART
+                              bufsize, profile_maxpart(2, count, buffersize, bufsize, bufsize),0.0)) // Convproc::MAXPART
         {
           printf("no configure\n");
           return false;
         }
 #else 
   if (Convproc::configure(2, 2, count, buffersize,
-                          bufsize, bufsize)) // Convproc::MAXPART
+                          bufsize, profile_maxpart(2, count, buffersize, bufsize, bufsize))) // Convproc::MAXPART
     {
       printf("no configure\n");
       return false;
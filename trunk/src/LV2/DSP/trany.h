@@ -30,31 +30,11 @@
 #define SRC_HEADERS_TRANY_H_
 
 /****************************************************************
- * 1-dimensional function tables for linear interpolation
- *
- * table1d and table1d_imp<size> must only differ in the last
- * element, so that the typecast for tranytab below will work.
- * Can't use inheritance because then C initializers will not
- * work and initialization will be more awkward or less efficient.
+ * 1-dimensional function tables, see gx_nltable.h
+ * (the tables are generated for linear interpolation)
  */
 
-struct table1d { // 1-dimensional function table
-    float low;
-    float high;
-    float istep;
-    int size;
-    float data[];
-};
-
-template <int tab_size>
-struct table1d_imp {
-    float low;
-    float high;
-    float istep;
-    int size;
-    float data[tab_size];
-    operator table1d&() const { return *(table1d*)this; }
-};
+#include "gx_nltable.h"
 
 /*
  * data tables generated by tools/tube_transfer.py
@@ -70,18 +50,18 @@ enum {
     TRANY_TABLE_SIZE
 };
 
-table1d *tranytab[TRANY_TABLE_SIZE] = {
-    &static_cast<table1d&>(tubetable_KT88[0]),
-    &static_cast<table1d&>(tubetable_KT88[1]),
-    &static_cast<table1d&>(tubetable_7199P[0]),
-    &static_cast<table1d&>(tubetable_7199P[1]),
+nltable *tranytab[TRANY_TABLE_SIZE] = {
+    &static_cast<nltable&>(tubetable_KT88[0]),
+    &static_cast<nltable&>(tubetable_KT88[1]),
+    &static_cast<nltable&>(tubetable_7199P[0]),
+    &static_cast<nltable&>(tubetable_7199P[1]),
 };
 
-table1d *tranytab2[TRANY_TABLE_SIZE] = {
-    &static_cast<table1d&>(tubetable2_KT88[0]),
-    &static_cast<table1d&>(tubetable2_KT88[1]),
-    &static_cast<table1d&>(tubetable2_7199P[0]),
-    &static_cast<table1d&>(tubetable2_7199P[1]),
+nltable *tranytab2[TRANY_TABLE_SIZE] = {
+    &static_cast<nltable&>(tubetable2_KT88[0]),
+    &static_cast<nltable&>(tubetable2_KT88[1]),
+    &static_cast<nltable&>(tubetable2_7199P[0]),
+    &static_cast<nltable&>(tubetable2_7199P[1]),
 };
 
 /*
@@ -90,27 +70,11 @@ table1d *tranytab2[TRANY_TABLE_SIZE] = {
  */
 
 static inline double Ftrany(int table, double Vgk) {
-    const table1d& tab = *tranytab[table];
-    double f = (Vgk - tab.low) * tab.istep;
-    int i = static_cast<int>(f);
-    if (i < 0)
-        return tab.data[0];
-    if (i >= tab.size-1)
-        return tab.data[tab.size-1];
-    f -= i;
-    return tab.data[i]*(1-f) + tab.data[i+1]*f;
+    return nltable_lookup(*tranytab[table], Vgk);
 }
 
 static inline double Rtrany(int table, double Vgk) {
-    const table1d& tab = *tranytab2[table];
-    double f = (Vgk - tab.low) * tab.istep;
-    int i = static_cast<int>(f);
-    if (i < 0)
-        return tab.data[0];
-    if (i >= tab.size-1)
-        return tab.data[tab.size-1];
-    f -= i;
-    return tab.data[i]*(1-f) + tab.data[i+1]*f;
+    return nltable_lookup(*tranytab2[table], Vgk);
 }
 
 #endif  // SRC_HEADERS_TRANY_H_
@@ -12,7 +12,7 @@
 // Vp: 250
 // Rp: 100000
 
-table1d_imp<2001> tubetable_12AT7[2] __rt_data = {
+nltable_imp<2001> tubetable_12AT7[2] __rt_data = {
 	{ // Ri = 68k
 	-5,5,200,2001, {
 	223.48497105114055,223.38189845992403,223.2786068592581,223.17509643817309,223.07136738642214,
@@ -822,7 +822,7 @@ table1d_imp<2001> tubetable_12AT7[2] __rt_data = {
 	38.66098104176983
 	}}
 };
-table1d_imp<2001> tubetable2_12AT7[2] __rt_data = {
+nltable_imp<2001> tubetable2_12AT7[2] __rt_data = {
 	{ // Ri = 68k
 	-5,5,200,2001, {
 	90778.31476672851,90453.6603779748,90130.68594112135,89809.38058511853,89489.73351904775,
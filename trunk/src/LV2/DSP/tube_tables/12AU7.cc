@@ -12,7 +12,7 @@
 // Vp: 250
 // Rp: 100000
 
-table1d_imp<2001> tubetable_12AU7[2] __rt_data = {
+nltable_imp<2001> tubetable_12AU7[2] __rt_data = {
 	{ // Ri = 68k
 	-5,5,200,2001, {
 	127.20225505231797,127.14473552149342,127.08720854506194,127.02967413493148,126.97213230303844,
@@ -822,7 +822,7 @@ table1d_imp<2001> tubetable_12AU7[2] __rt_data = {
 	70.46336094656672
 	}}
 };
-table1d_imp<2001> tubetable2_12AU7[2] __rt_data = {
+nltable_imp<2001> tubetable2_12AU7[2] __rt_data = {
 	{ // Ri = 68k
 	-5,5,200,2001, {
 	21570.200094980897,21562.163047252146,21554.136263445507,21546.119738380567,21538.113466881106,
@@ -12,7 +12,7 @@
 // Vp: 250
 // Rp: 100000
 
-table1d_imp<2001> tubetable_12AY7[2] __rt_data = {
+nltable_imp<2001> tubetable_12AY7[2] __rt_data = {
 	{ // Ri = 68k
 	-5,5,200,2001, {
 	211.25744136465542,211.13846999615515,211.01935267310878,210.90008968063967,210.7806813033254,
@@ -822,7 +822,7 @@ table1d_imp<2001> tubetable_12AY7[2] __rt_data = {
 	53.64326038611861
 	}}
 };
-table1d_imp<2001> tubetable2_12AY7[2] __rt_data = {
+nltable_imp<2001> tubetable2_12AY7[2] __rt_data = {
 	{ // Ri = 68k
 	-5,5,200,2001, {
 	59862.95462879426,59710.61019340378,59558.982682759466,59408.06780595269,59257.86130344113,
@@ -12,7 +12,7 @@
 // Vp: 250
 // Rp: 100000
 
-table1d_imp<2001> tubetable_12AX7[2] __rt_data = {
+nltable_imp<2001> tubetable_12AX7[2] __rt_data = {
 	{ // Ri = 68k
 	-5,5,200,2001, {
 	249.98706929001784,249.98685122494211,249.98662948898132,249.98640402054366,249.9861747570101,
@@ -822,7 +822,7 @@ table1d_imp<2001> tubetable_12AX7[2] __rt_data = {
 	93.76366800525633
 	}}
 };
-table1d_imp<2001> tubetable2_12AX7[2] __rt_data = {
+nltable_imp<2001> tubetable2_12AX7[2] __rt_data = {
 	{ // Ri = 68k
 	-5,5,200,2001, {
 	107069048.23743129,105392174.78838265,103741722.07577392,102117272.43912883,100518414.82119504,
@@ -12,7 +12,7 @@
 // Vp: 250
 // Rp: 100000
 
-table1d_imp<2001> tubetable_6C16[2] __rt_data = {
+nltable_imp<2001> tubetable_6C16[2] __rt_data = {
 	{ // Ri = 68k
 	-5,5,200,2001, {
 	214.80658167695216,214.65058771171968,214.49444138769778,214.3381434491597,214.18169463470204,
@@ -822,7 +822,7 @@ table1d_imp<2001> tubetable_6C16[2] __rt_data = {
 	31.091959985639914
 	}}
 };
-table1d_imp<2001> tubetable2_6C16[2] __rt_data = {
+nltable_imp<2001> tubetable2_6C16[2] __rt_data = {
 	{ // Ri = 68k
 	-5,5,200,2001, {
 	29779.50573099651,29662.13798276357,29545.626172947257,29429.961483696286,29315.135213105117,
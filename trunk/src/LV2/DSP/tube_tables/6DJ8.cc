@@ -12,7 +12,7 @@
 // Vp: 250
 // Rp: 100000
 
-table1d_imp<2001> tubetable_6DJ8[2] __rt_data = {
+nltable_imp<2001> tubetable_6DJ8[2] __rt_data = {
 	{ // Ri = 68k
 	-5,5,200,2001, {
 	137.512728867083,137.39922326360644,137.2856902513437,137.17212984000545,137.058542039243,
@@ -822,7 +822,7 @@ table1d_imp<2001> tubetable_6DJ8[2] __rt_data = {
 	14.708149009126426
 	}}
 };
-table1d_imp<2001> tubetable2_6DJ8[2] __rt_data = {
+nltable_imp<2001> tubetable2_6DJ8[2] __rt_data = {
 	{ // Ri = 68k
 	-5,5,200,2001, {
 	10721.035383640725,10707.851918965107,10694.691631754054,10681.55446858672,10668.440376226128,
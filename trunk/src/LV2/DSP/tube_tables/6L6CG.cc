@@ -12,7 +12,7 @@
 // Vp: 450
 // Rp: 5000
 
-table1d_imp<2001> tubetable_6L6CG[2] __rt_data = {
+nltable_imp<2001> tubetable_6L6CG[2] __rt_data = {
 	{ // Ri = 68k
 	-21,21,47.619,2001, {
 	250.851854386,250.727213665,250.602546401,250.477852608,250.3531323,
@@ -12,7 +12,7 @@
 // Vp: 250
 // Rp: 100000
 
-table1d_imp<2001> tubetable_6V6[2] __rt_data = {
+nltable_imp<2001> tubetable_6V6[2] __rt_data = {
 	{ // Ri = 68k
 	-5,5,200,2001, {
 	246.2362537277177,246.2241737057493,246.21202623309082,246.19981092052473,246.18752737667538,
@@ -822,7 +822,7 @@ table1d_imp<2001> tubetable_6V6[2] __rt_data = {
 	75.40920714588924
 	}}
 };
-table1d_imp<2001> tubetable2_6V6[2] __rt_data = {
+nltable_imp<2001> tubetable2_6V6[2] __rt_data = {
 	{ // Ri = 68k
 	-5,5,200,2001, {
 	4635992.402307132,4623630.920878677,4611263.194911325,4598889.424112773,4586509.808691225,
@@ -12,7 +12,7 @@
 // Vp: 250
 // Rp: 100000
 
-table1d_imp<2001> tubetable_7199P[2] __rt_data = {
+nltable_imp<2001> tubetable_7199P[2] __rt_data = {
 	{ // Ri = 68k
 	-5,5,200,2001, {
 	142.154063279271,142.0742340672837,141.9943668161626,141.9144615036712,141.83451810751512,
@@ -822,7 +822,7 @@ table1d_imp<2001> tubetable_7199P[2] __rt_data = {
 	35.61170563115958
 	}}
 };
-table1d_imp<2001> tubetable2_7199P[2] __rt_data = {
+nltable_imp<2001> tubetable2_7199P[2] __rt_data = {
 	{ // Ri = 68k
 	-5,5,200,2001, {
 	26841.00738226179,26815.730592135267,26790.475270993065,26765.241389312894,26740.028917616168,
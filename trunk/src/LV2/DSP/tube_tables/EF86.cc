@@ -12,7 +12,7 @@
 // Vp: 250
 // Rp: 100000
 
-table1d_imp<2001> tubetable_EF86[2] __rt_data = {
+nltable_imp<2001> tubetable_EF86[2] __rt_data = {
 	{ // Ri = 68k
 	-5,5,200,2001, {
 	181.53912491572595,181.4332084765696,181.32723172109516,181.22119470111903,181.11509746837,
@@ -822,7 +822,7 @@ table1d_imp<2001> tubetable_EF86[2] __rt_data = {
 	54.85580251419074
 	}}
 };
-table1d_imp<2001> tubetable2_EF86[2] __rt_data = {
+nltable_imp<2001> tubetable2_EF86[2] __rt_data = {
 	{ // Ri = 68k
 	-5,5,200,2001, {
 	38840.92200373405,38790.250291968056,38739.70269456312,38689.27882998362,38638.97831824558,
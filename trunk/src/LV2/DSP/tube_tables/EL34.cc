@@ -12,7 +12,7 @@
 // Vp: 495
 // Rp: 3500
 
-table1d_imp<2001> tubetable_EL34[2] __rt_data = {
+nltable_imp<2001> tubetable_EL34[2] __rt_data = {
 	{ // Ri = 68k
 	-20,20,50,2001, {
 	288.9476929184571,288.7948610045677,288.6419831295935,288.4890593106638,288.3360895649282,
@@ -822,7 +822,7 @@ table1d_imp<2001> tubetable_EL34[2] __rt_data = {
 	118.53805455288165
 	}}
 };
-table1d_imp<2001> tubetable2_EL34[2] __rt_data = {
+nltable_imp<2001> tubetable2_EL34[2] __rt_data = {
 	{ // Ri = 68k
 	-20,20,50,2001, {
 	1169.6765993724734,1169.020805767464,1168.3659269756686,1167.7119619531907,1167.0589096582794,
@@ -12,7 +12,7 @@
 // Vp: 370
 // Rp: 3500
 
-table1d_imp<2001> tubetable_EL84[2] __rt_data = {
+nltable_imp<2001> tubetable_EL84[2] __rt_data = {
 	{ // Ri = 68k
 	-10,10,100,2001, {
 	263.2701201203105,263.15495216609577,263.0397359214184,262.9244714230433,262.8091587077414,
@@ -822,7 +822,7 @@ table1d_imp<2001> tubetable_EL84[2] __rt_data = {
 	130.94352661050553
 	}}
 };
-table1d_imp<2001> tubetable2_EL84[2] __rt_data = {
+nltable_imp<2001> tubetable2_EL84[2] __rt_data = {
 	{ // Ri = 68k
 	-10,10,100,2001, {
 	2062.404728886117,2061.0456739423234,2059.6892192833716,2058.33535979238,2056.984090365678,
@@ -12,7 +12,7 @@
 // Vp: 250
 // Rp: 100000
 
-table1d_imp<2001> tubetable_JJECC83S[2] __rt_data = {
+nltable_imp<2001> tubetable_JJECC83S[2] __rt_data = {
 	{ // Ri = 68k
 	-5,5,200,2001, {
 	249.99944335464136,249.99943114245013,249.99941866241159,249.9994059086539,249.99939287517668,
@@ -822,7 +822,7 @@ table1d_imp<2001> tubetable_JJECC83S[2] __rt_data = {
 	115.2999127536488
 	}}
 };
-table1d_imp<2001> tubetable2_JJECC83S[2] __rt_data = {
+nltable_imp<2001> tubetable2_JJECC83S[2] __rt_data = {
 	{ // Ri = 68k
 	-5,5,200,2001, {
 	1943633466.7628152,1903700931.4244537,1864590824.445094,1826286148.2834516,1788770356.660751,
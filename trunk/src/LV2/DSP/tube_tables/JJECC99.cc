@@ -12,7 +12,7 @@
 // Vp: 250
 // Rp: 100000
 
-table1d_imp<2001> tubetable_JJECC99[2] __rt_data = {
+nltable_imp<2001> tubetable_JJECC99[2] __rt_data = {
 	{ // Ri = 68k
 	-5,5,200,2001, {
 	127.71410689388159,127.63037097463148,127.54662611437428,127.4628723371091,127.37910966689084,
@@ -822,7 +822,7 @@ table1d_imp<2001> tubetable_JJECC99[2] __rt_data = {
 	48.7620442748107
 	}}
 };
-table1d_imp<2001> tubetable2_JJECC99[2] __rt_data = {
+nltable_imp<2001> tubetable2_JJECC99[2] __rt_data = {
 	{ // Ri = 68k
 	-5,5,200,2001, {
 	12274.474491258665,12267.292706998116,12260.125203326588,12252.971968290207,12245.832989978866,
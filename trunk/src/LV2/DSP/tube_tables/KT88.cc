@@ -12,7 +12,7 @@
 // Vp: 250
 // Rp: 100000
 
-table1d_imp<2001> tubetable_KT88[2] __rt_data = {
+nltable_imp<2001> tubetable_KT88[2] __rt_data = {
 	{ // Ri = 68k
 	-5,5,200,2001, {
 	240.90442332476144,240.88712024320165,240.86971494053603,240.85220676290857,240.83459505251412,
@@ -822,7 +822,7 @@ table1d_imp<2001> tubetable_KT88[2] __rt_data = {
 	45.99692816864887
 	}}
 };
-table1d_imp<2001> tubetable2_KT88[2] __rt_data = {
+nltable_imp<2001> tubetable2_KT88[2] __rt_data = {
 	{ // Ri = 68k
 	-5,5,200,2001, {
 	1667344.0169328852,1664730.353013284,1662108.081674914,1659477.210966028,1656837.7493810894,
@@ -12,7 +12,7 @@
 // Vp: 250
 // Rp: 2000
 
-table1d_imp<2001> tubetable_SVEL34[2] __rt_data = {
+nltable_imp<2001> tubetable_SVEL34[2] __rt_data = {
 	{ // Ri = 68k
 	-25,25,40,2001, {
 	228.35363740496678,228.28468348365752,228.21558796265822,228.14635082183173,228.07697204160016,
@@ -822,7 +822,7 @@ table1d_imp<2001> tubetable_SVEL34[2] __rt_data = {
 	96.94008182097085
 	}}
 };
-table1d_imp<2001> tubetable2_SVEL34[2] __rt_data = {
+nltable_imp<2001> tubetable2_SVEL34[2] __rt_data = {
 	{ // Ri = 68k
 	-25,25,40,2001, {
 	3196.116471263702,3187.7926694823304,3179.501529796419,3171.2429006971893,3163.0166314504404,
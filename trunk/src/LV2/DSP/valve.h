@@ -24,36 +24,11 @@
 #define SRC_HEADERS_VALVE_H_
 
 /****************************************************************
- * 1-dimensional function tables for linear interpolation
- *
- * table1d and table1d_imp<size> must only differ in the last
- * element, so that the typecast for tubetab below will work.
- * Can't use inheritance because then C initializers will not
- * work and initialization will be more awkward or less efficient.
+ * 1-dimensional function tables, see gx_nltable.h
+ * (the tables are generated for linear interpolation)
  */
 
-struct table1d   // 1-dimensional function table
-{
-  float low;
-  float high;
-  float istep;
-  int32_t size;
-  float data[];
-};
-
-template <int32_t tab_size>
-struct table1d_imp
-{
-  float low;
-  float high;
-  float istep;
-  int32_t size;
-  float data[tab_size];
-  operator table1d&() const
-  {
-    return *(table1d*)this;
-  }
-};
+#include "gx_nltable.h"
 
 /*
  * data tables generated by tools/tube_transfer.py
@@ -105,67 +80,67 @@ enum {
     TUBE_TABLE_SIZE
 };
 
-table1d *tubetab[TUBE_TABLE_SIZE] = {
-    &static_cast<table1d&>(tubetable_12AX7[0]),
-    &static_cast<table1d&>(tubetable_12AX7[1]),
-    &static_cast<table1d&>(tubetable_6V6[0]),
-    &static_cast<table1d&>(tubetable_6V6[1]),
-    &static_cast<table1d&>(tubetable_12AU7[0]),
-    &static_cast<table1d&>(tubetable_12AU7[1]),
-    &static_cast<table1d&>(tubetable_6DJ8[0]),
-    &static_cast<table1d&>(tubetable_6DJ8[1]),
-    &static_cast<table1d&>(tubetable_12AT7[0]),
-    &static_cast<table1d&>(tubetable_12AT7[1]),
-    &static_cast<table1d&>(tubetable_6C16[0]),
-    &static_cast<table1d&>(tubetable_6C16[1]),
-    &static_cast<table1d&>(tubetable_6L6CG[0]),
-    &static_cast<table1d&>(tubetable_6L6CG[1]),
-    &static_cast<table1d&>(tubetable_EL34[0]),
-    &static_cast<table1d&>(tubetable_EL34[1]),
-    &static_cast<table1d&>(tubetable_12AY7[0]),
-    &static_cast<table1d&>(tubetable_12AY7[1]),
-    &static_cast<table1d&>(tubetable_JJECC83S[0]),
-    &static_cast<table1d&>(tubetable_JJECC83S[1]),
-    &static_cast<table1d&>(tubetable_JJECC99[0]),
-    &static_cast<table1d&>(tubetable_JJECC99[1]),
-    &static_cast<table1d&>(tubetable_EL84[0]),
-    &static_cast<table1d&>(tubetable_EL84[1]),
-    &static_cast<table1d&>(tubetable_EF86[0]),
-    &static_cast<table1d&>(tubetable_EF86[1]),
-    &static_cast<table1d&>(tubetable_SVEL34[0]),
-    &static_cast<table1d&>(tubetable_SVEL34[1]),
+nltable *tubetab[TUBE_TABLE_SIZE] = {
+    &static_cast<nltable&>(tubetable_12AX7[0]),
+    &static_cast<nltable&>(tubetable_12AX7[1]),
+    &static_cast<nltable&>(tubetable_6V6[0]),
+    &static_cast<nltable&>(tubetable_6V6[1]),
+    &static_cast<nltable&>(tubetable_12AU7[0]),
+    &static_cast<nltable&>(tubetable_12AU7[1]),
+    &static_cast<nltable&>(tubetable_6DJ8[0]),
+    &static_cast<nltable&>(tubetable_6DJ8[1]),
+    &static_cast<nltable&>(tubetable_12AT7[0]),
+    &static_cast<nltable&>(tubetable_12AT7[1]),
+    &static_cast<nltable&>(tubetable_6C16[0]),
+    &static_cast<nltable&>(tubetable_6C16[1]),
+    &static_cast<nltable&>(tubetable_6L6CG[0]),
+    &static_cast<nltable&>(tubetable_6L6CG[1]),
+    &static_cast<nltable&>(tubetable_EL34[0]),
+    &static_cast<nltable&>(tubetable_EL34[1]),
+    &static_cast<nltable&>(tubetable_12AY7[0]),
+    &static_cast<nltable&>(tubetable_12AY7[1]),
+    &static_cast<nltable&>(tubetable_JJECC83S[0]),
+    &static_cast<nltable&>(tubetable_JJECC83S[1]),
+    &static_cast<nltable&>(tubetable_JJECC99[0]),
+    &static_cast<nltable&>(tubetable_JJECC99[1]),
+    &static_cast<nltable&>(tubetable_EL84[0]),
+    &static_cast<nltable&>(tubetable_EL84[1]),
+    &static_cast<nltable&>(tubetable_EF86[0]),
+    &static_cast<nltable&>(tubetable_EF86[1]),
+    &static_cast<nltable&>(tubetable_SVEL34[0]),
+    &static_cast<nltable&>(tubetable_SVEL34[1]),
 };
 
-table1d *tubetab2[TUBE_TABLE_SIZE] = {
-    &static_cast<table1d&>(tubetable2_12AX7[0]),
-    &static_cast<table1d&>(tubetable2_12AX7[1]),
-    &static_cast<table1d&>(tubetable2_6V6[0]),
-    &static_cast<table1d&>(tubetable2_6V6[1]),
-    &static_cast<table1d&>(tubetable2_12AU7[0]),
-    &static_cast<table1d&>(tubetable2_12AU7[1]),
-    &static_cast<table1d&>(tubetable2_6DJ8[0]),
-    &static_cast<table1d&>(tubetable2_6DJ8[1]),
-    &static_cast<table1d&>(tubetable2_12AT7[0]),
-    &static_cast<table1d&>(tubetable2_12AT7[1]),
-    &static_cast<table1d&>(tubetable2_6C16[0]),
-    &static_cast<table1d&>(tubetable2_6C16[1]),
+nltable *tubetab2[TUBE_TABLE_SIZE] = {
+    &static_cast<nltable&>(tubetable2_12AX7[0]),
+    &static_cast<nltable&>(tubetable2_12AX7[1]),
+    &static_cast<nltable&>(tubetable2_6V6[0]),
+    &static_cast<nltable&>(tubetable2_6V6[1]),
+    &static_cast<nltable&>(tubetable2_12AU7[0]),
+    &static_cast<nltable&>(tubetable2_12AU7[1]),
+    &static_cast<nltable&>(tubetable2_6DJ8[0]),
+    &static_cast<nltable&>(tubetable2_6DJ8[1]),
+    &static_cast<nltable&>(tubetable2_12AT7[0]),
+    &static_cast<nltable&>(tubetable2_12AT7[1]),
+    &static_cast<nltable&>(tubetable2_6C16[0]),
+    &static_cast<nltable&>(tubetable2_6C16[1]),
     // using old tube table in gxmetal_head!!
-    //&static_cast<table1d&>(tubetable2_6L6CG[0]),
-    //&static_cast<table1d&>(tubetable2_6L6CG[1]),
-    &static_cast<table1d&>(tubetable2_EL34[0]),
-    &static_cast<table1d&>(tubetable2_EL34[1]),
-    &static_cast<table1d&>(tubetable2_12AY7[0]),
-    &static_cast<table1d&>(tubetable2_12AY7[1]),
-    &static_cast<table1d&>(tubetable2_JJECC83S[0]),
-    &static_cast<table1d&>(tubetable2_JJECC83S[1]),
-    &static_cast<table1d&>(tubetable2_JJECC99[0]),
-    &static_cast<table1d&>(tubetable2_JJECC99[1]),
-    &static_cast<table1d&>(tubetable2_EL84[0]),
-    &static_cast<table1d&>(tubetable2_EL84[1]),
-    &static_cast<table1d&>(tubetable2_EF86[0]),
-    &static_cast<table1d&>(tubetable2_EF86[1]),
-    &static_cast<table1d&>(tubetable2_SVEL34[0]),
-    &static_cast<table1d&>(tubetable2_SVEL34[1]),
+    //&static_cast<nltable&>(tubetable2_6L6CG[0]),
+    //&static_cast<nltable&>(tubetable2_6L6CG[1]),
+    &static_cast<nltable&>(tubetable2_EL34[0]),
+    &static_cast<nltable&>(tubetable2_EL34[1]),
+    &static_cast<nltable&>(tubetable2_12AY7[0]),
+    &static_cast<nltable&>(tubetable2_12AY7[1]),
+    &static_cast<nltable&>(tubetable2_JJECC83S[0]),
+    &static_cast<nltable&>(tubetable2_JJECC83S[1]),
+    &static_cast<nltable&>(tubetable2_JJECC99[0]),
+    &static_cast<nltable&>(tubetable2_JJECC99[1]),
+    &static_cast<nltable&>(tubetable2_EL84[0]),
+    &static_cast<nltable&>(tubetable2_EL84[1]),
+    &static_cast<nltable&>(tubetable2_EF86[0]),
+    &static_cast<nltable&>(tubetable2_EF86[1]),
+    &static_cast<nltable&>(tubetable2_SVEL34[0]),
+    &static_cast<nltable&>(tubetable2_SVEL34[1]),
 };
 /*
  *  definitions for ffunction(float Ftube(int32_t,float), "valve.h", "");
@@ -174,28 +149,12 @@ table1d *tubetab2[TUBE_TABLE_SIZE] = {
 
 static inline double Ftube(int32_t table, double Vgk)
 {
-  const table1d& tab = *tubetab[table];
-  double f = (Vgk - tab.low) * tab.istep;
-  int32_t i = static_cast<int32_t>(f);
-  if (i < 0)
-    return tab.data[0];
-  if (i >= tab.size-1)
-    return tab.data[tab.size-1];
-  f -= i;
-  return tab.data[i]*(1-f) + tab.data[i+1]*f;
+  return nltable_lookup(*tubetab[table], Vgk);
 }
 
 static inline double Ranode(int32_t table, double Vgk)
 {
-  const table1d& tab = *tubetab2[table];
-  double f = (Vgk - tab.low) * tab.istep;
-  int32_t i = static_cast<int32_t>(f);
-  if (i < 0)
-    return tab.data[0];
-  if (i >= tab.size-1)
-    return tab.data[tab.size-1];
-  f -= i;
-  return tab.data[i]*(1-f) + tab.data[i+1]*f;
+  return nltable_lookup(*tubetab2[table], Vgk);
 }
 
 #endif
@@ -1,4 +1,4 @@
-static table1dc_imp<100> clippingtable1[2] __rt_data = {{
+static nltable_imp<100> clippingtable1[2] __rt_data = {{
 
 	0.005,0.795235013262,101.97,100, {
 	0.00548195523036,0.016445865691,0.0274097761516,0.0383736866119,0.0493375970718,
@@ -139,16 +139,16 @@ void Dsp::init_static(unsigned int sample_rate, PluginDef *p)
 
 void Dsp::mem_alloc()
 {
-	if (!fVec0) fVec0 = new float[131072];
-	if (!fVec1) fVec1 = new float[131072];
+	if (!fVec0) fVec0 = rt_alloc<float>(131072);
+	if (!fVec1) fVec1 = rt_alloc<float>(131072);
 	mem_allocated = true;
 }
 
 void Dsp::mem_free()
 {
 	mem_allocated = false;
-	if (fVec0) { delete fVec0; fVec0 = 0; }
-	if (fVec1) { delete fVec1; fVec1 = 0; }
+	if (fVec0) { rt_free(fVec0); fVec0 = 0; }
+	if (fVec1) { rt_free(fVec1); fVec1 = 0; }
 }
 
 int Dsp::activate(bool start)
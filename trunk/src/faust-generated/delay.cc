@@ -102,14 +102,14 @@ void Dsp::init_static(unsigned int sample_rate, PluginDef *p)
 
 void Dsp::mem_alloc()
 {
-	if (!fVec0) fVec0 = new float[1048576];
+	if (!fVec0) fVec0 = rt_alloc<float>(1048576);
 	mem_allocated = true;
 }
 
 void Dsp::mem_free()
 {
 	mem_allocated = false;
-	if (fVec0) { delete fVec0; fVec0 = 0; }
+	if (fVec0) { rt_free(fVec0); fVec0 = 0; }
 }
 
 int Dsp::activate(bool start)
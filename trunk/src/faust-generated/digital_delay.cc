@@ -267,14 +267,14 @@ void Dsp::init_static(unsigned int sample_rate, PluginDef *p)
 
 void Dsp::mem_alloc()
 {
-	if (!fVec2) fVec2 = new float[1048576];
+	if (!fVec2) fVec2 = rt_alloc<float>(1048576);
 	mem_allocated = true;
 }
 
 void Dsp::mem_free()
 {
 	mem_allocated = false;
-	if (fVec2) { delete fVec2; fVec2 = 0; }
+	if (fVec2) { rt_free(fVec2); fVec2 = 0; }
 }
 
 int Dsp::activate(bool start)
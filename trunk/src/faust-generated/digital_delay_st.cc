@@ -14,9 +14,9 @@ private:
 	float fConst1;
 	FAUSTFLOAT fHslider2;
 	FAUSTFLOAT fVslider0;
-	float fRec2[3];
-	float fRec1[3];
-	float fVec0[2];
+	float fRec2[3][2] __attribute__((aligned(2*sizeof(float))));
+	float fRec1[3][2] __attribute__((aligned(2*sizeof(float))));
+	float fVec0[2][2] __attribute__((aligned(2*sizeof(float))));
 	float fConst3;
 	float fConst5;
 	float fConst7;
@@ -43,38 +43,38 @@ private:
 	float fConst52;
 	float fConst54;
 	float fConst55;
-	float fRec11[2];
-	float fRec10[3];
+	float fRec11[2][2] __attribute__((aligned(2*sizeof(float))));
+	float fRec10[3][2] __attribute__((aligned(2*sizeof(float))));
 	float fConst56;
-	float fRec9[3];
+	float fRec9[3][2] __attribute__((aligned(2*sizeof(float))));
 	float fConst58;
 	float fConst59;
-	float fRec8[3];
+	float fRec8[3][2] __attribute__((aligned(2*sizeof(float))));
 	float fConst61;
 	float fConst62;
-	float fRec7[3];
+	float fRec7[3][2] __attribute__((aligned(2*sizeof(float))));
 	float fConst64;
 	float fConst65;
-	float fRec6[3];
+	float fRec6[3][2] __attribute__((aligned(2*sizeof(float))));
 	float fConst67;
 	float fConst68;
-	float fRec5[3];
+	float fRec5[3][2] __attribute__((aligned(2*sizeof(float))));
 	float fConst70;
 	float fConst71;
-	float fVec1[2];
+	float fVec1[2][2] __attribute__((aligned(2*sizeof(float))));
 	float fConst72;
 	float fConst73;
-	float fRec4[2];
-	float fRec3[3];
+	float fRec4[2][2] __attribute__((aligned(2*sizeof(float))));
+	float fRec3[3][2] __attribute__((aligned(2*sizeof(float))));
 	float fConst74;
-	float fRec18[2];
-	float fRec16[2];
-	float fRec14[2];
-	float fRec12[2];
-	float fRec26[2];
-	float fRec24[2];
-	float fRec22[2];
-	float fRec20[2];
+	float fRec18[2][2] __attribute__((aligned(2*sizeof(float))));
+	float fRec16[2][2] __attribute__((aligned(2*sizeof(float))));
+	float fRec14[2][2] __attribute__((aligned(2*sizeof(float))));
+	float fRec12[2][2] __attribute__((aligned(2*sizeof(float))));
+	float fRec26[2][2] __attribute__((aligned(2*sizeof(float))));
+	float fRec24[2][2] __attribute__((aligned(2*sizeof(float))));
+	float fRec22[2][2] __attribute__((aligned(2*sizeof(float))));
+	float fRec20[2][2] __attribute__((aligned(2*sizeof(float))));
 	int IOTA0;
 	float *fVec2;
 	FAUSTFLOAT fHslider3;
@@ -87,31 +87,9 @@ private:
 	float fRec30[2];
 	float fRec31[2];
 	FAUSTFLOAT fVslider1;
-	float fRec0[2];
+	float fRec0[2][2] __attribute__((aligned(2*sizeof(float))));
 	FAUSTFLOAT fVslider2;
-	float fRec34[3];
-	float fRec33[3];
-	float fVec3[2];
-	float fRec43[2];
-	float fRec42[3];
-	float fRec41[3];
-	float fRec40[3];
-	float fRec39[3];
-	float fRec38[3];
-	float fRec37[3];
-	float fVec4[2];
-	float fRec36[2];
-	float fRec35[3];
-	float fRec50[2];
-	float fRec48[2];
-	float fRec46[2];
-	float fRec44[2];
-	float fRec58[2];
-	float fRec56[2];
-	float fRec54[2];
-	float fRec52[2];
 	float *fVec5;
-	float fRec32[2];
 
 	bool mem_allocated;
 	void mem_alloc();
@@ -166,56 +144,56 @@ Dsp::~Dsp() {
 
 inline void Dsp::clear_state_f()
 {
-	for (int l0 = 0; l0 < 3; l0 = l0 + 1) fRec2[l0] = 0.0f;
-	for (int l1 = 0; l1 < 3; l1 = l1 + 1) fRec1[l1] = 0.0f;
-	for (int l2 = 0; l2 < 2; l2 = l2 + 1) fVec0[l2] = 0.0f;
-	for (int l3 = 0; l3 < 2; l3 = l3 + 1) fRec11[l3] = 0.0f;
-	for (int l4 = 0; l4 < 3; l4 = l4 + 1) fRec10[l4] = 0.0f;
-	for (int l5 = 0; l5 < 3; l5 = l5 + 1) fRec9[l5] = 0.0f;
-	for (int l6 = 0; l6 < 3; l6 = l6 + 1) fRec8[l6] = 0.0f;
-	for (int l7 = 0; l7 < 3; l7 = l7 + 1) fRec7[l7] = 0.0f;
-	for (int l8 = 0; l8 < 3; l8 = l8 + 1) fRec6[l8] = 0.0f;
-	for (int l9 = 0; l9 < 3; l9 = l9 + 1) fRec5[l9] = 0.0f;
-	for (int l10 = 0; l10 < 2; l10 = l10 + 1) fVec1[l10] = 0.0f;
-	for (int l11 = 0; l11 < 2; l11 = l11 + 1) fRec4[l11] = 0.0f;
-	for (int l12 = 0; l12 < 3; l12 = l12 + 1) fRec3[l12] = 0.0f;
-	for (int l13 = 0; l13 < 2; l13 = l13 + 1) fRec18[l13] = 0.0f;
-	for (int l14 = 0; l14 < 2; l14 = l14 + 1) fRec16[l14] = 0.0f;
-	for (int l15 = 0; l15 < 2; l15 = l15 + 1) fRec14[l15] = 0.0f;
-	for (int l16 = 0; l16 < 2; l16 = l16 + 1) fRec12[l16] = 0.0f;
-	for (int l17 = 0; l17 < 2; l17 = l17 + 1) fRec26[l17] = 0.0f;
-	for (int l18 = 0; l18 < 2; l18 = l18 + 1) fRec24[l18] = 0.0f;
-	for (int l19 = 0; l19 < 2; l19 = l19 + 1) fRec22[l19] = 0.0f;
-	for (int l20 = 0; l20 < 2; l20 = l20 + 1) fRec20[l20] = 0.0f;
+	for (int l0 = 0; l0 < 3; l0 = l0 + 1) fRec2[l0][0] = 0.0f;
+	for (int l1 = 0; l1 < 3; l1 = l1 + 1) fRec1[l1][0] = 0.0f;
+	for (int l2 = 0; l2 < 2; l2 = l2 + 1) fVec0[l2][0] = 0.0f;
+	for (int l3 = 0; l3 < 2; l3 = l3 + 1) fRec11[l3][0] = 0.0f;
+	for (int l4 = 0; l4 < 3; l4 = l4 + 1) fRec10[l4][0] = 0.0f;
+	for (int l5 = 0; l5 < 3; l5 = l5 + 1) fRec9[l5][0] = 0.0f;
+	for (int l6 = 0; l6 < 3; l6 = l6 + 1) fRec8[l6][0] = 0.0f;
+	for (int l7 = 0; l7 < 3; l7 = l7 + 1) fRec7[l7][0] = 0.0f;
+	for (int l8 = 0; l8 < 3; l8 = l8 + 1) fRec6[l8][0] = 0.0f;
+	for (int l9 = 0; l9 < 3; l9 = l9 + 1) fRec5[l9][0] = 0.0f;
+	for (int l10 = 0; l10 < 2; l10 = l10 + 1) fVec1[l10][0] = 0.0f;
+	for (int l11 = 0; l11 < 2; l11 = l11 + 1) fRec4[l11][0] = 0.0f;
+	for (int l12 = 0; l12 < 3; l12 = l12 + 1) fRec3[l12][0] = 0.0f;
+	for (int l13 = 0; l13 < 2; l13 = l13 + 1) fRec18[l13][0] = 0.0f;
+	for (int l14 = 0; l14 < 2; l14 = l14 + 1) fRec16[l14][0] = 0.0f;
+	for (int l15 = 0; l15 < 2; l15 = l15 + 1) fRec14[l15][0] = 0.0f;
+	for (int l16 = 0; l16 < 2; l16 = l16 + 1) fRec12[l16][0] = 0.0f;
+	for (int l17 = 0; l17 < 2; l17 = l17 + 1) fRec26[l17][0] = 0.0f;
+	for (int l18 = 0; l18 < 2; l18 = l18 + 1) fRec24[l18][0] = 0.0f;
+	for (int l19 = 0; l19 < 2; l19 = l19 + 1) fRec22[l19][0] = 0.0f;
+	for (int l20 = 0; l20 < 2; l20 = l20 + 1) fRec20[l20][0] = 0.0f;
 	for (int l21 = 0; l21 < 1048576; l21 = l21 + 1) fVec2[l21] = 0.0f;
 	for (int l22 = 0; l22 < 2; l22 = l22 + 1) fRec28[l22] = 0.0f;
 	for (int l23 = 0; l23 < 2; l23 = l23 + 1) fRec29[l23] = 0.0f;
 	for (int l24 = 0; l24 < 2; l24 = l24 + 1) fRec30[l24] = 0.0f;
 	for (int l25 = 0; l25 < 2; l25 = l25 + 1) fRec31[l25] = 0.0f;
-	for (int l26 = 0; l26 < 2; l26 = l26 + 1) fRec0[l26] = 0.0f;
-	for (int l27 = 0; l27 < 3; l27 = l27 + 1) fRec34[l27] = 0.0f;
-	for (int l28 = 0; l28 < 3; l28 = l28 + 1) fRec33[l28] = 0.0f;
-	for (int l29 = 0; l29 < 2; l29 = l29 + 1) fVec3[l29] = 0.0f;
-	for (int l30 = 0; l30 < 2; l30 = l30 + 1) fRec43[l30] = 0.0f;
-	for (int l31 = 0; l31 < 3; l31 = l31 + 1) fRec42[l31] = 0.0f;
-	for (int l32 = 0; l32 < 3; l32 = l32 + 1) fRec41[l32] = 0.0f;
-	for (int l33 = 0; l33 < 3; l33 = l33 + 1) fRec40[l33] = 0.0f;
-	for (int l34 = 0; l34 < 3; l34 = l34 + 1) fRec39[l34] = 0.0f;
-	for (int l35 = 0; l35 < 3; l35 = l35 + 1) fRec38[l35] = 0.0f;
-	for (int l36 = 0; l36 < 3; l36 = l36 + 1) fRec37[l36] = 0.0f;
-	for (int l37 = 0; l37 < 2; l37 = l37 + 1) fVec4[l37] = 0.0f;
-	for (int l38 = 0; l38 < 2; l38 = l38 + 1) fRec36[l38] = 0.0f;
-	for (int l39 = 0; l39 < 3; l39 = l39 + 1) fRec35[l39] = 0.0f;
-	for (int l40 = 0; l40 < 2; l40 = l40 + 1) fRec50[l40] = 0.0f;
-	for (int l41 = 0; l41 < 2; l41 = l41 + 1) fRec48[l41] = 0.0f;
-	for (int l42 = 0; l42 < 2; l42 = l42 + 1) fRec46[l42] = 0.0f;
-	for (int l43 = 0; l43 < 2; l43 = l43 + 1) fRec44[l43] = 0.0f;
-	for (int l44 = 0; l44 < 2; l44 = l44 + 1) fRec58[l44] = 0.0f;
-	for (int l45 = 0; l45 < 2; l45 = l45 + 1) fRec56[l45] = 0.0f;
-	for (int l46 = 0; l46 < 2; l46 = l46 + 1) fRec54[l46] = 0.0f;
-	for (int l47 = 0; l47 < 2; l47 = l47 + 1) fRec52[l47] = 0.0f;
+	for (int l26 = 0; l26 < 2; l26 = l26 + 1) fRec0[l26][0] = 0.0f;
+	for (int l27 = 0; l27 < 3; l27 = l27 + 1) fRec2[l27][1] = 0.0f;
+	for (int l28 = 0; l28 < 3; l28 = l28 + 1) fRec1[l28][1] = 0.0f;
+	for (int l29 = 0; l29 < 2; l29 = l29 + 1) fVec0[l29][1] = 0.0f;
+	for (int l30 = 0; l30 < 2; l30 = l30 + 1) fRec11[l30][1] = 0.0f;
+	for (int l31 = 0; l31 < 3; l31 = l31 + 1) fRec10[l31][1] = 0.0f;
+	for (int l32 = 0; l32 < 3; l32 = l32 + 1) fRec9[l32][1] = 0.0f;
+	for (int l33 = 0; l33 < 3; l33 = l33 + 1) fRec8[l33][1] = 0.0f;
+	for (int l34 = 0; l34 < 3; l34 = l34 + 1) fRec7[l34][1] = 0.0f;
+	for (int l35 = 0; l35 < 3; l35 = l35 + 1) fRec6[l35][1] = 0.0f;
+	for (int l36 = 0; l36 < 3; l36 = l36 + 1) fRec5[l36][1] = 0.0f;
+	for (int l37 = 0; l37 < 2; l37 = l37 + 1) fVec1[l37][1] = 0.0f;
+	for (int l38 = 0; l38 < 2; l38 = l38 + 1) fRec4[l38][1] = 0.0f;
+	for (int l39 = 0; l39 < 3; l39 = l39 + 1) fRec3[l39][1] = 0.0f;
+	for (int l40 = 0; l40 < 2; l40 = l40 + 1) fRec18[l40][1] = 0.0f;
+	for (int l41 = 0; l41 < 2; l41 = l41 + 1) fRec16[l41][1] = 0.0f;
+	for (int l42 = 0; l42 < 2; l42 = l42 + 1) fRec14[l42][1] = 0.0f;
+	for (int l43 = 0; l43 < 2; l43 = l43 + 1) fRec12[l43][1] = 0.0f;
+	for (int l44 = 0; l44 < 2; l44 = l44 + 1) fRec26[l44][1] = 0.0f;
+	for (int l45 = 0; l45 < 2; l45 = l45 + 1) fRec24[l45][1] = 0.0f;
+	for (int l46 = 0; l46 < 2; l46 = l46 + 1) fRec22[l46][1] = 0.0f;
+	for (int l47 = 0; l47 < 2; l47 = l47 + 1) fRec20[l47][1] = 0.0f;
 	for (int l48 = 0; l48 < 1048576; l48 = l48 + 1) fVec5[l48] = 0.0f;
-	for (int l49 = 0; l49 < 2; l49 = l49 + 1) fRec32[l49] = 0.0f;
+	for (int l49 = 0; l49 < 2; l49 = l49 + 1) fRec0[l49][1] = 0.0f;
 }
 
 void Dsp::clear_state_f_static(PluginDef *p)
@@ -314,16 +292,16 @@ void Dsp::init_static(unsigned int sample_rate, PluginDef *p)
 
 void Dsp::mem_alloc()
 {
-	if (!fVec2) fVec2 = new float[1048576];
-	if (!fVec5) fVec5 = new float[1048576];
+	if (!fVec2) fVec2 = rt_alloc<float>(1048576);
+	if (!fVec5) fVec5 = rt_alloc<float>(1048576);
 	mem_allocated = true;
 }
 
 void Dsp::mem_free()
 {
 	mem_allocated = false;
-	if (fVec2) { delete fVec2; fVec2 = 0; }
-	if (fVec5) { delete fVec5; fVec5 = 0; }
+	if (fVec2) { rt_free(fVec2); fVec2 = 0; }
+	if (fVec5) { rt_free(fVec5); fVec5 = 0; }
 }
 
 int Dsp::activate(bool start)
@@ -380,56 +358,107 @@ void always_inline Dsp::compute(int count, FAUSTFLOAT *input0, FAUSTFLOAT *input
 	float fSlow31 = 0.01f * float(fVslider2);
 	for (int i0 = 0; i0 < count; i0 = i0 + 1) {
 		float fTemp0 = float(input0[i0]);
-		fRec2[0] = fSlow26 * fRec0[1] - fSlow25 * (fSlow24 * fRec2[2] + fSlow22 * fRec2[1]);
-		fRec1[0] = fSlow25 * (fSlow21 * fRec2[0] + fSlow27 * fRec2[1] + fSlow21 * fRec2[2]) - fSlow18 * (fSlow16 * fRec1[2] + fSlow14 * fRec1[1]);
-		float fTemp1 = fRec1[2] + fRec1[0] + 2.0f * fRec1[1];
+		float fTemp26 = float(input1[i0]);
+		fRec2[0][0] = fSlow26 * fRec0[1][0] - fSlow25 * (fSlow24 * fRec2[2][0] + fSlow22 * fRec2[1][0]);
+		fRec2[0][1] = fSlow26 * fRec0[1][1] - fSlow25 * (fSlow24 * fRec2[2][1] + fSlow22 * fRec2[1][1]);
+		fRec1[0][0] = fSlow25 * (fSlow21 * fRec2[0][0] + fSlow27 * fRec2[1][0] + fSlow21 * fRec2[2][0]) - fSlow18 * (fSlow16 * fRec1[2][0] + fSlow14 * fRec1[1][0]);
+		fRec1[0][1] = fSlow25 * (fSlow21 * fRec2[0][1] + fSlow27 * fRec2[1][1] + fSlow21 * fRec2[2][1]) - fSlow18 * (fSlow16 * fRec1[2][1] + fSlow14 * fRec1[1][1]);
+		float fTemp1 = fRec1[2][0] + fRec1[0][0] + 2.0f * fRec1[1][0];
+		float fTemp27 = fRec1[2][1] + fRec1[0][1] + 2.0f * fRec1[1][1];
 		float fTemp2 = fSlow18 * fTemp1;
-		fVec0[0] = fTemp2;
-		float fTemp3 = fConst10 * fRec5[1];
-		float fTemp4 = fConst18 * fRec6[1];
-		float fTemp5 = fConst25 * fRec7[1];
-		float fTemp6 = fConst32 * fRec8[1];
-		float fTemp7 = fConst39 * fRec9[1];
-		fRec11[0] = fConst55 * fVec0[1] - fConst54 * (fConst52 * fRec11[1] - fSlow28 * fTemp1);
-		fRec10[0] = fRec11[0] - fConst51 * (fConst50 * fRec10[2] + fConst48 * fRec10[1]);
-		fRec9[0] = fConst51 * (fConst47 * fRec10[0] + fConst56 * fRec10[1] + fConst47 * fRec10[2]) - fConst44 * (fConst43 * fRec9[2] + fTemp7);
-		fRec8[0] = fConst44 * (fTemp7 + fConst59 * fRec9[0] + fConst58 * fRec9[2]) - fConst37 * (fConst36 * fRec8[2] + fTemp6);
-		fRec7[0] = fConst37 * (fTemp6 + fConst62 * fRec8[0] + fConst61 * fRec8[2]) - fConst30 * (fConst29 * fRec7[2] + fTemp5);
-		fRec6[0] = fConst30 * (fTemp5 + fConst65 * fRec7[0] + fConst64 * fRec7[2]) - fConst23 * (fConst22 * fRec6[2] + fTemp4);
-		fRec5[0] = fConst23 * (fTemp4 + fConst68 * fRec6[0] + fConst67 * fRec6[2]) - fConst15 * (fConst14 * fRec5[2] + fTemp3);
-		float fTemp8 = fTemp3 + fConst71 * fRec5[0] + fConst70 * fRec5[2];
-		fVec1[0] = fTemp8;
-		fRec4[0] = 0.0f - fConst73 * (fConst72 * fRec4[1] - fConst15 * (fTemp8 + fVec1[1]));
-		fRec3[0] = fRec4[0] - fConst7 * (fConst5 * fRec3[2] + fConst3 * fRec3[1]);
-		float fTemp9 = ((iSlow11) ? fTemp2 : ((iSlow12) ? fConst74 * (fRec3[2] + fRec3[0] + 2.0f * fRec3[1]) : fTemp2));
-		float fTemp10 = 0.1f * fRec12[1];
-		float fTemp11 = 0.4f * fRec16[1] + fTemp10;
-		float fTemp12 = 0.2f * fRec14[1];
-		float fTemp13 = fTemp12 + fTemp9 + 0.6f * fRec18[1] - fTemp11;
-		fRec18[0] = fTemp13;
+		float fTemp28 = fSlow18 * fTemp27;
+		fVec0[0][0] = fTemp2;
+		fVec0[0][1] = fTemp28;
+		float fTemp3 = fConst10 * fRec5[1][0];
+		float fTemp29 = fConst10 * fRec5[1][1];
+		float fTemp4 = fConst18 * fRec6[1][0];
+		float fTemp30 = fConst18 * fRec6[1][1];
+		float fTemp5 = fConst25 * fRec7[1][0];
+		float fTemp31 = fConst25 * fRec7[1][1];
+		float fTemp6 = fConst32 * fRec8[1][0];
+		float fTemp32 = fConst32 * fRec8[1][1];
+		float fTemp7 = fConst39 * fRec9[1][0];
+		float fTemp33 = fConst39 * fRec9[1][1];
+		fRec11[0][0] = fConst55 * fVec0[1][0] - fConst54 * (fConst52 * fRec11[1][0] - fSlow28 * fTemp1);
+		fRec11[0][1] = fConst55 * fVec0[1][1] - fConst54 * (fConst52 * fRec11[1][1] - fSlow28 * fTemp27);
+		fRec10[0][0] = fRec11[0][0] - fConst51 * (fConst50 * fRec10[2][0] + fConst48 * fRec10[1][0]);
+		fRec10[0][1] = fRec11[0][1] - fConst51 * (fConst50 * fRec10[2][1] + fConst48 * fRec10[1][1]);
+		fRec9[0][0] = fConst51 * (fConst47 * fRec10[0][0] + fConst56 * fRec10[1][0] + fConst47 * fRec10[2][0]) - fConst44 * (fConst43 * fRec9[2][0] + fTemp7);
+		fRec9[0][1] = fConst51 * (fConst47 * fRec10[0][1] + fConst56 * fRec10[1][1] + fConst47 * fRec10[2][1]) - fConst44 * (fConst43 * fRec9[2][1] + fTemp33);
+		fRec8[0][0] = fConst44 * (fTemp7 + fConst59 * fRec9[0][0] + fConst58 * fRec9[2][0]) - fConst37 * (fConst36 * fRec8[2][0] + fTemp6);
+		fRec8[0][1] = fConst44 * (fTemp33 + fConst59 * fRec9[0][1] + fConst58 * fRec9[2][1]) - fConst37 * (fConst36 * fRec8[2][1] + fTemp32);
+		fRec7[0][0] = fConst37 * (fTemp6 + fConst62 * fRec8[0][0] + fConst61 * fRec8[2][0]) - fConst30 * (fConst29 * fRec7[2][0] + fTemp5);
+		fRec7[0][1] = fConst37 * (fTemp32 + fConst62 * fRec8[0][1] + fConst61 * fRec8[2][1]) - fConst30 * (fConst29 * fRec7[2][1] + fTemp31);
+		fRec6[0][0] = fConst30 * (fTemp5 + fConst65 * fRec7[0][0] + fConst64 * fRec7[2][0]) - fConst23 * (fConst22 * fRec6[2][0] + fTemp4);
+		fRec6[0][1] = fConst30 * (fTemp31 + fConst65 * fRec7[0][1] + fConst64 * fRec7[2][1]) - fConst23 * (fConst22 * fRec6[2][1] + fTemp30);
+		fRec5[0][0] = fConst23 * (fTemp4 + fConst68 * fRec6[0][0] + fConst67 * fRec6[2][0]) - fConst15 * (fConst14 * fRec5[2][0] + fTemp3);
+		fRec5[0][1] = fConst23 * (fTemp30 + fConst68 * fRec6[0][1] + fConst67 * fRec6[2][1]) - fConst15 * (fConst14 * fRec5[2][1] + fTemp29);
+		float fTemp8 = fTemp3 + fConst71 * fRec5[0][0] + fConst70 * fRec5[2][0];
+		float fTemp34 = fTemp29 + fConst71 * fRec5[0][1] + fConst70 * fRec5[2][1];
+		fVec1[0][0] = fTemp8;
+		fVec1[0][1] = fTemp34;
+		fRec4[0][0] = 0.0f - fConst73 * (fConst72 * fRec4[1][0] - fConst15 * (fTemp8 + fVec1[1][0]));
+		fRec4[0][1] = 0.0f - fConst73 * (fConst72 * fRec4[1][1] - fConst15 * (fTemp34 + fVec1[1][1]));
+		fRec3[0][0] = fRec4[0][0] - fConst7 * (fConst5 * fRec3[2][0] + fConst3 * fRec3[1][0]);
+		fRec3[0][1] = fRec4[0][1] - fConst7 * (fConst5 * fRec3[2][1] + fConst3 * fRec3[1][1]);
+		float fTemp9 = ((iSlow11) ? fTemp2 : ((iSlow12) ? fConst74 * (fRec3[2][0] + fRec3[0][0] + 2.0f * fRec3[1][0]) : fTemp2));
+		float fTemp35 = ((iSlow11) ? fTemp28 : ((iSlow12) ? fConst74 * (fRec3[2][1] + fRec3[0][1] + 2.0f * fRec3[1][1]) : fTemp28));
+		float fTemp10 = 0.1f * fRec12[1][0];
+		float fTemp36 = 0.1f * fRec12[1][1];
+		float fTemp11 = 0.4f * fRec16[1][0] + fTemp10;
+		float fTemp37 = 0.4f * fRec16[1][1] + fTemp36;
+		float fTemp12 = 0.2f * fRec14[1][0];
+		float fTemp38 = 0.2f * fRec14[1][1];
+		float fTemp13 = fTemp12 + fTemp9 + 0.6f * fRec18[1][0] - fTemp11;
+		float fTemp39 = fTemp38 + fTemp35 + 0.6f * fRec18[1][1] - fTemp37;
+		fRec18[0][0] = fTemp13;
+		fRec18[0][1] = fTemp39;
 		float fRec19 = 0.0f - 0.6f * fTemp13;
-		fRec16[0] = fRec19 + fRec18[1];
+		float fRec51 = 0.0f - 0.6f * fTemp39;
+		fRec16[0][0] = fRec19 + fRec18[1][0];
+		fRec16[0][1] = fRec51 + fRec18[1][1];
 		float fTemp14 = fTemp9 + fTemp12;
+		float fTemp40 = fTemp35 + fTemp38;
 		float fRec17 = 0.4f * (fTemp14 - fTemp11);
-		fRec14[0] = fRec17 + fRec16[1];
+		float fRec49 = 0.4f * (fTemp40 - fTemp37);
+		fRec14[0][0] = fRec17 + fRec16[1][0];
+		fRec14[0][1] = fRec49 + fRec16[1][1];
 		float fRec15 = 0.0f - 0.2f * (fTemp14 - fTemp10);
-		fRec12[0] = fRec15 + fRec14[1];
+		float fRec47 = 0.0f - 0.2f * (fTemp40 - fTemp36);
+		fRec12[0][0] = fRec15 + fRec14[1][0];
+		fRec12[0][1] = fRec47 + fRec14[1][1];
 		float fRec13 = 0.1f * (fTemp9 - fTemp10);
-		float fTemp15 = ((iSlow8) ? fTemp9 : ((iSlow9) ? fRec13 + fRec12[1] : fTemp9));
-		float fTemp16 = 0.5f * fRec20[1];
-		float fTemp17 = 0.4f * fRec22[1] + fTemp16;
-		float fTemp18 = 0.3f * fRec24[1];
-		float fTemp19 = fTemp18 + fTemp15 + 0.2f * fRec26[1] - fTemp17;
-		fRec26[0] = fTemp19;
+		float fRec45 = 0.1f * (fTemp35 - fTemp36);
+		float fTemp15 = ((iSlow8) ? fTemp9 : ((iSlow9) ? fRec13 + fRec12[1][0] : fTemp9));
+		float fTemp41 = ((iSlow8) ? fTemp35 : ((iSlow9) ? fRec45 + fRec12[1][1] : fTemp35));
+		float fTemp16 = 0.5f * fRec20[1][0];
+		float fTemp42 = 0.5f * fRec20[1][1];
+		float fTemp17 = 0.4f * fRec22[1][0] + fTemp16;
+		float fTemp43 = 0.4f * fRec22[1][1] + fTemp42;
+		float fTemp18 = 0.3f * fRec24[1][0];
+		float fTemp44 = 0.3f * fRec24[1][1];
+		float fTemp19 = fTemp18 + fTemp15 + 0.2f * fRec26[1][0] - fTemp17;
+		float fTemp45 = fTemp44 + fTemp41 + 0.2f * fRec26[1][1] - fTemp43;
+		fRec26[0][0] = fTemp19;
+		fRec26[0][1] = fTemp45;
 		float fRec27 = 0.0f - 0.2f * fTemp19;
-		fRec24[0] = fRec27 + fRec26[1];
+		float fRec59 = 0.0f - 0.2f * fTemp45;
+		fRec24[0][0] = fRec27 + fRec26[1][0];
+		fRec24[0][1] = fRec59 + fRec26[1][1];
 		float fRec25 = 0.0f - 0.3f * (fTemp15 + fTemp18 - fTemp17);
-		fRec22[0] = fRec25 + fRec24[1];
+		float fRec57 = 0.0f - 0.3f * (fTemp41 + fTemp44 - fTemp43);
+		fRec22[0][0] = fRec25 + fRec24[1][0];
+		fRec22[0][1] = fRec57 + fRec24[1][1];
 		float fRec23 = 0.4f * (fTemp15 - fTemp17);
-		fRec20[0] = fRec23 + fRec22[1];
+		float fRec55 = 0.4f * (fTemp41 - fTemp43);
+		fRec20[0][0] = fRec23 + fRec22[1][0];
+		fRec20[0][1] = fRec55 + fRec22[1][1];
 		float fRec21 = 0.5f * (fTemp15 - fTemp16);
-		float fTemp20 = ((iSlow1) ? fRec0[1] : ((iSlow5) ? fTemp15 : ((iSlow6) ? fRec21 + fRec20[1] : fTemp15))) + fSlow2 * fTemp0;
+		float fRec53 = 0.5f * (fTemp41 - fTemp42);
+		float fTemp20 = ((iSlow1) ? fRec0[1][0] : ((iSlow5) ? fTemp15 : ((iSlow6) ? fRec21 + fRec20[1][0] : fTemp15))) + fSlow2 * fTemp0;
+		float fTemp46 = ((iSlow1) ? fRec0[1][1] : ((iSlow5) ? fTemp41 : ((iSlow6) ? fRec53 + fRec20[1][1] : fTemp41))) + fSlow2 * fTemp26;
 		fVec2[IOTA0 & 1048575] = fTemp20;
+		fVec5[IOTA0 & 1048575] = fTemp46;
 		float fTemp21 = ((fRec28[1] != 0.0f) ? (((fRec29[1] > 0.0f) & (fRec29[1] < 1.0f)) ? fRec28[1] : 0.0f) : (((fRec29[1] == 0.0f) & (fSlow29 != fRec30[1])) ? fConst76 : (((fRec29[1] == 1.0f) & (fSlow29 != fRec31[1])) ? fConst77 : 0.0f)));
 		fRec28[0] = fTemp21;
 		fRec29[0] = std::max<float>(0.0f, std::min<float>(1.0f, fRec29[1] + fTemp21));
@@ -437,132 +466,81 @@ void always_inline Dsp::compute(int count, FAUSTFLOAT *input0, FAUSTFLOAT *input
 		fRec31[0] = (((fRec29[1] <= 0.0f) & (fRec30[1] != fSlow29)) ? fSlow29 : fRec31[1]);
 		int iTemp22 = int(std::min<float>(524288.0f, std::max<float>(0.0f, fRec30[0])));
 		float fTemp23 = fVec2[(IOTA0 - iTemp22) & 1048575];
+		float fTemp47 = fVec5[(IOTA0 - iTemp22) & 1048575];
 		int iTemp24 = int(std::min<float>(524288.0f, std::max<float>(0.0f, fRec31[0])));
 		float fTemp25 = fTemp23 + fRec29[0] * (fVec2[(IOTA0 - iTemp24) & 1048575] - fTemp23);
-		fRec0[0] = ((iSlow1) ? fTemp25 : fSlow30 * fTemp25);
-		output0[i0] = FAUSTFLOAT(fTemp0 + fSlow31 * fRec0[0]);
-		float fTemp26 = float(input1[i0]);
-		fRec34[0] = fSlow26 * fRec32[1] - fSlow25 * (fSlow24 * fRec34[2] + fSlow22 * fRec34[1]);
-		fRec33[0] = fSlow25 * (fSlow21 * fRec34[0] + fSlow27 * fRec34[1] + fSlow21 * fRec34[2]) - fSlow18 * (fSlow16 * fRec33[2] + fSlow14 * fRec33[1]);
-		float fTemp27 = fRec33[2] + fRec33[0] + 2.0f * fRec33[1];
-		float fTemp28 = fSlow18 * fTemp27;
-		fVec3[0] = fTemp28;
-		float fTemp29 = fConst10 * fRec37[1];
-		float fTemp30 = fConst18 * fRec38[1];
-		float fTemp31 = fConst25 * fRec39[1];
-		float fTemp32 = fConst32 * fRec40[1];
-		float fTemp33 = fConst39 * fRec41[1];
-		fRec43[0] = fConst55 * fVec3[1] - fConst54 * (fConst52 * fRec43[1] - fSlow28 * fTemp27);
-		fRec42[0] = fRec43[0] - fConst51 * (fConst50 * fRec42[2] + fConst48 * fRec42[1]);
-		fRec41[0] = fConst51 * (fConst47 * fRec42[0] + fConst56 * fRec42[1] + fConst47 * fRec42[2]) - fConst44 * (fConst43 * fRec41[2] + fTemp33);
-		fRec40[0] = fConst44 * (fTemp33 + fConst59 * fRec41[0] + fConst58 * fRec41[2]) - fConst37 * (fConst36 * fRec40[2] + fTemp32);
-		fRec39[0] = fConst37 * (fTemp32 + fConst62 * fRec40[0] + fConst61 * fRec40[2]) - fConst30 * (fConst29 * fRec39[2] + fTemp31);
-		fRec38[0] = fConst30 * (fTemp31 + fConst65 * fRec39[0] + fConst64 * fRec39[2]) - fConst23 * (fConst22 * fRec38[2] + fTemp30);
-		fRec37[0] = fConst23 * (fTemp30 + fConst68 * fRec38[0] + fConst67 * fRec38[2]) - fConst15 * (fConst14 * fRec37[2] + fTemp29);
-		float fTemp34 = fTemp29 + fConst71 * fRec37[0] + fConst70 * fRec37[2];
-		fVec4[0] = fTemp34;
-		fRec36[0] = 0.0f - fConst73 * (fConst72 * fRec36[1] - fConst15 * (fTemp34 + fVec4[1]));
-		fRec35[0] = fRec36[0] - fConst7 * (fConst5 * fRec35[2] + fConst3 * fRec35[1]);
-		float fTemp35 = ((iSlow11) ? fTemp28 : ((iSlow12) ? fConst74 * (fRec35[2] + fRec35[0] + 2.0f * fRec35[1]) : fTemp28));
-		float fTemp36 = 0.1f * fRec44[1];
-		float fTemp37 = 0.4f * fRec48[1] + fTemp36;
-		float fTemp38 = 0.2f * fRec46[1];
-		float fTemp39 = fTemp38 + fTemp35 + 0.6f * fRec50[1] - fTemp37;
-		fRec50[0] = fTemp39;
-		float fRec51 = 0.0f - 0.6f * fTemp39;
-		fRec48[0] = fRec51 + fRec50[1];
-		float fTemp40 = fTemp35 + fTemp38;
-		float fRec49 = 0.4f * (fTemp40 - fTemp37);
-		fRec46[0] = fRec49 + fRec48[1];
-		float fRec47 = 0.0f - 0.2f * (fTemp40 - fTemp36);
-		fRec44[0] = fRec47 + fRec46[1];
-		float fRec45 = 0.1f * (fTemp35 - fTemp36);
-		float fTemp41 = ((iSlow8) ? fTemp35 : ((iSlow9) ? fRec45 + fRec44[1] : fTemp35));
-		float fTemp42 = 0.5f * fRec52[1];
-		float fTemp43 = 0.4f * fRec54[1] + fTemp42;
-		float fTemp44 = 0.3f * fRec56[1];
-		float fTemp45 = fTemp44 + fTemp41 + 0.2f * fRec58[1] - fTemp43;
-		fRec58[0] = fTemp45;
-		float fRec59 = 0.0f - 0.2f * fTemp45;
-		fRec56[0] = fRec59 + fRec58[1];
-		float fRec57 = 0.0f - 0.3f * (fTemp41 + fTemp44 - fTemp43);
-		fRec54[0] = fRec57 + fRec56[1];
-		float fRec55 = 0.4f * (fTemp41 - fTemp43);
-		fRec52[0] = fRec55 + fRec54[1];
-		float fRec53 = 0.5f * (fTemp41 - fTemp42);
-		float fTemp46 = ((iSlow1) ? fRec32[1] : ((iSlow5) ? fTemp41 : ((iSlow6) ? fRec53 + fRec52[1] : fTemp41))) + fSlow2 * fTemp26;
-		fVec5[IOTA0 & 1048575] = fTemp46;
-		float fTemp47 = fVec5[(IOTA0 - iTemp22) & 1048575];
 		float fTemp48 = fTemp47 + fRec29[0] * (fVec5[(IOTA0 - iTemp24) & 1048575] - fTemp47);
-		fRec32[0] = ((iSlow1) ? fTemp48 : fSlow30 * fTemp48);
-		output1[i0] = FAUSTFLOAT(fTemp26 + fSlow31 * fRec32[0]);
-		fRec2[2] = fRec2[1];
-		fRec2[1] = fRec2[0];
-		fRec1[2] = fRec1[1];
-		fRec1[1] = fRec1[0];
-		fVec0[1] = fVec0[0];
-		fRec11[1] = fRec11[0];
-		fRec10[2] = fRec10[1];
-		fRec10[1] = fRec10[0];
-		fRec9[2] = fRec9[1];
-		fRec9[1] = fRec9[0];
-		fRec8[2] = fRec8[1];
-		fRec8[1] = fRec8[0];
-		fRec7[2] = fRec7[1];
-		fRec7[1] = fRec7[0];
-		fRec6[2] = fRec6[1];
-		fRec6[1] = fRec6[0];
-		fRec5[2] = fRec5[1];
-		fRec5[1] = fRec5[0];
-		fVec1[1] = fVec1[0];
-		fRec4[1] = fRec4[0];
-		fRec3[2] = fRec3[1];
-		fRec3[1] = fRec3[0];
-		fRec18[1] = fRec18[0];
-		fRec16[1] = fRec16[0];
-		fRec14[1] = fRec14[0];
-		fRec12[1] = fRec12[0];
-		fRec26[1] = fRec26[0];
-		fRec24[1] = fRec24[0];
-		fRec22[1] = fRec22[0];
-		fRec20[1] = fRec20[0];
+		fRec0[0][0] = ((iSlow1) ? fTemp25 : fSlow30 * fTemp25);
+		fRec0[0][1] = ((iSlow1) ? fTemp48 : fSlow30 * fTemp48);
+		output0[i0] = FAUSTFLOAT(fTemp0 + fSlow31 * fRec0[0][0]);
+		output1[i0] = FAUSTFLOAT(fTemp26 + fSlow31 * fRec0[0][1]);
+		fRec2[2][0] = fRec2[1][0];
+		fRec2[2][1] = fRec2[1][1];
+		fRec2[1][0] = fRec2[0][0];
+		fRec2[1][1] = fRec2[0][1];
+		fRec1[2][0] = fRec1[1][0];
+		fRec1[2][1] = fRec1[1][1];
+		fRec1[1][0] = fRec1[0][0];
+		fRec1[1][1] = fRec1[0][1];
+		fVec0[1][0] = fVec0[0][0];
+		fVec0[1][1] = fVec0[0][1];
+		fRec11[1][0] = fRec11[0][0];
+		fRec11[1][1] = fRec11[0][1];
+		fRec10[2][0] = fRec10[1][0];
+		fRec10[2][1] = fRec10[1][1];
+		fRec10[1][0] = fRec10[0][0];
+		fRec10[1][1] = fRec10[0][1];
+		fRec9[2][0] = fRec9[1][0];
+		fRec9[2][1] = fRec9[1][1];
+		fRec9[1][0] = fRec9[0][0];
+		fRec9[1][1] = fRec9[0][1];
+		fRec8[2][0] = fRec8[1][0];
+		fRec8[2][1] = fRec8[1][1];
+		fRec8[1][0] = fRec8[0][0];
+		fRec8[1][1] = fRec8[0][1];
+		fRec7[2][0] = fRec7[1][0];
+		fRec7[2][1] = fRec7[1][1];
+		fRec7[1][0] = fRec7[0][0];
+		fRec7[1][1] = fRec7[0][1];
+		fRec6[2][0] = fRec6[1][0];
+		fRec6[2][1] = fRec6[1][1];
+		fRec6[1][0] = fRec6[0][0];
+		fRec6[1][1] = fRec6[0][1];
+		fRec5[2][0] = fRec5[1][0];
+		fRec5[2][1] = fRec5[1][1];
+		fRec5[1][0] = fRec5[0][0];
+		fRec5[1][1] = fRec5[0][1];
+		fVec1[1][0] = fVec1[0][0];
+		fVec1[1][1] = fVec1[0][1];
+		fRec4[1][0] = fRec4[0][0];
+		fRec4[1][1] = fRec4[0][1];
+		fRec3[2][0] = fRec3[1][0];
+		fRec3[2][1] = fRec3[1][1];
+		fRec3[1][0] = fRec3[0][0];
+		fRec3[1][1] = fRec3[0][1];
+		fRec18[1][0] = fRec18[0][0];
+		fRec18[1][1] = fRec18[0][1];
+		fRec16[1][0] = fRec16[0][0];
+		fRec16[1][1] = fRec16[0][1];
+		fRec14[1][0] = fRec14[0][0];
+		fRec14[1][1] = fRec14[0][1];
+		fRec12[1][0] = fRec12[0][0];
+		fRec12[1][1] = fRec12[0][1];
+		fRec26[1][0] = fRec26[0][0];
+		fRec26[1][1] = fRec26[0][1];
+		fRec24[1][0] = fRec24[0][0];
+		fRec24[1][1] = fRec24[0][1];
+		fRec22[1][0] = fRec22[0][0];
+		fRec22[1][1] = fRec22[0][1];
+		fRec20[1][0] = fRec20[0][0];
+		fRec20[1][1] = fRec20[0][1];
 		IOTA0 = IOTA0 + 1;
 		fRec28[1] = fRec28[0];
 		fRec29[1] = fRec29[0];
 		fRec30[1] = fRec30[0];
 		fRec31[1] = fRec31[0];
-		fRec0[1] = fRec0[0];
-		fRec34[2] = fRec34[1];
-		fRec34[1] = fRec34[0];
-		fRec33[2] = fRec33[1];
-		fRec33[1] = fRec33[0];
-		fVec3[1] = fVec3[0];
-		fRec43[1] = fRec43[0];
-		fRec42[2] = fRec42[1];
-		fRec42[1] = fRec42[0];
-		fRec41[2] = fRec41[1];
-		fRec41[1] = fRec41[0];
-		fRec40[2] = fRec40[1];
-		fRec40[1] = fRec40[0];
-		fRec39[2] = fRec39[1];
-		fRec39[1] = fRec39[0];
-		fRec38[2] = fRec38[1];
-		fRec38[1] = fRec38[0];
-		fRec37[2] = fRec37[1];
-		fRec37[1] = fRec37[0];
-		fVec4[1] = fVec4[0];
-		fRec36[1] = fRec36[0];
-		fRec35[2] = fRec35[1];
-		fRec35[1] = fRec35[0];
-		fRec50[1] = fRec50[0];
-		fRec48[1] = fRec48[0];
-		fRec46[1] = fRec46[0];
-		fRec44[1] = fRec44[0];
-		fRec58[1] = fRec58[0];
-		fRec56[1] = fRec56[0];
-		fRec54[1] = fRec54[0];
-		fRec52[1] = fRec52[0];
-		fRec32[1] = fRec32[0];
+		fRec0[1][0] = fRec0[0][0];
+		fRec0[1][1] = fRec0[0][1];
 	}
 }
 
@@ -102,14 +102,14 @@ void Dsp::init_static(unsigned int sample_rate, PluginDef *p)
 
 void Dsp::mem_alloc()
 {
-	if (!fRec0) fRec0 = new float[1048576];
+	if (!fRec0) fRec0 = rt_alloc<float>(1048576);
 	mem_allocated = true;
 }
 
 void Dsp::mem_free()
 {
 	mem_allocated = false;
-	if (fRec0) { delete fRec0; fRec0 = 0; }
+	if (fRec0) { rt_free(fRec0); fRec0 = 0; }
 }
 
 int Dsp::activate(bool start)
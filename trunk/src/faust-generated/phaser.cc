@@ -13,8 +13,7 @@ private:
 	int iVec0[2];
 	FAUSTFLOAT fHslider1;
 	float fConst1;
-	float fRec2[2];
-	float fRec3[2];
+	float fRec2[2][2] __attribute__((aligned(2*sizeof(float))));
 	FAUSTFLOAT fHslider2;
 	FAUSTFLOAT fHslider3;
 	float fConst2;
@@ -23,16 +22,11 @@ private:
 	float fConst3;
 	FAUSTFLOAT fHslider6;
 	FAUSTFLOAT fHslider7;
-	float fRec6[3];
-	float fRec5[3];
-	float fRec4[3];
-	float fRec1[3];
-	float fRec0[2];
-	float fRec11[3];
-	float fRec10[3];
-	float fRec9[3];
-	float fRec8[3];
-	float fRec7[2];
+	float fRec6[3][2] __attribute__((aligned(2*sizeof(float))));
+	float fRec5[3][2] __attribute__((aligned(2*sizeof(float))));
+	float fRec4[3][2] __attribute__((aligned(2*sizeof(float))));
+	float fRec1[3][2] __attribute__((aligned(2*sizeof(float))));
+	float fRec0[2][2] __attribute__((aligned(2*sizeof(float))));
 
 	void clear_state_f();
 	int load_ui_f(const UiBuilder& b, int form);
@@ -80,18 +74,18 @@ Dsp::~Dsp() {
 inline void Dsp::clear_state_f()
 {
 	for (int l0 = 0; l0 < 2; l0 = l0 + 1) iVec0[l0] = 0;
-	for (int l1 = 0; l1 < 2; l1 = l1 + 1) fRec2[l1] = 0.0f;
-	for (int l2 = 0; l2 < 2; l2 = l2 + 1) fRec3[l2] = 0.0f;
-	for (int l3 = 0; l3 < 3; l3 = l3 + 1) fRec6[l3] = 0.0f;
-	for (int l4 = 0; l4 < 3; l4 = l4 + 1) fRec5[l4] = 0.0f;
-	for (int l5 = 0; l5 < 3; l5 = l5 + 1) fRec4[l5] = 0.0f;
-	for (int l6 = 0; l6 < 3; l6 = l6 + 1) fRec1[l6] = 0.0f;
-	for (int l7 = 0; l7 < 2; l7 = l7 + 1) fRec0[l7] = 0.0f;
-	for (int l8 = 0; l8 < 3; l8 = l8 + 1) fRec11[l8] = 0.0f;
-	for (int l9 = 0; l9 < 3; l9 = l9 + 1) fRec10[l9] = 0.0f;
-	for (int l10 = 0; l10 < 3; l10 = l10 + 1) fRec9[l10] = 0.0f;
-	for (int l11 = 0; l11 < 3; l11 = l11 + 1) fRec8[l11] = 0.0f;
-	for (int l12 = 0; l12 < 2; l12 = l12 + 1) fRec7[l12] = 0.0f;
+	for (int l1 = 0; l1 < 2; l1 = l1 + 1) fRec2[l1][0] = 0.0f;
+	for (int l2 = 0; l2 < 2; l2 = l2 + 1) fRec2[l2][1] = 0.0f;
+	for (int l3 = 0; l3 < 3; l3 = l3 + 1) fRec6[l3][0] = 0.0f;
+	for (int l4 = 0; l4 < 3; l4 = l4 + 1) fRec5[l4][0] = 0.0f;
+	for (int l5 = 0; l5 < 3; l5 = l5 + 1) fRec4[l5][0] = 0.0f;
+	for (int l6 = 0; l6 < 3; l6 = l6 + 1) fRec1[l6][0] = 0.0f;
+	for (int l7 = 0; l7 < 2; l7 = l7 + 1) fRec0[l7][0] = 0.0f;
+	for (int l8 = 0; l8 < 3; l8 = l8 + 1) fRec6[l8][1] = 0.0f;
+	for (int l9 = 0; l9 < 3; l9 = l9 + 1) fRec5[l9][1] = 0.0f;
+	for (int l10 = 0; l10 < 3; l10 = l10 + 1) fRec4[l10][1] = 0.0f;
+	for (int l11 = 0; l11 < 3; l11 = l11 + 1) fRec1[l11][1] = 0.0f;
+	for (int l12 = 0; l12 < 2; l12 = l12 + 1) fRec0[l12][1] = 0.0f;
 }
 
 void Dsp::clear_state_f_static(PluginDef *p)
@@ -136,53 +130,53 @@ void always_inline Dsp::compute(int count, FAUSTFLOAT *input0, FAUSTFLOAT *input
 	float fSlow17 = 1.0f - fSlow0;
 	for (int i0 = 0; i0 < count; i0 = i0 + 1) {
 		iVec0[0] = 1;
-		fRec2[0] = fSlow4 * fRec3[1] + fSlow3 * fRec2[1];
-		fRec3[0] = float(1 - iVec0[1]) + fSlow3 * fRec3[1] - fSlow4 * fRec2[1];
-		float fTemp0 = fSlow7 + fSlow6 * (1.0f - fRec2[0]);
-		float fTemp1 = fRec1[1] * std::cos(fSlow9 * fTemp0);
-		float fTemp2 = fRec4[1] * std::cos(fSlow10 * fTemp0);
-		float fTemp3 = fRec5[1] * std::cos(fSlow11 * fTemp0);
-		float fTemp4 = fRec6[1] * std::cos(fSlow8 * fTemp0);
+		fRec2[0][0] = fSlow4 * fRec2[1][1] + fSlow3 * fRec2[1][0];
+		fRec2[0][1] = float(1 - iVec0[1]) + fSlow3 * fRec2[1][1] - fSlow4 * fRec2[1][0];
+		float fTemp0 = fSlow7 + fSlow6 * (1.0f - fRec2[0][0]);
+		float fTemp6 = fSlow7 + fSlow6 * (1.0f - fRec2[0][1]);
+		float fTemp1 = fRec1[1][0] * std::cos(fSlow9 * fTemp0);
+		float fTemp7 = fRec1[1][1] * std::cos(fSlow9 * fTemp6);
+		float fTemp2 = fRec4[1][0] * std::cos(fSlow10 * fTemp0);
+		float fTemp8 = fRec4[1][1] * std::cos(fSlow10 * fTemp6);
+		float fTemp3 = fRec5[1][0] * std::cos(fSlow11 * fTemp0);
+		float fTemp9 = fRec5[1][1] * std::cos(fSlow11 * fTemp6);
+		float fTemp4 = fRec6[1][0] * std::cos(fSlow8 * fTemp0);
+		float fTemp10 = fRec6[1][1] * std::cos(fSlow8 * fTemp6);
 		float fTemp5 = float(input0[i0]);
-		fRec6[0] = fSlow16 * fTemp5 + fSlow15 * fRec0[1] - (fSlow14 * fTemp4 + fSlow13 * fRec6[2]);
-		fRec5[0] = fSlow13 * (fRec6[0] - fRec5[2]) + fRec6[2] + fSlow14 * (fTemp4 - fTemp3);
-		fRec4[0] = fSlow13 * (fRec5[0] - fRec4[2]) + fRec5[2] + fSlow14 * (fTemp3 - fTemp2);
-		fRec1[0] = fSlow13 * (fRec4[0] - fRec1[2]) + fRec4[2] + fSlow14 * (fTemp2 - fTemp1);
-		fRec0[0] = fSlow13 * fRec1[0] + fSlow14 * fTemp1 + fRec1[2];
-		output0[i0] = FAUSTFLOAT(fSlow16 * fTemp5 * fSlow17 + fRec0[0] * fSlow1);
-		float fTemp6 = fSlow7 + fSlow6 * (1.0f - fRec3[0]);
-		float fTemp7 = fRec8[1] * std::cos(fSlow9 * fTemp6);
-		float fTemp8 = fRec9[1] * std::cos(fSlow10 * fTemp6);
-		float fTemp9 = fRec10[1] * std::cos(fSlow11 * fTemp6);
-		float fTemp10 = fRec11[1] * std::cos(fSlow8 * fTemp6);
 		float fTemp11 = float(input1[i0]);
-		fRec11[0] = fSlow16 * fTemp11 + fSlow15 * fRec7[1] - (fSlow14 * fTemp10 + fSlow13 * fRec11[2]);
-		fRec10[0] = fSlow13 * (fRec11[0] - fRec10[2]) + fRec11[2] + fSlow14 * (fTemp10 - fTemp9);
-		fRec9[0] = fSlow13 * (fRec10[0] - fRec9[2]) + fRec10[2] + fSlow14 * (fTemp9 - fTemp8);
-		fRec8[0] = fSlow13 * (fRec9[0] - fRec8[2]) + fRec9[2] + fSlow14 * (fTemp8 - fTemp7);
-		fRec7[0] = fSlow13 * fRec8[0] + fSlow14 * fTemp7 + fRec8[2];
-		output1[i0] = FAUSTFLOAT(fSlow16 * fTemp11 * fSlow17 + fRec7[0] * fSlow1);
+		fRec6[0][0] = fSlow16 * fTemp5 + fSlow15 * fRec0[1][0] - (fSlow14 * fTemp4 + fSlow13 * fRec6[2][0]);
+		fRec6[0][1] = fSlow16 * fTemp11 + fSlow15 * fRec0[1][1] - (fSlow14 * fTemp10 + fSlow13 * fRec6[2][1]);
+		fRec5[0][0] = fSlow13 * (fRec6[0][0] - fRec5[2][0]) + fRec6[2][0] + fSlow14 * (fTemp4 - fTemp3);
+		fRec5[0][1] = fSlow13 * (fRec6[0][1] - fRec5[2][1]) + fRec6[2][1] + fSlow14 * (fTemp10 - fTemp9);
+		fRec4[0][0] = fSlow13 * (fRec5[0][0] - fRec4[2][0]) + fRec5[2][0] + fSlow14 * (fTemp3 - fTemp2);
+		fRec4[0][1] = fSlow13 * (fRec5[0][1] - fRec4[2][1]) + fRec5[2][1] + fSlow14 * (fTemp9 - fTemp8);
+		fRec1[0][0] = fSlow13 * (fRec4[0][0] - fRec1[2][0]) + fRec4[2][0] + fSlow14 * (fTemp2 - fTemp1);
+		fRec1[0][1] = fSlow13 * (fRec4[0][1] - fRec1[2][1]) + fRec4[2][1] + fSlow14 * (fTemp8 - fTemp7);
+		fRec0[0][0] = fSlow13 * fRec1[0][0] + fSlow14 * fTemp1 + fRec1[2][0];
+		fRec0[0][1] = fSlow13 * fRec1[0][1] + fSlow14 * fTemp7 + fRec1[2][1];
+		output0[i0] = FAUSTFLOAT(fSlow16 * fTemp5 * fSlow17 + fRec0[0][0] * fSlow1);
+		output1[i0] = FAUSTFLOAT(fSlow16 * fTemp11 * fSlow17 + fRec0[0][1] * fSlow1);
 		iVec0[1] = iVec0[0];
-		fRec2[1] = fRec2[0];
-		fRec3[1] = fRec3[0];
-		fRec6[2] = fRec6[1];
-		fRec6[1] = fRec6[0];
-		fRec5[2] = fRec5[1];
-		fRec5[1] = fRec5[0];
-		fRec4[2] = fRec4[1];
-		fRec4[1] = fRec4[0];
-		fRec1[2] = fRec1[1];
-		fRec1[1] = fRec1[0];
-		fRec0[1] = fRec0[0];
-		fRec11[2] = fRec11[1];
-		fRec11[1] = fRec11[0];
-		fRec10[2] = fRec10[1];
-		fRec10[1] = fRec10[0];
-		fRec9[2] = fRec9[1];
-		fRec9[1] = fRec9[0];
-		fRec8[2] = fRec8[1];
-		fRec8[1] = fRec8[0];
-		fRec7[1] = fRec7[0];
+		fRec2[1][0] = fRec2[0][0];
+		fRec2[1][1] = fRec2[0][1];
+		fRec6[2][0] = fRec6[1][0];
+		fRec6[2][1] = fRec6[1][1];
+		fRec6[1][0] = fRec6[0][0];
+		fRec6[1][1] = fRec6[0][1];
+		fRec5[2][0] = fRec5[1][0];
+		fRec5[2][1] = fRec5[1][1];
+		fRec5[1][0] = fRec5[0][0];
+		fRec5[1][1] = fRec5[0][1];
+		fRec4[2][0] = fRec4[1][0];
+		fRec4[2][1] = fRec4[1][1];
+		fRec4[1][0] = fRec4[0][0];
+		fRec4[1][1] = fRec4[0][1];
+		fRec1[2][0] = fRec1[1][0];
+		fRec1[2][1] = fRec1[1][1];
+		fRec1[1][0] = fRec1[0][0];
+		fRec1[1][1] = fRec1[0][1];
+		fRec0[1][0] = fRec0[0][0];
+		fRec0[1][1] = fRec0[0][1];
 	}
 }
 
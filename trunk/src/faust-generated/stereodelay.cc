@@ -123,16 +123,16 @@ void Dsp::init_static(unsigned int sample_rate, PluginDef *p)
 
 void Dsp::mem_alloc()
 {
-	if (!fVec1) fVec1 = new float[524288];
-	if (!fVec2) fVec2 = new float[524288];
+	if (!fVec1) fVec1 = rt_alloc<float>(524288);
+	if (!fVec2) fVec2 = rt_alloc<float>(524288);
 	mem_allocated = true;
 }
 
 void Dsp::mem_free()
 {
 	mem_allocated = false;
-	if (fVec1) { delete fVec1; fVec1 = 0; }
-	if (fVec2) { delete fVec2; fVec2 = 0; }
+	if (fVec1) { rt_free(fVec1); fVec1 = 0; }
+	if (fVec2) { rt_free(fVec2); fVec2 = 0; }
 }
 
 int Dsp::activate(bool start)
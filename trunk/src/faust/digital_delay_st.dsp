@@ -3,6 +3,7 @@ declare name "Digital Stereo Delay";
 declare shortname "Digi Delay S";
 declare category "Echo / Delay";
 declare description "Digital Delay Stereo Version";
+declare pack_stereo "1";
 
 dds = component("digital_delay.dsp");
 
@@ -1,6 +1,7 @@
 declare id   "phaser";
 declare name "Phaser";
 declare category "Modulation";
+declare pack_stereo "1";
 
 //phaser taken from effect.lib 
 // by Julius O. Smith III
@@ -1,6 +1,7 @@
 declare id 		"tonemodul";
 declare name            "3 Band EQ";
 declare category        "Tone Control";
+declare pack_stereo     "1";
 declare version 	"0.01";
 declare author 		"brummer";
 declare license 	"BSD";
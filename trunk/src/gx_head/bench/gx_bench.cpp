@@ -0,0 +1,427 @@
+/*
+ * Copyright (C) 2009, 2010 Hermann Meyer, James Warden, Andreas Degert
+ * Copyright (C) 2011 Pete Shorthose
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ * ---------------------------------------------------------------------------
+ *
+ *    guitarix-bench: measure the dsp cost of every module in the
+ *    plugin list (builtin, faust generated, pluginlib, LADSPA / LV2)
+ *
+ *    usage: guitarix-bench [--bench-plugin ID ...] [--bench-rates 44100,48000]
+ *                          [--bench-buffers 64,256] [--bench-seconds S]
+ *                          [--bench-output FILE]
+ *
+ *    The result is a JSON document (see write_result), suitable for
+ *    comparing two builds.
+ *
+ * ----------------------------------------------------------------------------
+ */
+
+#include <sys/syscall.h>                // NOLINT
+#include <linux/perf_event.h>           // NOLINT
+#include <sys/ioctl.h>                  // NOLINT
+#include <glibmm/init.h>                // NOLINT
+#include <giomm/init.h>                 // NOLINT
+#include "engine.h"                     // NOLINT
+
+using gx_engine::Plugin;
+using gx_engine::PluginDef;
+
+/****************************************************************
+ ** class CacheMissCounter
+ ** hardware counter via perf_event_open (counting this thread only);
+ ** not available on all systems (perf_event_paranoid, VMs)
+ */
+
+class CacheMissCounter {
+private:
+    int fd;
+public:
+    CacheMissCounter();
+    ~CacheMissCounter() { if (fd >= 0) close(fd); }
+    bool available() const { return fd >= 0; }
+    void start();
+    long long stop();
+};
+
+CacheMissCounter::CacheMissCounter(): fd(-1) {
+    struct perf_event_attr pe;
+    memset(&pe, 0, sizeof(pe));
+    pe.type = PERF_TYPE_HARDWARE;
+    pe.size = sizeof(pe);
+    pe.config = PERF_COUNT_HW_CACHE_MISSES;
+    pe.disabled = 1;
+    pe.exclude_kernel = 1;
+    pe.exclude_hv = 1;
+    fd = syscall(__NR_perf_event_open, &pe, 0, -1, -1, 0);
+}
+
+void CacheMissCounter::start() {
+    if (fd < 0) {
+	return;
+    }
+    ioctl(fd, PERF_EVENT_IOC_RESET, 0);
+    ioctl(fd, PERF_EVENT_IOC_ENABLE, 0);
+}
+
+long long CacheMissCounter::stop() {
+    if (fd < 0) {
+	return -1;
+    }
+    ioctl(fd, PERF_EVENT_IOC_DISABLE, 0);
+    long long count;
+    if (read(fd, &count, sizeof(count)) != sizeof(count)) {
+	return -1;
+    }
+    return count;
+}
+
+/****************************************************************
+ ** synthetic guitar signal
+ ** plucked notes (decaying harmonic series) on the open strings,
+ ** a new note every 0.4 s, with a little noise floor; includes the
+ ** long decays into near-silence where denormals tend to appear
+ */
+
+static void make_guitar_signal(std::vector<float>& buf, unsigned int samplerate) {
+    static const float notes[] = { 82.41, 110.0, 146.83, 196.0, 246.94, 329.63 };
+    const unsigned int nnotes = sizeof(notes) / sizeof(notes[0]);
+    const unsigned int note_len = samplerate * 2 / 5;
+    unsigned int seed = 1;
+    for (unsigned int i = 0; i < buf.size(); ++i) {
+	unsigned int n = i / note_len;
+	double t = double(i % note_len) / samplerate;
+	double f0 = notes[n % nnotes];
+	double v = 0;
+	for (int h = 1; h <= 8; ++h) {
+	    v += sin(2 * M_PI * f0 * h * t) * exp(-t * (3.0 + h)) / h;
+	}
+	seed = seed * 1103515245 + 12345;
+	double noise = ((seed >> 16) & 0x7fff) / 32768.0 - 0.5;
+	buf[i] = 0.3 * v + 1e-4 * noise;
+    }
+}
+
+/****************************************************************
+ ** engine setup
+ */
+
+/*
+** set samplerate and buffersize of the engine like the jack
+** callbacks do: the plugins allocate their buffers and the
+** convolvers are configured in the handlers (some of them run as
+** idle callbacks). SF_INITIALIZING stays set, there is no rt thread
+** to wait for.
+*/
+static void set_engine_format(gx_engine::GxEngine& engine, unsigned int samplerate,
+			      unsigned int buffersize) {
+    engine.set_stateflag(gx_engine::ModuleSequencer::SF_INITIALIZING);
+    engine.init(samplerate, buffersize, SCHED_OTHER, 0);
+    Glib::RefPtr<Glib::MainContext> ctx = Glib::MainContext::get_default();
+    while (ctx->iteration(false));
+}
+
+/****************************************************************
+ ** benchmark one plugin
+ */
+
+struct BenchResult {
+    unsigned int samplerate;
+    unsigned int buffersize;
+    double ns_per_sample;
+    long long cache_misses;   // -1: not available
+    unsigned int denormals;   // subnormal output samples
+    unsigned int nonfinite;   // NaN / Inf output samples
+};
+
+static unsigned int count_class(const float *p, unsigned int n, unsigned int *nonfinite) {
+    unsigned int d = 0;
+    for (unsigned int i = 0; i < n; ++i) {
+	switch (fpclassify(p[i])) {
+	case FP_SUBNORMAL: d += 1; break;
+	case FP_NAN:
+	case FP_INFINITE: *nonfinite += 1; break;
+	default: break;
+	}
+    }
+    return d;
+}
+
+static inline double now_ns() {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1e9 + ts.tv_nsec;
+}
+
+static bool bench_plugin(PluginDef *pd, const std::vector<float>& input,
+			 unsigned int samplerate, unsigned int buffersize,
+			 CacheMissCounter& cm, BenchResult& res) {
+    if (pd->set_samplerate) {
+	pd->set_samplerate(samplerate, pd);
+    }
+    if (pd->activate_plugin && pd->activate_plugin(true, pd) != 0) {
+	return false;
+    }
+    if (pd->clear_state) {
+	pd->clear_state(pd);
+    }
+    std::vector<float> in1(buffersize), in2(buffersize), out1(buffersize), out2(buffersize);
+    unsigned int blocks = input.size() / buffersize;
+    // warm up caches and branch predictors with the first second
+    unsigned int warmup = min(blocks, samplerate / buffersize);
+    double ns = 0;
+    long long misses = 0;
+    res.denormals = res.nonfinite = 0;
+    cm.start();
+    for (unsigned int b = 0; b < blocks; ++b) {
+	const float *src = &input[b * buffersize];
+	std::copy(src, src + buffersize, in1.begin());
+	double t0 = 0;
+	if (b == warmup) {
+	    cm.stop();
+	    cm.start();
+	}
+	if (b >= warmup) {
+	    t0 = now_ns();
+	}
+	if (pd->mono_audio) {
+	    pd->mono_audio(buffersize, &in1[0], &out1[0], pd);
+	} else {
+	    std::copy(src, src + buffersize, in2.begin());
+	    pd->stereo_audio(buffersize, &in1[0], &in2[0], &out1[0], &out2[0], pd);
+	}
+	if (b >= warmup) {
+	    ns += now_ns() - t0;
+	}
+	res.denormals += count_class(&out1[0], buffersize, &res.nonfinite);
+	if (pd->stereo_audio) {
+	    res.denormals += count_class(&out2[0], buffersize, &res.nonfinite);
+	}
+    }
+    misses = cm.stop();
+    if (pd->activate_plugin) {
+	pd->activate_plugin(false, pd);
+    }
+    unsigned int measured = (blocks - warmup) * buffersize;
+    res.samplerate = samplerate;
+    res.buffersize = buffersize;
+    res.ns_per_sample = measured ? ns / measured : 0;
+    res.cache_misses = misses;
+    return true;
+}
+
+/****************************************************************
+ ** command line
+ */
+
+static void parse_list(const Glib::ustring& s, std::vector<unsigned int>& l) {
+    l.clear();
+    std::istringstream is(s);
+    std::string tok;
+    while (std::getline(is, tok, ',')) {
+	int v = atoi(tok.c_str());
+	if (v <= 0) {
+	    throw Glib::OptionError(
+		Glib::OptionError::BAD_VALUE,
+		(boost::format(_("bad number '%1%' in list '%2%'")) % tok % s).str());
+	}
+	l.push_back(v);
+    }
+}
+
+class BenchOptions {
+public:
+    Glib::OptionGroup group;
+    std::vector<Glib::ustring> plugins;
+    Glib::ustring rates;
+    Glib::ustring buffers;
+    double seconds;
+    std::string output;
+    bool allow_denormals;
+    BenchOptions();
+};
+
+BenchOptions::BenchOptions()
+    : group("bench", "Benchmark options"),
+      plugins(),
+      rates("44100,48000,96000"),
+      buffers("32,64,256,1024"),
+      seconds(10),
+      output(),
+      allow_denormals(false) {
+    Glib::OptionEntry opt_plugin;
+    opt_plugin.set_long_name("bench-plugin");
+    opt_plugin.set_description("only measure plugin with id ID (may be repeated)");
+    opt_plugin.set_arg_description("ID");
+    group.add_entry(opt_plugin, plugins);
+    Glib::OptionEntry opt_rates;
+    opt_rates.set_long_name("bench-rates");
+    opt_rates.set_description("comma separated list of samplerates (default: 44100,48000,96000)");
+    opt_rates.set_arg_description("HZ,..");
+    group.add_entry(opt_rates, rates);
+    Glib::OptionEntry opt_buffers;
+    opt_buffers.set_long_name("bench-buffers");
+    opt_buffers.set_description("comma separated list of buffer sizes (default: 32,64,256,1024)");
+    opt_buffers.set_arg_description("FRAMES,..");
+    group.add_entry(opt_buffers, buffers);
+    Glib::OptionEntry opt_seconds;
+    opt_seconds.set_long_name("bench-seconds");
+    opt_seconds.set_description("seconds of audio per measurement (default: 10)");
+    opt_seconds.set_arg_description("S");
+    group.add_entry(opt_seconds, seconds);
+    Glib::OptionEntry opt_output;
+    opt_output.set_long_name("bench-output");
+    opt_output.set_description("write JSON result to FILE (default: stdout)");
+    opt_output.set_arg_description("FILE");
+    group.add_entry_filename(opt_output, output);
+    Glib::OptionEntry opt_denormals;
+    opt_denormals.set_long_name("bench-allow-denormals");
+    opt_denormals.set_description("don't set flush-to-zero like the jack thread does (denormal counts "
+				  "are only meaningful with this option)");
+    group.add_entry(opt_denormals, allow_denormals);
+}
+
+/****************************************************************
+ ** main
+ */
+
+static void write_result(gx_system::JsonWriter& jw, Plugin *pl, const std::vector<BenchResult>& rl) {
+    PluginDef *pd = pl->get_pdef();
+    jw.begin_object(true);
+    jw.write_kv("id", pd->id);
+    jw.write_kv("name", pd->name ? pd->name : "");
+    jw.write_kv("category", pd->category ? pd->category : "");
+    jw.write_kv("channels", pd->mono_audio ? 1 : 2);
+    jw.write_key("results");
+    jw.begin_array(true);
+    for (std::vector<BenchResult>::const_iterator r = rl.begin(); r != rl.end(); ++r) {
+	jw.begin_object();
+	jw.write_kv("samplerate", r->samplerate);
+	jw.write_kv("buffersize", r->buffersize);
+	jw.write_kv("ns_per_sample", r->ns_per_sample);
+	jw.write_key("cache_misses");
+	if (r->cache_misses < 0) {
+	    jw.write_null();
+	} else {
+	    jw.write(static_cast<double>(r->cache_misses));
+	}
+	jw.write_kv("denormals", r->denormals);
+	jw.write_kv("nonfinite", r->nonfinite);
+	jw.end_object(true);
+    }
+    jw.end_array(true);
+    jw.end_object(true);
+}
+
+static int bench_main(int argc, char *argv[]) {
+    Glib::init();
+    Gio::init();
+
+    gx_system::CmdlineOptions options;
+    BenchOptions bopt;
+    options.add_group(bopt.group);
+    options.parse(argc, argv);
+    options.process(argc, argv);
+    std::vector<unsigned int> rates, buffers;
+    parse_list(bopt.rates, rates);
+    parse_list(bopt.buffers, buffers);
+
+    gx_engine::GxEngine engine(options.get_plugin_dir(), gx_engine::get_group_table(), options);
+    // the convolvers must not drop partitions when the measurement
+    // thread is faster than the background convolver threads
+    engine.mono_convolver.set_sync(true);
+    engine.stereo_convolver.set_sync(true);
+    engine.cabinet.set_sync(true);
+    engine.cabinet_st.set_sync(true);
+    engine.preamp.set_sync(true);
+    engine.preamp_st.set_sync(true);
+    engine.contrast.set_sync(true);
+    engine.get_param().set_init_values();
+
+    std::set<std::string> selected(bopt.plugins.begin(), bopt.plugins.end());
+    std::ofstream ofs;
+    std::ostream *os = &cout;
+    if (!bopt.output.empty()) {
+	ofs.open(bopt.output.c_str());
+	if (!ofs.good()) {
+	    cerr << boost::format("can't open %1%") % bopt.output << endl;
+	    return 1;
+	}
+	os = &ofs;
+    }
+    CacheMissCounter cm;
+    if (!cm.available()) {
+	cerr << "hardware cache miss counter not available" << endl;
+    }
+    if (!bopt.allow_denormals) {
+	AVOIDDENORMALS();
+    }
+    gx_system::JsonWriter jw(os);
+    jw.begin_object(true);
+    jw.write_kv("version", GX_VERSION);
+    jw.write_kv("seconds", bopt.seconds);
+    jw.write_kv("flush_to_zero", bopt.allow_denormals ? 0 : 1);
+    jw.write_key("plugins");
+    jw.begin_array(true);
+    int failed = 0;
+    for (gx_engine::PluginList::pluginmap::iterator i = engine.pluginlist.begin();
+	 i != engine.pluginlist.end(); ++i) {
+	Plugin *pl = i->second;
+	PluginDef *pd = pl->get_pdef();
+	if (!pd->mono_audio && !pd->stereo_audio) {
+	    continue;
+	}
+	if (!selected.empty() && selected.find(pd->id) == selected.end()) {
+	    continue;
+	}
+	cerr << pd->id << endl;
+	std::vector<BenchResult> rl;
+	for (std::vector<unsigned int>::iterator sr = rates.begin(); sr != rates.end(); ++sr) {
+	    std::vector<float> input(static_cast<size_t>(*sr * (bopt.seconds + 1)));
+	    make_guitar_signal(input, *sr);
+	    for (std::vector<unsigned int>::iterator bs = buffers.begin(); bs != buffers.end(); ++bs) {
+		set_engine_format(engine, *sr, *bs);
+		BenchResult res;
+		if (!bench_plugin(pd, input, *sr, *bs, cm, res)) {
+		    cerr << boost::format("%1%: activation failed at %2% Hz / %3% frames")
+			% pd->id % *sr % *bs << endl;
+		    failed += 1;
+		    continue;
+		}
+		rl.push_back(res);
+	    }
+	}
+	write_result(jw, pl, rl);
+    }
+    jw.end_array(true);
+    jw.end_object(true);
+    jw.close();
+    return failed ? 1 : 0;
+}
+
+int main(int argc, char *argv[]) {
+    try {
+	return bench_main(argc, argv);
+    } catch (const Glib::OptionError &error) {
+	cerr << error.what() << endl;
+	cerr << "use \"guitarix-bench -h\" to get a help text" << endl;
+    } catch (const Glib::Error& error) {
+	cerr << error.what() << endl;
+    } catch (const std::exception& except) {
+	cerr << except.what() << endl;
+    }
+    return 1;
+}
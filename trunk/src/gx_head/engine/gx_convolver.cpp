@@ -165,6 +165,10 @@ GxConvolverBase::~GxConvolverBase() {
     if (is_runnable()) {
 	stop_process();
     }
+    for (int c = 0; c < 2; c++) {
+        delete[] head[c];
+        delete[] hist[c];
+    }
 }
 
 void GxConvolverBase::adjust_values(
@@ -213,7 +217,165 @@ void GxConvolverBase::adjust_values(
     }
 }
 
+/*
+** Convproc::cleanup() and Convproc::configure() create / destroy
+** FFTW plans: done with the planner of FFTPlanner locked. Measured
+** plans are only requested when the partition sizes are in the
+** wisdom, so that configure() never runs the FFTW measuring
+*/
+int GxConvolverBase::cleanup() {
+    boost::mutex::scoped_lock lock(FFTPlanner::getInstance().get_planner_mutex());
+    return Convproc::cleanup();
+}
+
+/*
+** Convproc::configure(); in any_count mode quantum and minpart are
+** forced to the head size Convproc::MINPART, independent of the
+** engine buffersize, so that the direct convolution costs
+** MINPART multiply-adds per sample and the rest of the impulse
+** response starts with small FFT partitions growing up to maxpart.
+** maxpart is only the default, the layout measured by
+** ConvolverTuner is used when there is one
+*/
+int GxConvolverBase::configure_proc(
+    unsigned int ninp, unsigned int nout, unsigned int size,
+    unsigned int quantum, unsigned int minpart, unsigned int maxpart) {
+    for (int c = 0; c < 2; c++) {
+        delete[] head[c];
+        head[c] = 0;
+        delete[] hist[c];
+        hist[c] = 0;
+    }
+    part = 0;
+    nchan = 0;
+    fill = 0;
+    if (any_count) {
+        assert(nout <= 2);
+        part = Convproc::MINPART;
+        quantum = minpart = part;
+        if (maxpart < part) {
+            maxpart = part;
+        }
+        nchan = nout;
+        for (unsigned int c = 0; c < nchan; c++) {
+            head[c] = new float[part];
+            memset(head[c], 0, part * sizeof(float));
+            hist[c] = new float[2*part];
+            memset(hist[c], 0, 2 * part * sizeof(float));
+        }
+    }
+    maxpart = ConvolverTuner::getInstance().get_maxpart(nout, size, quantum, minpart, maxpart);
+    FFTPlanner& planner = FFTPlanner::getInstance();
+    set_options(planner.convolver_measured() ? Convproc::OPT_FFTW_MEASURE : 0);
+    boost::mutex::scoped_lock lock(planner.get_planner_mutex());
+#if ZITA_CONVOLVER_VERSION == 4
+    return Convproc::configure(ninp, nout, size, quantum, minpart, maxpart, 0.0);
+#else
+    return Convproc::configure(ninp, nout, size, quantum, minpart, maxpart);
+#endif
+}
+
+/*
+** impulse response data below part goes into head (reversed), the
+** rest into Convproc, shifted down by part
+*/
+int GxConvolverBase::impdata_create(
+    unsigned int inp, unsigned int out, unsigned int step,
+    float *data, int ind0, int ind1) {
+    if (!any_count) {
+        return Convproc::impdata_create(inp, out, step, data, ind0, ind1);
+    }
+    int p = part;
+    for (int i = ind0; i < min(ind1, p); i++) {
+        head[out][p-1-i] = data[(i-ind0)*step];
+    }
+    if (ind1 <= p) {
+        return 0;
+    }
+    int i0 = max(ind0, p);
+    return Convproc::impdata_create(
+        inp, out, step, data + (i0-ind0)*step, i0 - p, ind1 - p);
+}
+
+int GxConvolverBase::impdata_update(
+    unsigned int inp, unsigned int out, unsigned int step,
+    float *data, int ind0, int ind1) {
+    if (!any_count) {
+        return Convproc::impdata_update(inp, out, step, data, ind0, ind1);
+    }
+    int p = part;
+    for (int i = ind0; i < min(ind1, p); i++) {
+        head[out][p-1-i] = data[(i-ind0)*step];
+    }
+    if (ind1 <= p) {
+        return 0;
+    }
+    int i0 = max(ind0, p);
+    return Convproc::impdata_update(
+        inp, out, step, data + (i0-ind0)*step, i0 - p, ind1 - p);
+}
+
+int GxConvolverBase::impdata_copy(
+    unsigned int inp1, unsigned int out1, unsigned int inp2, unsigned int out2) {
+    if (any_count) {
+        memcpy(head[out2], head[out1], part * sizeof(float));
+    }
+    return Convproc::impdata_copy(inp1, out1, inp2, out2);
+}
+
+#if ZITA_CONVOLVER_VERSION == 4
+int GxConvolverBase::impdata_clear(unsigned int inp, unsigned int out) {
+    if (any_count) {
+        memset(head[out], 0, part * sizeof(float));
+    }
+    return Convproc::impdata_clear(inp, out);
+}
+#endif
+
+/*
+** any_count processing: the head is convolved directly with the
+** input history, the Convproc output of the last partition (which
+** holds the rest of the impulse response, delayed by one partition)
+** is added. Input and output buffers may be the same.
+*/
+int __rt_func GxConvolverBase::process_any(int count, float **input, float **output) {
+    int flags = 0;
+    int p = part;
+    for (int i = 0; i < count; ) {
+        int n = min(count - i, p - static_cast<int>(fill));
+        for (unsigned int c = 0; c < nchan; c++) {
+            memcpy(hist[c] + p + fill, input[c] + i, n * sizeof(float));
+            memcpy(inpdata(c) + fill, input[c] + i, n * sizeof(float));
+            const float *h = head[c];
+            const float *tail = outdata(c) + fill;
+            float *out = output[c] + i;
+            for (int j = 0; j < n; j++) {
+                const float *x = hist[c] + fill + j + 1;
+                float sum = tail[j];
+                for (int k = 0; k < p; k++) {
+                    sum += h[k] * x[k];
+                }
+                out[j] = sum;
+            }
+        }
+        fill += n;
+        i += n;
+        if (fill == part) {
+            flags |= process(sync);
+            for (unsigned int c = 0; c < nchan; c++) {
+                memcpy(hist[c], hist[c] + p, p * sizeof(float));
+            }
+            fill = 0;
+        }
+    }
+    return flags;
+}
+
 bool GxConvolverBase::start(int policy, int priority) {
+    fill = 0;
+    for (unsigned int c = 0; c < nchan; c++) {
+        memset(hist[c], 0, 2 * part * sizeof(float));
+    }
     int rc = start_process(priority, policy);
     if (rc != 0) {
         gx_print_error("convolver", "can't start convolver");
@@ -416,17 +578,10 @@ bool GxConvolver::configure(
 	delay = round(delay * f);
 	ldelay = round(ldelay * f);
     }
-#if ZITA_CONVOLVER_VERSION == 4
-        if (Convproc::configure(2, 2, size, buffersize, bufsize, Convproc::MAXPART, 0.0)) {
-            gx_print_error("convolver", "error in Convproc::configure ");
-            return false;
-        }        
-#else 
-        if (Convproc::configure(2, 2, size, buffersize, bufsize, Convproc::MAXPART)) {
-            gx_print_error("convolver", "error in Convproc::configure ");
-            return false;
-        }
-#endif
+    if (configure_proc(2, 2, size, buffersize, bufsize, Convproc::MAXPART)) {
+        gx_print_error("convolver", "error in Convproc::configure ");
+        return false;
+    }
 
     float gain_a[2] = {gain, lgain};
     unsigned int delay_a[2] = {delay, ldelay};
@@ -450,6 +605,11 @@ bool __rt_func GxConvolver::compute(int count, float* input1, float *input2,
         }
         return true;
     }
+    if (any_count) {
+        float *in[2] = {input1, input2};
+        float *out[2] = {output1, output2};
+        return process_any(count, in, out) == 0;
+    }
     memcpy(inpdata(0), input1, count * sizeof(float));
     memcpy(inpdata(1), input2, count * sizeof(float));
 
@@ -486,17 +646,10 @@ bool GxConvolver::configure(string fname, float gain, unsigned int delay, unsign
 	size = round(size * f) + 2; // 2 is safety margin for rounding differences
 	delay = round(delay * f);
     }
-#if ZITA_CONVOLVER_VERSION == 4
-        if (Convproc::configure(1, 1, size, buffersize, bufsize, Convproc::MAXPART,0.0)) {
-            gx_print_error("convolver", "error in Convproc::configure ");
-            return false;
-        }        
-#else 
-        if (Convproc::configure(1, 1, size, buffersize, bufsize, Convproc::MAXPART)) {
-            gx_print_error("convolver", "error in Convproc::configure ");
-            return false;
-        }
-#endif
+    if (configure_proc(1, 1, size, buffersize, bufsize, Convproc::MAXPART)) {
+        gx_print_error("convolver", "error in Convproc::configure ");
+        return false;
+    }
 
     float gain_a[1] = {gain};
     unsigned int delay_a[1] = {delay};
@@ -516,6 +669,9 @@ bool __rt_func GxConvolver::compute(int count, float* input, float *output) {
         }
         return true;
     }
+    if (any_count) {
+        return process_any(count, &input, &output) == 0;
+    }
     memcpy(inpdata(0), input, count * sizeof(float));
 
     int flags = process(sync);
@@ -570,19 +726,11 @@ bool GxSimpleConvolver::configure(int count, float *impresp, unsigned int imprat
     if (bufsize < Convproc::MINPART) {
         bufsize = Convproc::MINPART;
     }
-#if ZITA_CONVOLVER_VERSION == 4
-        if (Convproc::configure(1, 1, count, buffersize,
-                                bufsize, Convproc::MAXPART,0.0)) {
-            gx_print_error("convolver", "error in Convproc::configure");
-            return false;
-        }        
-#else 
-        if (Convproc::configure(1, 1, count, buffersize,
-                                bufsize, Convproc::MAXPART)) {
-            gx_print_error("convolver", "error in Convproc::configure");
-            return false;
-        }
-#endif
+    if (configure_proc(1, 1, count, buffersize,
+                       bufsize, Convproc::MAXPART)) {
+        gx_print_error("convolver", "error in Convproc::configure");
+        return false;
+    }
     if (impdata_create(0, 0, 1, impresp, 0, count)) {
         gx_print_error("convolver", "out of memory");
         return false;
@@ -619,6 +767,9 @@ bool __rt_func GxSimpleConvolver::compute(int count, float* input, float *output
         }
         return true;
     }
+    if (any_count) {
+        return process_any(count, &input, &output) == 0;
+    }
     int flags = 0;
     if (static_cast<unsigned int>(count) == buffersize)
     {
@@ -666,22 +817,12 @@ bool GxSimpleConvolver::configure_stereo(int count, float *impresp, unsigned int
     {
       bufsize = Convproc::MINPART;
     }
-#if ZITA_CONVOLVER_VERSION == 4
-      if (Convproc::configure(2, 2, count, buffersize,
-                              bufsize, bufsize,0.0)) // Convproc::MAXPART
-        {
-          printf("no configure\n");
-          return false;
-        }
-      
-#else 
-      if (Convproc::configure(2, 2, count, buffersize,
-                              bufsize, bufsize)) // Convproc::MAXPART
-        {
-          printf("no configure\n");
-          return false;
-        }
-#endif
+  if (configure_proc(2, 2, count, buffersize,
+                     bufsize, bufsize)) // Convproc::MAXPART
+    {
+      printf("no configure\n");
+      return false;
+    }
   if (impdata_create(0, 0, 1, impresp, 0, count) & impdata_create(1, 1, 1, impresp, 0, count))
     {
       printf("no impdata_create()\n");
@@ -734,6 +875,12 @@ bool __rt_func GxSimpleConvolver::compute_stereo(int count, float* input, float*
         }
       return true;
     }
+  if (any_count)
+    {
+      float *in[2] = {input, input1};
+      float *out[2] = {output, output1};
+      return process_any(count, in, out) == 0;
+    }
   int flags = 0;
   if (static_cast<unsigned int>(count) == buffersize)
     {
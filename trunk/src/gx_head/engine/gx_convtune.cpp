@@ -0,0 +1,426 @@
+/*
+ * Copyright (C) 2009, 2010 Hermann Meyer, James Warden, Andreas Degert
+ * Copyright (C) 2011 Pete Shorthose
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ * --------------------------------------------------------------------------
+ *
+ *  partition layout of the convolvers, benchmarked per machine
+ *
+ * --------------------------------------------------------------------------
+ */
+
+#include "engine.h"             // NOLINT
+#include <sys/utsname.h>
+#include <sys/resource.h>
+
+namespace gx_engine {
+
+/****************************************************************
+ ** class ConvolverTuner
+ */
+
+static const char *profile_magic = "guitarix-convolver-profile 1";
+static const unsigned int bench_samples = 32768;  // per run (at least)
+static const int bench_runs = 5;                  // median of
+static const double bench_stop = 1.5;             // stop at this cost ratio to the best
+static const double bench_tie = 0.05;             // rt times closer than this are equal
+static const unsigned int bench_rate = 48000;     // nominal rate of the paced run
+
+bool ConvolverTuner::Layout::operator<(const Layout& l) const {
+    if (nchan != l.nchan) {
+	return nchan < l.nchan;
+    }
+    if (quantum != l.quantum) {
+	return quantum < l.quantum;
+    }
+    if (minpart != l.minpart) {
+	return minpart < l.minpart;
+    }
+    return size < l.size;
+}
+
+ConvolverTuner::ConvolverTuner()
+    : mutex(),
+      profile(),
+      pending(),
+      profile_file(),
+      cpu(),
+      profile_changed(false),
+      pthr(),
+      sem(),
+      stop(0),
+      thread_started(false) {
+    sem_init(&sem, 0, 0);
+}
+
+ConvolverTuner::~ConvolverTuner() {
+    if (thread_started) {
+	gx_system::atomic_set(&stop, 1);
+	sem_post(&sem);
+	pthread_join(pthr, NULL);
+    }
+    sem_destroy(&sem);
+}
+
+// machine type, number of cpus and cpu model
+std::string ConvolverTuner::cpu_signature() {
+    std::string s;
+    struct utsname u;
+    if (uname(&u) == 0) {
+	s = u.machine;
+    }
+    s += " " + gx_system::to_string(sysconf(_SC_NPROCESSORS_ONLN));
+    ifstream f("/proc/cpuinfo");
+    std::string line;
+    while (getline(f, line)) {
+	size_t p = line.find(':');
+	if (p == std::string::npos) {
+	    continue;
+	}
+	std::string key = line.substr(0, line.find_last_not_of(" \t", p-1)+1);
+	if (key == "model name" ||  // x86
+	    key == "CPU part" ||    // arm
+	    key == "cpu") {         // ppc
+	    p = line.find_first_not_of(" \t", p+1);
+	    if (p != std::string::npos) {
+		s += " " + line.substr(p);
+	    }
+	    break;
+	}
+    }
+    return s;
+}
+
+unsigned int ConvolverTuner::size_class(unsigned int size) {
+    unsigned int n = 1;
+    while (n < size && n < 0x80000000u) {
+	n <<= 1;
+    }
+    return n;
+}
+
+// load the profile and start the job; without init() (plugin
+// builds) get_maxpart() always returns the default
+void ConvolverTuner::init(const std::string& profile_file_) {
+    boost::mutex::scoped_lock lock(mutex);
+    if (thread_started) {
+	return;
+    }
+    profile_file = profile_file_;
+    cpu = cpu_signature();
+    load();
+    if (pthread_create(&pthr, NULL, run_thread, this)) {
+	gx_print_error("convolver", _("can't create thread for the partition benchmark"));
+	return;
+    }
+    thread_started = true;
+}
+
+// mutex must be held
+void ConvolverTuner::load() {
+    ifstream f(profile_file.c_str());
+    if (f.fail()) {
+	return;
+    }
+    std::string line;
+    if (!getline(f, line) || line != profile_magic) {
+	gx_print_warning("convolver", boost::format(_("profile %1%: unknown format")) % profile_file);
+	return;
+    }
+    if (!getline(f, line) || line != "cpu " + cpu) {
+	// made on another machine (or the cpu changed)
+	profile_changed = true;
+	return;
+    }
+    while (getline(f, line)) {
+	unsigned int nchan, quantum, minpart, size, maxpart;
+	if (sscanf(line.c_str(), "%u %u %u %u %u", &nchan, &quantum, &minpart, &size, &maxpart) == 5) {
+	    profile[Layout(nchan, quantum, minpart, size)] = maxpart;
+	}
+    }
+}
+
+// job thread
+void ConvolverTuner::save() {
+    ostringstream os;
+    {
+	boost::mutex::scoped_lock lock(mutex);
+	if (!profile_changed || profile_file.empty()) {
+	    return;
+	}
+	os << profile_magic << "\ncpu " << cpu << "\n";
+	for (ProfileMap::iterator i = profile.begin(); i != profile.end(); ++i) {
+	    const Layout& l = i->first;
+	    os << l.nchan << " " << l.quantum << " " << l.minpart << " "
+	       << l.size << " " << i->second << "\n";
+	}
+	profile_changed = false;
+    }
+    std::string tmp = profile_file + "_tmp";
+    ofstream f(tmp.c_str());
+    f << os.str();
+    f.close();
+    if (f.fail() || rename(tmp.c_str(), profile_file.c_str()) != 0) {
+	gx_print_warning("convolver", boost::format(_("can't write profile %1%")) % profile_file);
+	unlink(tmp.c_str());
+    }
+}
+
+/*
+** returns the maxpart to be used for Convproc::configure(); maxpart
+** is the default of the caller (also returned while the layout is
+** measured)
+*/
+unsigned int ConvolverTuner::get_maxpart(
+    unsigned int nchan, unsigned int size, unsigned int quantum,
+    unsigned int minpart, unsigned int maxpart) {
+    Layout l(nchan, quantum, minpart, size_class(size));
+    boost::mutex::scoped_lock lock(mutex);
+    if (!thread_started) {
+	return maxpart;
+    }
+    ProfileMap::iterator i = profile.find(l);
+    if (i == profile.end()) {
+	if (find(pending.begin(), pending.end(), l) == pending.end()) {
+	    pending.push_back(l);
+	    sem_post(&sem);
+	}
+	return maxpart;
+    }
+    if (i->second < minpart || i->second > static_cast<unsigned int>(Convproc::MAXPART)) {
+	return maxpart;
+    }
+    return i->second;
+}
+
+static double elapsed(const struct timespec& t0, const struct timespec& t1) {
+    return (t1.tv_sec - t0.tv_sec) + (t1.tv_nsec - t0.tv_nsec) * 1e-9;
+}
+
+// job thread, one run of benchmark()
+bool ConvolverTuner::run(Convproc& proc, const Layout& l, unsigned int maxpart,
+			 bool paced, Cost& cost) {
+    // one maxpart cycle to get all levels running, then measure
+    // complete maxpart cycles
+    unsigned int warmup = maxpart / l.quantum;
+    unsigned int periods = max(bench_samples, 2 * maxpart) / l.quantum;
+    long period_ns = static_cast<long>(1e9 * l.quantum / bench_rate);
+    struct timespec t0, t1, next;
+    double rt = 0;
+    clock_gettime(CLOCK_MONOTONIC, &next);
+    t0 = next;
+    for (unsigned int n = 0; n < warmup + periods; n++) {
+	if (gx_system::atomic_get(stop)) {
+	    return false;
+	}
+	if (n == warmup) {
+	    clock_gettime(CLOCK_MONOTONIC, &t0);
+	}
+	for (unsigned int c = 0; c < l.nchan; c++) {
+	    float *p = proc.inpdata(c);
+	    for (unsigned int i = 0; i < l.quantum; i++) {
+		p[i] = (i & 1) ? 0.25 : -0.25;
+	    }
+	}
+	if (!paced) {
+	    proc.process(true);
+	    continue;
+	}
+	struct timespec a, b;
+	clock_gettime(CLOCK_MONOTONIC, &a);
+	int f = proc.process(false);
+	clock_gettime(CLOCK_MONOTONIC, &b);
+	if (n >= warmup) {
+	    rt += elapsed(a, b);
+	    if (f) {
+		cost.late = true;
+	    }
+	}
+	if (f & Convproc::FL_LOAD) {
+	    // stopped by Convproc, extrapolate the rt time
+	    cost.late = true;
+	    if (n > warmup) {
+		rt *= static_cast<double>(periods) / (n - warmup);
+	    }
+	    break;
+	}
+	next.tv_nsec += period_ns;
+	while (next.tv_nsec >= 1000000000) {
+	    next.tv_nsec -= 1000000000;
+	    next.tv_sec++;
+	}
+	clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &next, NULL);
+    }
+    clock_gettime(CLOCK_MONOTONIC, &t1);
+    if (paced) {
+	cost.rt = rt;
+    } else {
+	cost.total = elapsed(t0, t1);
+    }
+    return true;
+}
+
+/*
+** job thread: cost of processing bench_samples with a white noise
+** impulse response of size l.size on all channels:
+**  rt:    time spent in process(false), i.e. by the caller (the rt
+**         thread of the engine) for the first level; the calls are
+**         paced like periods at bench_rate, so that the background
+**         levels run as in the engine; late is set when they can't
+**         keep up
+**  total: time with process(true), which waits for the partition
+**         threads, so it includes all levels
+** The plans are made with FFTW_ESTIMATE and without the planner mutex
+** (the fftw planner is thread-safe), so the benchmark never keeps a
+** convolver in the engine or the gui waiting; only the relative cost
+** of the partition sizes matters here.
+** Returns false on error.
+*/
+bool ConvolverTuner::benchmark(const Layout& l, unsigned int maxpart, Cost& cost) {
+    cost.rt = cost.total = 0;
+    cost.late = false;
+    unsigned int seed = 1;
+    float *ir = new float[l.size];
+    for (unsigned int i = 0; i < l.size; i++) {
+	seed = seed * 1103515245 + 12345;
+	ir[i] = ((seed >> 16) & 0x7fff) * (1.0 / 32768) - 0.5;
+    }
+    bool ok = true;
+    for (int paced = 0; paced < 2 && ok; paced++) {
+	Convproc proc;
+	proc.set_options(0);
+#if ZITA_CONVOLVER_VERSION == 4
+	int rc = proc.configure(l.nchan, l.nchan, l.size, l.quantum, l.minpart, maxpart, 0.0);
+#else
+	int rc = proc.configure(l.nchan, l.nchan, l.size, l.quantum, l.minpart, maxpart);
+#endif
+	if (rc) {
+	    ok = false;
+	    break;
+	}
+	for (unsigned int c = 0; c < l.nchan && !rc; c++) {
+	    rc = proc.impdata_create(c, c, 1, ir, 0, l.size);
+	}
+	if (rc || proc.start_process(0, SCHED_OTHER)) {
+	    ok = false;
+	} else {
+	    ok = run(proc, l, maxpart, paced, cost);
+	    proc.stop_process();
+	    while (!proc.check_stop()) {
+		usleep(1000);
+	    }
+	}
+	proc.cleanup();
+    }
+    delete[] ir;
+    return ok;
+}
+
+static double median(std::vector<double>& v) {
+    std::sort(v.begin(), v.end());
+    return v[v.size() / 2];
+}
+
+/*
+** job thread: try maxpart from the largest useful size (not above
+** the impulse response size) downwards. Each candidate is measured
+** bench_runs times and the medians are compared (the engine might
+** be running meanwhile). The cheapest rt side wins, layouts whose
+** background levels are late are only used when all are; equal rt
+** times (non-uniform layouts have the same first level) are
+** decided by the total time. The total cost is usually minimal at
+** one size and grows to both sides, so stop when it gets clearly
+** worse than the best. Returns 0 when no candidate worked.
+*/
+unsigned int ConvolverTuner::tune(const Layout& l) {
+    unsigned int top = min(static_cast<unsigned int>(Convproc::MAXPART), max(l.minpart, l.size));
+    unsigned int best_part = 0;
+    Cost best;
+    for (unsigned int part = top; part >= l.minpart; part /= 2) {
+	std::vector<double> rt, total;
+	bool late = false;
+	for (int r = 0; r < bench_runs; r++) {
+	    if (gx_system::atomic_get(stop)) {
+		return 0;
+	    }
+	    Cost c;
+	    if (benchmark(l, part, c)) {
+		rt.push_back(c.rt);
+		total.push_back(c.total);
+		late = late || c.late;
+	    }
+	}
+	if (rt.empty()) {
+	    continue;
+	}
+	Cost c;
+	c.rt = median(rt);
+	c.total = median(total);
+	c.late = late;
+	bool better;
+	if (!best_part || c.late != best.late) {
+	    better = !best_part || best.late;
+	} else if (c.rt < best.rt * (1 - bench_tie)) {
+	    better = true;
+	} else if (c.rt > best.rt * (1 + bench_tie)) {
+	    better = false;
+	} else {
+	    better = c.total < best.total;
+	}
+	if (better) {
+	    best = c;
+	    best_part = part;
+	} else if (c.total > bench_stop * best.total) {
+	    break;
+	}
+    }
+    return best_part;
+}
+
+void *ConvolverTuner::run_thread(void *p) {
+    ConvolverTuner& self = *static_cast<ConvolverTuner*>(p);
+    // don't compete with the engine (linux: only this thread and
+    // the partition threads it starts)
+    setpriority(PRIO_PROCESS, 0, 10);
+    while (true) {
+	sem_wait(&self.sem);
+	while (true) {
+	    if (gx_system::atomic_get(self.stop)) {
+		return NULL;
+	    }
+	    Layout l(0, 0, 0, 0);
+	    {
+		boost::mutex::scoped_lock lock(self.mutex);
+		if (self.pending.empty()) {
+		    break;
+		}
+		l = self.pending.front();
+	    }
+	    unsigned int part = self.tune(l);
+	    if (gx_system::atomic_get(self.stop)) {
+		return NULL;
+	    }
+	    boost::mutex::scoped_lock lock(self.mutex);
+	    self.profile[l] = part;
+	    self.profile_changed = true;
+	    self.pending.pop_front();
+	}
+	self.save();
+    }
+    return NULL;
+}
+
+} // end namespace gx_engine
@@ -0,0 +1,675 @@
+/*
+ * Copyright (C) 2009, 2010 Hermann Meyer, James Warden, Andreas Degert
+ * Copyright (C) 2011 Pete Shorthose
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ * --------------------------------------------------------------------------
+ *
+ *  runtime DK-method circuit simulation: loads circuit descriptions
+ *  (.dkc files) and runs them as mono plugins
+ *
+ * --------------------------------------------------------------------------
+ */
+
+#include "engine.h"             // NOLINT
+
+namespace gx_engine {
+
+/****************************************************************
+ ** struct DKSpline
+ */
+
+static void read_array(gx_system::JsonParser& jp, std::vector<double>& a) {
+    a.clear();
+    jp.next(gx_system::JsonParser::begin_array);
+    while (jp.peek() != gx_system::JsonParser::end_array) {
+	jp.next(gx_system::JsonParser::value_number);
+	a.push_back(jp.current_value_double());
+    }
+    jp.next(gx_system::JsonParser::end_array);
+}
+
+static void read_int_array(gx_system::JsonParser& jp, int *a, int maxlen, int& len) {
+    len = 0;
+    jp.next(gx_system::JsonParser::begin_array);
+    while (jp.peek() != gx_system::JsonParser::end_array) {
+	jp.next(gx_system::JsonParser::value_number);
+	if (len < maxlen) {
+	    a[len] = jp.current_value_int();
+	}
+	len++;
+    }
+    jp.next(gx_system::JsonParser::end_array);
+}
+
+void DKSpline::readJSON(gx_system::JsonParser& jp) {
+    int nk = 0, nt = 0;
+    jp.next(gx_system::JsonParser::begin_object);
+    while (jp.peek() != gx_system::JsonParser::end_object) {
+	jp.next(gx_system::JsonParser::value_key);
+	if (jp.read_kv("output", out)) {
+	} else if (jp.current_value() == "inputs") {
+	    read_int_array(jp, inp, 2, ninp);
+	} else if (jp.current_value() == "degree") {
+	    read_int_array(jp, k, 2, nk);
+	} else if (jp.current_value() == "knots") {
+	    jp.next(gx_system::JsonParser::begin_array);
+	    while (jp.peek() != gx_system::JsonParser::end_array) {
+		std::vector<double> dummy;
+		read_array(jp, nt < 2 ? t[nt] : dummy);
+		nt++;
+	    }
+	    jp.next(gx_system::JsonParser::end_array);
+	} else if (jp.current_value() == "coeffs") {
+	    read_array(jp, c);
+	} else {
+	    gx_print_warning("DK circuit", "unknown spline key: " + jp.current_value());
+	    jp.skip_object();
+	}
+    }
+    jp.next(gx_system::JsonParser::end_object);
+    if (nk != ninp || nt != ninp) {
+	ninp = 0; // rejected by check()
+    }
+    for (int d = 0; d < ninp && d < 2; d++) {
+	k[d] += 1; // degree -> order
+	n[d] = t[d].size() - k[d];
+    }
+}
+
+bool DKSpline::check(int nn) const {
+    if (ninp < 1 || ninp > 2 || out < 0 || out >= nn) {
+	return false;
+    }
+    int nc = 1;
+    for (int d = 0; d < ninp; d++) {
+	if (inp[d] < 0 || inp[d] >= nn || k[d] < 1 || k[d] > max_order || n[d] < k[d]) {
+	    return false;
+	}
+	for (unsigned int j = 1; j < t[d].size(); j++) {
+	    if (t[d][j] < t[d][j-1]) {
+		return false;
+	    }
+	}
+	nc *= n[d];
+    }
+    // splrep pads c with k zeros
+    return static_cast<int>(c.size()) >= nc;
+}
+
+/****************************************************************
+ ** class DKCircuitDesc
+ */
+
+DKCircuitDesc::DKCircuitDesc()
+    : id(),
+      name(),
+      category("Distortion"),
+      description(),
+      shortname(),
+      samplerate(96000),
+      nx(-1),
+      ni(-1),
+      no(-1),
+      nn(-1),
+      maxiter(10),
+      tol(1e-6),
+      Mx(),
+      Mo(),
+      Mpk(),
+      CZ(),
+      x0(),
+      v0(),
+      nonlin(),
+      pots(),
+      Q(),
+      Uxl(),
+      Uo(),
+      Unl(),
+      UR(),
+      shape() {
+}
+
+// matrices are written row by row (numpy tolist()), stored
+// column-major
+void DKCircuitDesc::read_matrix(gx_system::JsonParser& jp, const std::string& key, std::vector<double>& m) {
+    std::vector<std::vector<double> > rows;
+    jp.next(gx_system::JsonParser::begin_array);
+    while (jp.peek() != gx_system::JsonParser::end_array) {
+	rows.push_back(std::vector<double>());
+	read_array(jp, rows.back());
+    }
+    jp.next(gx_system::JsonParser::end_array);
+    int nr = rows.size();
+    int nc = nr ? rows[0].size() : 0;
+    m.resize(nr * nc);
+    for (int i = 0; i < nr; i++) {
+	if (static_cast<int>(rows[i].size()) != nc) {
+	    nc = -1; // rejected by check_shape()
+	    break;
+	}
+	for (int j = 0; j < nc; j++) {
+	    m[j*nr+i] = rows[i][j];
+	}
+    }
+    shape[key] = std::make_pair(nr, nc);
+}
+
+void DKCircuitDesc::readJSON(gx_system::JsonParser& jp) {
+    jp.next(gx_system::JsonParser::begin_object);
+    while (jp.peek() != gx_system::JsonParser::end_object) {
+	jp.next(gx_system::JsonParser::value_key);
+	if (jp.read_kv("id", id) ||
+	    jp.read_kv("name", name) ||
+	    jp.read_kv("category", category) ||
+	    jp.read_kv("description", description) ||
+	    jp.read_kv("shortname", shortname) ||
+	    jp.read_kv("samplerate", samplerate) ||
+	    jp.read_kv("nx", nx) ||
+	    jp.read_kv("ni", ni) ||
+	    jp.read_kv("no", no) ||
+	    jp.read_kv("nn", nn) ||
+	    jp.read_kv("maxiter", maxiter) ||
+	    jp.read_kv("tol", tol)) {
+	} else if (jp.current_value() == "Mx") {
+	    read_matrix(jp, "Mx", Mx);
+	} else if (jp.current_value() == "Mo") {
+	    read_matrix(jp, "Mo", Mo);
+	} else if (jp.current_value() == "Mpk") {
+	    read_matrix(jp, "Mpk", Mpk);
+	} else if (jp.current_value() == "Q") {
+	    read_matrix(jp, "Q", Q);
+	} else if (jp.current_value() == "Uxl") {
+	    read_matrix(jp, "Uxl", Uxl);
+	} else if (jp.current_value() == "Uo") {
+	    read_matrix(jp, "Uo", Uo);
+	} else if (jp.current_value() == "Unl") {
+	    read_matrix(jp, "Unl", Unl);
+	} else if (jp.current_value() == "UR") {
+	    read_matrix(jp, "UR", UR);
+	} else if (jp.current_value() == "CZ") {
+	    read_array(jp, CZ);
+	} else if (jp.current_value() == "x0") {
+	    read_array(jp, x0);
+	} else if (jp.current_value() == "v0") {
+	    read_array(jp, v0);
+	} else if (jp.current_value() == "nonlin") {
+	    jp.next(gx_system::JsonParser::begin_array);
+	    while (jp.peek() != gx_system::JsonParser::end_array) {
+		nonlin.push_back(DKSpline());
+		nonlin.back().readJSON(jp);
+	    }
+	    jp.next(gx_system::JsonParser::end_array);
+	} else if (jp.current_value() == "pots") {
+	    jp.next(gx_system::JsonParser::begin_array);
+	    while (jp.peek() != gx_system::JsonParser::end_array) {
+		DKPot pot;
+		jp.next(gx_system::JsonParser::begin_object);
+		while (jp.peek() != gx_system::JsonParser::end_object) {
+		    jp.next(gx_system::JsonParser::value_key);
+		    if (jp.read_kv("id", pot.id) ||
+			jp.read_kv("name", pot.name) ||
+			jp.read_kv("value", pot.value)) {
+		    } else {
+			gx_print_warning("DK circuit", "unknown pot key: " + jp.current_value());
+			jp.skip_object();
+		    }
+		}
+		jp.next(gx_system::JsonParser::end_object);
+		pots.push_back(pot);
+	    }
+	    jp.next(gx_system::JsonParser::end_array);
+	} else if (jp.current_value() == "resistors") {
+	    jp.next(gx_system::JsonParser::begin_array);
+	    while (jp.peek() != gx_system::JsonParser::end_array) {
+		DKResistor res;
+		jp.next(gx_system::JsonParser::begin_object);
+		while (jp.peek() != gx_system::JsonParser::end_object) {
+		    jp.next(gx_system::JsonParser::value_key);
+		    if (jp.read_kv("pot", res.pot) ||
+			jp.read_kv("R", res.R)) {
+		    } else if (jp.current_value() == "taper") {
+			read_array(jp, res.taper);
+		    } else {
+			gx_print_warning("DK circuit", "unknown resistor key: " + jp.current_value());
+			jp.skip_object();
+		    }
+		}
+		jp.next(gx_system::JsonParser::end_object);
+		resistors.push_back(res);
+	    }
+	    jp.next(gx_system::JsonParser::end_array);
+	} else {
+	    gx_print_warning("DK circuit", "unknown key: " + jp.current_value());
+	    jp.skip_object();
+	}
+    }
+    jp.next(gx_system::JsonParser::end_object);
+}
+
+bool DKCircuitDesc::check_shape(const std::string& key, const std::vector<double>& m, int rows, int cols) {
+    if (rows == 0 || cols == 0) {
+	if (m.empty()) {
+	    return true;
+	}
+    } else {
+	std::map<std::string, std::pair<int, int> >::iterator i = shape.find(key);
+	if (i != shape.end() && i->second.first == rows && i->second.second == cols) {
+	    return true;
+	}
+    }
+    gx_print_error(
+	"DK circuit",
+	boost::format(_("%1%: matrix %2% must have %3% x %4% elements"))
+	% id % key % rows % cols);
+    return false;
+}
+
+bool DKCircuitDesc::check() {
+    if (id.empty() || nx < 0 || ni < 0 || no < 0 || nn < 0 || samplerate <= 0 || maxiter < 1) {
+	gx_print_error("DK circuit", _("missing or bad id, dimensions or solver parameters"));
+	return false;
+    }
+    if (name.empty()) {
+	name = id;
+    }
+    if (shortname.empty()) {
+	shortname = name;
+    }
+    if (x0.empty()) {
+	x0.resize(nx);
+    }
+    if (v0.empty()) {
+	v0.resize(nn);
+    }
+    if (CZ.empty()) {
+	CZ.resize(nn, 1.0);
+    }
+    int np = resistors.size();
+    if (!check_shape("Mx", Mx, nx, nz()) ||
+	!check_shape("Mo", Mo, no, nz()) ||
+	!check_shape("Mpk", Mpk, nn, nz()) ||
+	!check_shape("Q", Q, np, np) ||
+	!check_shape("Uxl", Uxl, nx, np) ||
+	!check_shape("Uo", Uo, no, np) ||
+	!check_shape("Unl", Unl, nn, np) ||
+	!check_shape("UR", UR, np, nz())) {
+	return false;
+    }
+    if (static_cast<int>(x0.size()) != nx || static_cast<int>(v0.size()) != nn ||
+	static_cast<int>(CZ.size()) != nn) {
+	gx_print_error("DK circuit", boost::format(_("%1%: bad size of x0, v0 or CZ")) % id);
+	return false;
+    }
+    std::vector<bool> used(nn);
+    for (unsigned int j = 0; j < nonlin.size(); j++) {
+	if (!nonlin[j].check(nn) || used[nonlin[j].out]) {
+	    gx_print_error("DK circuit", boost::format(_("%1%: bad nonlinear function %2%")) % id % j);
+	    return false;
+	}
+	used[nonlin[j].out] = true;
+    }
+    for (unsigned int j = 0; j < pots.size(); j++) {
+	if (pots[j].id.empty()) {
+	    gx_print_error("DK circuit", boost::format(_("%1%: potentiometer %2% has no id")) % id % j);
+	    return false;
+	}
+    }
+    for (int j = 0; j < np; j++) {
+	const DKResistor& r = resistors[j];
+	if (r.pot < 0 || r.pot >= static_cast<int>(pots.size()) || r.R <= 0 || r.taper.size() < 2) {
+	    gx_print_error("DK circuit", boost::format(_("%1%: bad variable resistor %2%")) % id % j);
+	    return false;
+	}
+    }
+    return true;
+}
+
+DKCircuitDesc *DKCircuitDesc::load(const std::string& fname) {
+    std::ifstream is(fname.c_str());
+    if (is.fail()) {
+	gx_print_error("DK circuit", boost::format(_("can't open %1%")) % fname);
+	return 0;
+    }
+    DKCircuitDesc *d = new DKCircuitDesc();
+    try {
+	gx_system::JsonParser jp(&is);
+	d->readJSON(jp);
+	jp.close();
+    } catch (gx_system::JsonException& e) {
+	gx_print_error(
+	    "DK circuit",
+	    boost::format(_("error reading %1%: %2%")) % fname % e.what());
+	delete d;
+	return 0;
+    }
+    if (!d->check()) {
+	gx_print_error("DK circuit", boost::format(_("%1% not loaded")) % fname);
+	delete d;
+	return 0;
+    }
+    return d;
+}
+
+/****************************************************************
+ ** class DKCircuit
+ */
+
+DKCircuit::DKCircuit(DKCircuitDesc *desc_)
+    : PluginDef(),
+      desc(desc_),
+      param_ids(),
+      pots(),
+      pots_last(),
+      mx(desc->Mx),
+      mo(desc->Mo),
+      mpk(desc->Mpk),
+      z(desc->nz()),
+      xn(desc->nx),
+      v(desc->nn),
+      p(desc->nn),
+      r(desc->nn),
+      df(2 * desc->nonlin.size()),
+      jac(desc->nn * desc->nn),
+      tmp(),
+      process_kernel(),
+      failed(0),
+      resamp(false),
+      smp() {
+    version = PLUGINDEF_VERSION;
+    flags = 0;
+    id = desc->id.c_str();
+    name = desc->name.c_str();
+    groups = 0;
+    description = desc->description.c_str();
+    category = desc->category.c_str();
+    shortname = desc->shortname.c_str();
+    mono_audio = process;
+    set_samplerate = init;
+    register_params = registerparam;
+    load_ui = uiloader;
+    delete_instance = del_instance;
+    for (unsigned int j = 0; j < desc->pots.size(); j++) {
+	param_ids.push_back(desc->id + "." + desc->pots[j].id);
+	pots.push_back(desc->pots[j].value);
+    }
+    pots_last.resize(pots.size(), -1);
+    int np = desc->resistors.size();
+    // Woodbury: 2 matrices np x np, T, one column of the result
+    tmp.resize(2 * np * np + np * desc->nz() + std::max(desc->nx, std::max(desc->no, desc->nn)));
+    // specialized kernels for the dimensions of hot models
+    // (nx, nn); add an entry for a new model if it's worth it
+    static const struct {
+	int nx, nn;
+	kernel fn;
+    } kernels[] = {
+	{ 2, 2, &process_block<2, 2> },
+	{ 3, 2, &process_block<3, 2> },
+	{ 4, 2, &process_block<4, 2> },
+	{ 4, 4, &process_block<4, 4> },
+	{ 6, 3, &process_block<6, 3> },
+    };
+    process_kernel = &process_block<0, 0>;
+    for (unsigned int j = 0; j < sizeof(kernels)/sizeof(kernels[0]); j++) {
+	if (kernels[j].nx == desc->nx && kernels[j].nn == desc->nn) {
+	    process_kernel = kernels[j].fn;
+	    break;
+	}
+    }
+    reset();
+}
+
+DKCircuit::~DKCircuit() {
+    delete desc;
+}
+
+DKCircuit *DKCircuit::create(const std::string& fname) {
+    DKCircuitDesc *d = DKCircuitDesc::load(fname);
+    if (!d) {
+	return 0;
+    }
+    if (d->ni != 1 || d->no != 1) {
+	gx_print_error(
+	    "DK circuit",
+	    boost::format(_("%1%: only circuits with 1 input and 1 output are supported")) % fname);
+	delete d;
+	return 0;
+    }
+    return new DKCircuit(d);
+}
+
+void DKCircuit::reset() {
+    std::copy(desc->x0.begin(), desc->x0.end(), z.begin());
+    z[desc->nx] = 0;
+    z[desc->nx+1] = 1;
+    std::fill(z.begin() + desc->nx + 2, z.end(), 0.0);
+    v = desc->v0;
+}
+
+// Woodbury update of the matrices for new pot values; called in
+// the rt thread, the work is O(np^3 + np * nz * (nx + no + nn))
+void DKCircuit::update_matrices() {
+    const DKCircuitDesc& d = *desc;
+    const int np = d.resistors.size();
+    const int nz = d.nz();
+    double *a = tmp.data();
+    double *a2 = a + np * np;
+    double *t = a2 + np * np;
+    double *col = t + np * nz;
+    std::copy(d.Q.begin(), d.Q.end(), a);
+    for (int j = 0; j < np; j++) {
+	a[j*np+j] += d.resistors[j].value(pots[d.resistors[j].pot]);
+    }
+    std::copy(d.UR.begin(), d.UR.end(), t);
+    for (int c = 0; c < nz; c++) {
+	std::copy(a, a + np * np, a2);
+	if (!dk_solve<0>(np, a2, t + c * np)) {
+	    return; // keep the current matrices
+	}
+    }
+    const struct {
+	int rows;
+	const double *base;
+	const double *u;
+	double *out;
+    } upd[] = {
+	{ d.nx, d.Mx.data(), d.Uxl.data(), mx.data() },
+	{ d.no, d.Mo.data(), d.Uo.data(), mo.data() },
+	{ d.nn, d.Mpk.data(), d.Unl.data(), mpk.data() },
+    };
+    for (unsigned int m = 0; m < sizeof(upd)/sizeof(upd[0]); m++) {
+	const int rows = upd[m].rows;
+	if (!rows) {
+	    continue;
+	}
+	for (int c = 0; c < nz; c++) {
+	    dk_matvec<0, 0>(rows, np, upd[m].u, t + c * np, col);
+	    for (int i = 0; i < rows; i++) {
+		upd[m].out[c*rows+i] = upd[m].base[c*rows+i] - col[i];
+	    }
+	}
+    }
+}
+
+// Newton iteration for v, leaves i(v) in z; false if not
+// converged
+template <int NX, int NN>
+inline bool DKCircuit::solve() {
+    const DKCircuitDesc& d = *desc;
+    const int nx = NX ? NX : d.nx;
+    const int nn = NN ? NN : d.nn;
+    const int ns = d.nonlin.size();
+    const DKSpline *sp = d.nonlin.data();
+    const double *cz = d.CZ.data();
+    const double *K = &mpk[(nx+2)*nn];
+    double *i = &z[nx+2];
+    double *vv = v.data();
+    double *rr = r.data();
+    double *pp = p.data();
+    double *dd = df.data();
+    double *jj = jac.data();
+    for (int it = 0; it < d.maxiter; it++) {
+	for (int s = 0; s < ns; s++) {
+	    i[sp[s].out] = sp[s].eval(vv, &dd[2*s]);
+	}
+	// rr = -(p + K * i - CZ .* v)
+	dk_matvec<NN, NN>(nn, nn, K, i, rr);
+	for (int m = 0; m < nn; m++) {
+	    rr[m] = cz[m] * vv[m] - pp[m] - rr[m];
+	}
+	// jacobian K * di/dv - diag(CZ)
+	for (int m = 0; m < nn * nn; m++) {
+	    jj[m] = 0;
+	}
+	for (int m = 0; m < nn; m++) {
+	    jj[m*nn+m] = -cz[m];
+	}
+	for (int s = 0; s < ns; s++) {
+	    const double *kc = K + sp[s].out * nn;
+	    for (int e = 0; e < sp[s].ninp; e++) {
+		const double g = dd[2*s+e];
+		double *jc = jj + sp[s].inp[e] * nn;
+		for (int m = 0; m < nn; m++) {
+		    jc[m] += kc[m] * g;
+		}
+	    }
+	}
+	if (!dk_solve<NN>(nn, jj, rr)) {
+	    return false;
+	}
+	double err = 0;
+	for (int m = 0; m < nn; m++) {
+	    vv[m] += rr[m];
+	    err = std::max(err, fabs(rr[m]));
+	}
+	if (err < d.tol) {
+	    for (int s = 0; s < ns; s++) {
+		i[sp[s].out] = sp[s].eval(vv, &dd[2*s]);
+	    }
+	    return true;
+	}
+    }
+    return false;
+}
+
+template <int NX, int NN>
+void DKCircuit::process_block(DKCircuit& self, int count, float *buf) {
+    const DKCircuitDesc& d = *self.desc;
+    const int nx = NX ? NX : d.nx;
+    const int nn = NN ? NN : d.nn;
+    const int nz = nx + 2 + nn;
+    double *z = self.z.data();
+    double *xn = self.xn.data();
+    const double *mx = self.mx.data();
+    const double *mo = self.mo.data();
+    const double *mpk = self.mpk.data();
+    for (int j = 0; j < count; j++) {
+	z[nx] = buf[j];
+	if (nn) {
+	    dk_matvec<NN, (NX ? NX + 2 : 0)>(nn, nx + 2, mpk, z, self.p.data());
+	    if (!self.solve<NX, NN>()) {
+		self.failed++;
+	    }
+	}
+	double o = 0;
+	for (int c = 0; c < nz; c++) {
+	    o += mo[c] * z[c];
+	}
+	if (nx) {
+	    dk_matvec<NX, (NX && NN ? NX + 2 + NN : 0)>(nx, nz, mx, z, xn);
+	    for (int m = 0; m < nx; m++) {
+		z[m] = xn[m];
+	    }
+	}
+	if (!std::isfinite(o)) {
+	    self.reset();
+	    o = 0;
+	}
+	buf[j] = o;
+    }
+}
+
+void DKCircuit::init(unsigned int samplingFreq, PluginDef *plugin) {
+    DKCircuit& self = *static_cast<DKCircuit*>(plugin);
+    if (self.failed) {
+	gx_print_warning(
+	    "DK circuit",
+	    boost::format(_("%1%: solver did not converge for %2% samples"))
+	    % self.id % self.failed);
+	self.failed = 0;
+    }
+    self.resamp = (static_cast<int>(samplingFreq) != self.desc->samplerate);
+    if (self.resamp) {
+	self.smp.setup(samplingFreq, self.desc->samplerate);
+    }
+    std::fill(self.pots_last.begin(), self.pots_last.end(), -1);
+    self.reset();
+}
+
+void DKCircuit::process(int count, float *input, float *output, PluginDef *plugin) {
+    DKCircuit& self = *static_cast<DKCircuit*>(plugin);
+    if (self.pots != self.pots_last) {
+	self.pots_last = self.pots;
+	self.update_matrices();
+    }
+    int n = count;
+    float *buf = static_cast<float*>(
+	alloca((self.resamp ? self.smp.max_out_count(count) : count) * sizeof(float)));
+    if (self.resamp) {
+	n = self.smp.up(count, input, buf);
+    } else {
+	memcpy(buf, input, count * sizeof(float));
+    }
+    self.process_kernel(self, n, buf);
+    if (self.resamp) {
+	self.smp.down(buf, output);
+    } else {
+	memcpy(output, buf, count * sizeof(float));
+    }
+}
+
+int DKCircuit::registerparam(const ParamReg& reg) {
+    DKCircuit& self = *static_cast<DKCircuit*>(reg.plugin);
+    for (unsigned int j = 0; j < self.pots.size(); j++) {
+	reg.registerFloatVar(
+	    self.param_ids[j].c_str(), self.desc->pots[j].name.c_str(), "S", "",
+	    &self.pots[j], self.desc->pots[j].value, 0, 1, 0.01, 0);
+    }
+    return 0;
+}
+
+int DKCircuit::uiloader(const UiBuilder& b, int form) {
+    if (!(form & UI_FORM_STACK)) {
+	return -1;
+    }
+    DKCircuit& self = *static_cast<DKCircuit*>(b.plugin);
+    b.openHorizontalhideBox("");
+    if (!self.pots.empty()) {
+	b.create_master_slider(self.param_ids[0].c_str(), self.desc->pots[0].name.c_str());
+    }
+    b.closeBox();
+    b.openHorizontalBox("");
+    for (unsigned int j = 0; j < self.pots.size(); j++) {
+	b.create_mid_rackknob(self.param_ids[j].c_str(), self.desc->pots[j].name.c_str());
+    }
+    b.closeBox();
+    return 0;
+}
+
+void DKCircuit::del_instance(PluginDef *p) {
+    delete static_cast<DKCircuit*>(p);
+}
+
+} // end namespace gx_engine
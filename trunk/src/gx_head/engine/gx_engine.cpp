@@ -263,7 +263,7 @@ GxEngine::GxEngine(const string& plugin_dir, ParameterGroups& groups, const gx_s
     : ModuleSequencer(),
       resamp(),
       plugin_changed(),
-      ladspaloader(options, get_param()),
+      ladspaloader(options, *this, get_param()),
       controller_map(),
       // ModuleSelector's
       crybaby(
@@ -305,7 +305,11 @@ GxEngine::GxEngine(const string& plugin_dir, ParameterGroups& groups, const gx_s
 #ifndef GUITARIX_AS_PLUGIN
       record(*this, 1), record_st(*this, 2),
 #endif
-      dseq(*this, sigc::mem_fun(mono_chain, &MonoModuleChain::sync)),
+#ifndef GUITARIX_AS_PLUGIN
+      dseq(*this, sigc::mem_fun(mono_chain, &MonoModuleChain::sync), &drumout),
+#else
+      dseq(*this, sigc::mem_fun(mono_chain, &MonoModuleChain::sync), 0),
+#endif
       detune(*this, sigc::mem_fun(mono_chain, &MonoModuleChain::sync)) {
     set_overload_interval(options.get_sporadic_overload());
     if (!options.get_convolver_watchdog()) {
@@ -320,6 +324,11 @@ GxEngine::GxEngine(const string& plugin_dir, ParameterGroups& groups, const gx_s
     if (options.get_mute()) {
         set_state(kEngineOff);;
     }
+#ifndef GUITARIX_AS_PLUGIN
+    rt_trace.init(options.get_user_filepath("rttrace"));
+    FFTPlanner::getInstance().init(options.get_user_filepath("fftw-wisdom"));
+    ConvolverTuner::getInstance().init(options.get_user_filepath("convolver-profile"));
+#endif
 #ifdef USE_MIDI_OUT
     tuner.set_dep_module(&midiaudiobuffer.plugin);
 #endif
@@ -330,6 +339,9 @@ GxEngine::GxEngine(const string& plugin_dir, ParameterGroups& groups, const gx_s
 	pluginlist.load_from_path(plugin_dir, PLUGIN_POS_RACK);
     }
 
+    // LADSPA / LV2 plugins only get their descriptor and parameters
+    // here, the plugin instance is created when a chain activates the
+    // plugin (from the rack or from a preset that switches it on)
     for (unsigned int i = 0; i < ladspaloader.size(); ++i) {
 	PluginDef *p = ladspaloader.create(i);
 	if (p) {
@@ -356,6 +368,11 @@ GxEngine::~GxEngine() {
     pluginlist.cleanup();
 }
 
+// The built-in modules are still constructed eagerly: their
+// parameters are registered from member variables of the dsp object,
+// so the object must exist before a preset, the UI or a MIDI
+// controller can reference a parameter. Modules with large buffers
+// allocate them only in activate(true).
 void GxEngine::load_static_plugins() {
     PluginList& pl = pluginlist; // just a shortcut
 
@@ -392,7 +409,7 @@ void GxEngine::load_static_plugins() {
     pl.add(fizz_remover::plugin(),                PLUGIN_POS_END, PGN_GUI);
     pl.add(hardlim::plugin(),                     PLUGIN_POS_END, PGN_MODE_NORMAL);
 #ifndef GUITARIX_AS_PLUGIN
-    pl.add(&drumout.outputdrum,                   PLUGIN_POS_END, PGN_MODE_NORMAL);
+    pl.add(&drumout,                              PLUGIN_POS_END, PGN_MODE_NORMAL);
 #endif
     pl.add(&directout,                            PLUGIN_POS_END, PGN_MODE_NORMAL);
     pl.add(&maxlevel,                             PLUGIN_POS_END, PGN_MODE_NORMAL|PGN_MODE_BYPASS);
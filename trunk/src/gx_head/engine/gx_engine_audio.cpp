@@ -38,6 +38,9 @@ ProcessingChainBase::ProcessingChainBase():
     ramp_value(0),
     ramp_mode(ramp_mode_down_dead),
     stopped(true),
+    fault_pending(0),
+    fault_notify(0),
+    trace(0),
     steps_up(),
     steps_up_dead(),
     steps_down(),
@@ -270,6 +273,14 @@ bool ProcessingChainBase::set_plugin_list(const list<Plugin*> &p) {
 	}
     }
     modules = p;
+    // a plugin can fault and leave the chain before the recovery
+    // ran; it would be skipped forever when it comes back
+    for (list<Plugin*>::const_iterator i = modules.begin(); i != modules.end(); ++i) {
+	if ((*i)->is_faulted()) {
+	    notify_fault();
+	    break;
+	}
+    }
     return true;
 }
 
@@ -284,10 +295,23 @@ void ProcessingChainBase::clear_module_states() {
     }
 }
 
+// ui thread: reset the plugins the rt thread stopped because of
+// non-finite output
+void ProcessingChainBase::recover_faults(std::vector<std::pair<std::string,bool> >& recovered) {
+    gx_system::atomic_set(&fault_pending, 0);
+    for (list<Plugin*>::const_iterator p = modules.begin(); p != modules.end(); ++p) {
+	if ((*p)->is_faulted()) {
+	    bool ok = (*p)->recover_fault();
+	    recovered.push_back(std::pair<std::string,bool>((*p)->get_pdef()->id, !ok));
+	}
+    }
+}
+
 void ProcessingChainBase::release() {
     wait_latch();
     for (list<Plugin*>::const_iterator p = to_release.begin(); p != to_release.end(); ++p) {
 	(*p)->get_pdef()->activate_plugin(false, (*p)->get_pdef());
+	(*p)->clear_fault();  // state is gone with the deactivation
     }
     to_release.clear();
 }
@@ -306,6 +330,21 @@ void ProcessingChainBase::print_chain_state(const char *title) {
  ** MonoModuleChain, StereoModuleChain
  */
 
+// Only every 16th sample (counted from the end of the block) is
+// checked: NaN and Inf from a runaway feedback path spread over the
+// whole buffer within a few samples, so this catches them at a
+// fraction of the cost of a full scan. Bit test instead of isfinite()
+// so it survives -ffast-math.
+static inline bool __rt_func block_is_finite(int count, const float *buf) {
+    union { float f; uint32_t i; } v;
+    uint32_t bad = 0;
+    for (int i = count-1; i >= 0; i -= 16) {
+	v.f = buf[i];
+	bad |= ((v.i & 0x7f800000) == 0x7f800000);
+    }
+    return !bad;
+}
+
 void __rt_func MonoModuleChain::process(int count, float *input, float *output) {
     RampMode rm = get_ramp_mode();
     if (rm == ramp_mode_down_dead) {
@@ -313,8 +352,30 @@ void __rt_func MonoModuleChain::process(int count, float *input, float *output)
 	return;
     }
     memcpy(output, input, count*sizeof(float));
-    for (monochain_data *p = get_rt_chain(); p->func; ++p) {
+    RtTrace::Record *tr = trace ? trace->current() : 0;
+    int n = 0;
+    gint64 t0 = tr ? RtTrace::now() : 0;
+    for (monochain_data *p = get_rt_chain(); p->func; ++p, ++n) {
+	if (p->owner->is_faulted()) {
+	    if (tr && n < RtTrace::max_plugins) {
+		tr->mono_plugin_ns[n] = 0;
+	    }
+	    continue;  // bypassed until the state has been reset
+	}
 	p->func(count, output, output, p->plugin);
+	if (!block_is_finite(count, output)) {
+	    memset(output, 0, count*sizeof(float));
+	    report_fault(p->owner);
+	}
+	if (tr && n < RtTrace::max_plugins) {
+	    gint64 t1 = RtTrace::now();
+	    tr->mono_plugin_ns[n] = t1 - t0;
+	    t0 = t1;
+	}
+    }
+    if (tr) {
+	tr->mono_plugins = min(n, static_cast<int>(RtTrace::max_plugins));
+	tr->mono_ramp = rm;
     }
     if (rm == ramp_mode_off) {
 	return;
@@ -384,11 +445,42 @@ void __rt_func StereoModuleChain::process(int count, float *input1, float *input
     for (stereochain_data *p = get_rt_chain(); p->func; ++p) {
 		if (!feed)
             { feed = true; continue; }//max:
+		if (p->owner->is_faulted()) {
+		    continue;
+		}
 		(p->func)(count, output1, output2, output1, output2, p->plugin);
+		if (!block_is_finite(count, output1) || !block_is_finite(count, output2)) {
+		    memset(output1, 0, count*sizeof(float));
+		    memset(output2, 0, count*sizeof(float));
+		    report_fault(p->owner);
+		}
     }
 #else
-    for (stereochain_data *p = get_rt_chain(); p->func; ++p) {
+    RtTrace::Record *tr = trace ? trace->current() : 0;
+    int n = 0;
+    gint64 t0 = tr ? RtTrace::now() : 0;
+    for (stereochain_data *p = get_rt_chain(); p->func; ++p, ++n) {
+	if (p->owner->is_faulted()) {
+	    if (tr && n < RtTrace::max_plugins) {
+		tr->stereo_plugin_ns[n] = 0;
+	    }
+	    continue;  // bypassed until the state has been reset
+	}
 	(p->func)(count, output1, output2, output1, output2, p->plugin);
+	if (!block_is_finite(count, output1) || !block_is_finite(count, output2)) {
+	    memset(output1, 0, count*sizeof(float));
+	    memset(output2, 0, count*sizeof(float));
+	    report_fault(p->owner);
+	}
+	if (tr && n < RtTrace::max_plugins) {
+	    gint64 t1 = RtTrace::now();
+	    tr->stereo_plugin_ns[n] = t1 - t0;
+	    t0 = t1;
+	}
+    }
+    if (tr) {
+	tr->stereo_plugins = min(n, static_cast<int>(RtTrace::max_plugins));
+	tr->stereo_ramp = rm;
     }
 #endif
     if (rm == ramp_mode_off) {
@@ -459,18 +551,29 @@ ModuleSelectorFromList::ModuleSelectorFromList(
       selector(0),
       select_id(select_id_),
       select_name(select_name_),
-      current_plugin(0),
       modules(),
+      instances(),
       size(),
       values(),
+      activated(false),
+      active(0),
+      fade_from(0),
+      fade_pos(0),
+      fade_len(1),
+      xfade_buf(),
       plugin() {
     version = PLUGINDEF_VERSION;
     register_params = static_register;
+    set_samplerate = init;
+    activate_plugin = activate;
+    mono_audio = process;
     plugindef_creator *p = plugins;
     for (size = 0; *p; ++p, ++size);
     modules = new PluginDef*[size];
+    instances = new PluginDef*[size];
     for (unsigned int i = 0; i < size; ++i) {
 	modules[i] = plugins[i]();
+	instances[i] = modules[i];
     }
     id = id_;
     name = name_;
@@ -486,6 +589,7 @@ ModuleSelectorFromList::~ModuleSelectorFromList() {
         modules[i]->delete_instance(modules[i]);
     }
     delete[] modules;
+    delete[] instances;
     delete[] values;
 }
 
@@ -494,12 +598,15 @@ int ModuleSelectorFromList::register_parameter(const ParamReg &param) {
     for (unsigned int i = 0; i < size; ++i) {
 	values[i].value_id = modules[i]->id;
 	values[i].value_label = modules[i]->name;
+	Plugin *pl = seq.pluginlist.lookup_plugin(modules[i]->id);
+	assert(pl && pl->get_pdef()->mono_audio);
+	instances[i] = pl->get_pdef();
     }
     values[size].value_id = 0;
     values[size].value_label = 0;
+    // a new selection is picked up by the rt thread (see
+    // process_fade()), no need to rebuild the chain
     param.registerIntVar(select_id, select_name, "S", "", &selector, 0, 0, 0, values);
-    seq.get_param()[select_id].signal_changed_int().connect(
-	sigc::hide(sigc::mem_fun(seq, &EngineControl::set_rack_changed)));
     return 0;
 }
 
@@ -508,18 +615,94 @@ int ModuleSelectorFromList::static_register(const ParamReg &param) {
 	->register_parameter(param);
 }
 
+void ModuleSelectorFromList::init(unsigned int samplingFreq, PluginDef *p) {
+    ModuleSelectorFromList& self = *static_cast<ModuleSelectorFromList*>(p);
+    self.fade_len = max(1u, samplingFreq / 50);  // 20ms
+}
+
+// called by the chain on every commit: activate and clear all
+// alternatives only when the selector enters the chain
+int ModuleSelectorFromList::activate(bool start, PluginDef *p) {
+    ModuleSelectorFromList& self = *static_cast<ModuleSelectorFromList*>(p);
+    if (start == self.activated) {
+	return 0;
+    }
+    for (unsigned int i = 0; i < self.size; ++i) {
+	PluginDef *pd = self.instances[i];
+	if (pd->activate_plugin) {
+	    if (pd->activate_plugin(start, pd) != 0 && start) {
+		while (i-- > 0) {
+		    pd = self.instances[i];
+		    if (pd->activate_plugin) {
+			pd->activate_plugin(false, pd);
+		    }
+		}
+		return -1;
+	    }
+	} else if (start && pd->clear_state) {
+	    pd->clear_state(pd);
+	}
+    }
+    self.activated = start;
+    if (start) {
+	self.active = max(0, min(self.selector, static_cast<int>(self.size)-1));
+	self.fade_pos = 0;
+    }
+    return 0;
+}
+
+// A selection change starts a linear crossfade: the old module
+// keeps running on a copy of the input until the new module
+// (with cleared state) has faded in. Changes during a fade are
+// handled when it is finished.
+inline void ModuleSelectorFromList::process_fade(int count, float *input, float *output) {
+    PluginDef *cur = instances[active];
+    if (fade_pos == 0) {
+	int sel = gx_system::atomic_get(selector);
+	if (sel == active || sel < 0 || sel >= static_cast<int>(size)) {
+	    cur->mono_audio(count, input, output, cur);
+	    return;
+	}
+	fade_from = active;
+	active = sel;
+	fade_pos = fade_len;
+	cur = instances[active];
+	if (cur->clear_state) {
+	    cur->clear_state(cur);
+	}
+    }
+    PluginDef *old = instances[fade_from];
+    int n = 0;
+    while (n < count && fade_pos > 0) {
+	int k = min(min(count - n, static_cast<int>(xfade_chunk)), fade_pos);
+	memcpy(xfade_buf, input+n, k*sizeof(float));
+	old->mono_audio(k, xfade_buf, xfade_buf, old);
+	cur->mono_audio(k, input+n, output+n, cur);
+	float *out = output+n;
+	for (int i = 0; i < k; ++i) {
+	    float g = static_cast<float>(fade_pos - i) / fade_len;
+	    out[i] = g * xfade_buf[i] + (1 - g) * out[i];
+	}
+	fade_pos -= k;
+	n += k;
+    }
+    if (n < count) {
+	cur->mono_audio(count - n, input+n, output+n, cur);
+    }
+}
+
+void __rt_func ModuleSelectorFromList::process(int count, float *input, float *output, PluginDef *p) {
+    static_cast<ModuleSelectorFromList*>(p)->process_fade(count, input, output);
+}
+
+// alternatives are only run by the selector, keep them out of
+// the chain (e.g. switched on by an old preset or state file)
 void ModuleSelectorFromList::set_module() {
-    if (plugin.get_on_off()) {
-	Plugin *old = current_plugin;
-	current_plugin = seq.pluginlist.lookup_plugin(modules[selector]->id);
-	if (old && old != current_plugin) {
-	    old->set_on_off(false);
+    for (unsigned int i = 0; i < size; ++i) {
+	Plugin *pl = seq.pluginlist.lookup_plugin(instances[i]->id);
+	if (pl->get_on_off()) {
+	    pl->set_on_off(false);
 	}
-	current_plugin->set_on_off(true);
-	current_plugin->copy_position(plugin);
-    } else if (current_plugin) {
-	current_plugin->set_on_off(false);
-	current_plugin = 0;
     }
 }
 
@@ -538,7 +721,9 @@ EngineControl::EngineControl()
       samplerate_change(),
       buffersize(0),
       samplerate(0),
-      pluginlist(*this) {
+      any_count(false),
+      pluginlist(*this),
+      tempo() {
 }
 
 EngineControl::~EngineControl() {
@@ -627,10 +812,19 @@ ModuleSequencer::ModuleSequencer()
       overload_detected(),
       overload_reason(),
       ov_disabled(0),
+      plugin_fault_detected(),
+      plugin_fault(),
+      rt_trace(),
       mono_chain(),
       stereo_chain() {
     overload_detected.connect(
 	sigc::mem_fun(this, &ModuleSequencer::check_overload));
+    plugin_fault_detected.connect(
+	sigc::mem_fun(this, &ModuleSequencer::check_plugin_faults));
+    mono_chain.set_fault_notify(&plugin_fault_detected);
+    stereo_chain.set_fault_notify(&plugin_fault_detected);
+    mono_chain.set_trace(&rt_trace);
+    stereo_chain.set_trace(&rt_trace);
 }
 
 ModuleSequencer::~ModuleSequencer() {
@@ -649,6 +843,10 @@ void ModuleSequencer::start_ramp_down() {
     stereo_chain.start_ramp_down();
 }
 
+bool ModuleSequencer::is_ramped_down() {
+    return mono_chain.is_ramped_down() && stereo_chain.is_ramped_down();
+}
+
 void ModuleSequencer::wait_ramp_down_finished() {
     mono_chain.wait_ramp_down_finished();
     stereo_chain.wait_ramp_down_finished();
@@ -741,6 +939,10 @@ void ModuleSequencer::commit_module_lists() {
 	stereo_chain.wait_ramp_down_finished();
     }
     stereo_chain.commit(stereo_chain.next_commit_needs_ramp, get_param());
+    std::vector<std::string> mono_ids, stereo_ids;
+    mono_chain.get_rt_ids(mono_ids);
+    stereo_chain.get_rt_ids(stereo_ids);
+    rt_trace.commit(mono_ids, stereo_ids);
     if (monoramp) {
 	mono_chain.start_ramp_up();
 	mono_chain.next_commit_needs_ramp = false;
@@ -754,6 +956,7 @@ void ModuleSequencer::commit_module_lists() {
 int ModuleSequencer::sporadic_interval = 0;
 
 void __rt_func ModuleSequencer::overload(OverloadType tp, const char *reason) {
+    rt_trace.trigger(tp, reason); // also when no message is wanted
     if (!(audio_mode & PGN_MODE_NORMAL)) {
 	return; // no overload message in mute/bypass modes
     }
@@ -824,6 +1027,24 @@ void ModuleSequencer::check_overload() {
     }
 }
 
+void ModuleSequencer::check_plugin_faults() {
+    std::vector<std::pair<std::string,bool> > v;
+    mono_chain.recover_faults(v);
+    stereo_chain.recover_faults(v);
+    for (std::vector<std::pair<std::string,bool> >::iterator i = v.begin(); i != v.end(); ++i) {
+	if (i->second) {
+	    gx_print_error(
+		"sentinel",
+		boost::format(_("%1%: repeated NaN/Inf output, plugin switched off")) % i->first);
+	} else {
+	    gx_print_warning(
+		"sentinel",
+		boost::format(_("%1%: NaN/Inf output, plugin state reset")) % i->first);
+	}
+	plugin_fault(i->first, i->second);
+    }
+}
+
 void ModuleSequencer::set_state(GxEngineState state) {
     int newmode = PGN_MODE_MUTE;
     switch( state ) {
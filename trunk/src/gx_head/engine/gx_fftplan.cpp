@@ -0,0 +1,273 @@
+/*
+ * Copyright (C) 2009, 2010 Hermann Meyer, James Warden, Andreas Degert
+ * Copyright (C) 2011 Pete Shorthose
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ * --------------------------------------------------------------------------
+ *
+ *  shared FFTW plans, measured in the background, persistent wisdom
+ *
+ * --------------------------------------------------------------------------
+ */
+
+#include "engine.h"             // NOLINT
+
+namespace gx_engine {
+
+/****************************************************************
+ ** class FFTPlanner
+ */
+
+FFTPlanner::Problem::Problem(Kind kind_, int n_, const void *in, const void *out)
+    : kind(kind_),
+      n(n_),
+      ialign(fftwf_alignment_of(const_cast<float*>(static_cast<const float*>(in)))),
+      oalign(fftwf_alignment_of(const_cast<float*>(static_cast<const float*>(out)))),
+      inplace(in == out) {
+}
+
+bool FFTPlanner::Problem::operator<(const Problem& p) const {
+    if (kind != p.kind) {
+	return kind < p.kind;
+    }
+    if (n != p.n) {
+	return n < p.n;
+    }
+    if (ialign != p.ialign) {
+	return ialign < p.ialign;
+    }
+    if (oalign != p.oalign) {
+	return oalign < p.oalign;
+    }
+    return inplace < p.inplace;
+}
+
+FFTPlanner::FFTPlanner()
+    : mutex(),
+      cache(),
+      refs(),
+      pending(),
+      measured(),
+      wisdom_file(),
+      wisdom_changed(false),
+      conv_measured(0),
+      pthr(),
+      sem(),
+      stop(0),
+      thread_started(false) {
+    sem_init(&sem, 0, 0);
+}
+
+FFTPlanner::~FFTPlanner() {
+    if (thread_started) {
+	gx_system::atomic_set(&stop, 1);
+	sem_post(&sem);
+	pthread_join(pthr, NULL);
+    }
+    sem_destroy(&sem);
+    for (RefMap::iterator i = refs.begin(); i != refs.end(); ++i) {
+	fftwf_destroy_plan(i->first);
+    }
+}
+
+// load the wisdom and start the measuring job with the problems
+// of zita-convolver (all partition sizes, out-of-place, 16 byte
+// aligned arrays); without init() (plugin builds) plans are
+// made from FFTW_ESTIMATE only
+void FFTPlanner::init(const std::string& wisdom_file_) {
+    boost::mutex::scoped_lock lock(mutex);
+    if (thread_started) {
+	return;
+    }
+    // hosted LV2 / LADSPA plugins plan without our mutex
+    fftwf_make_planner_thread_safe();
+    wisdom_file = wisdom_file_;
+    if (access(wisdom_file.c_str(), R_OK) == 0 &&
+	!fftwf_import_wisdom_from_filename(wisdom_file.c_str())) {
+	gx_print_warning("fftw", boost::format(_("can't read wisdom file %1%")) % wisdom_file);
+    }
+    float *a = fftwf_alloc_real(1);
+    float *b = fftwf_alloc_real(1);
+    for (int n = 2 * Convproc::MINPART; n <= 2 * Convproc::MAXPART; n *= 2) {
+	pending.push_back(Problem(r2c, n, a, b));
+	pending.push_back(Problem(c2r, n, b, a));
+    }
+    fftwf_free(a);
+    fftwf_free(b);
+    if (pthread_create(&pthr, NULL, run_thread, this)) {
+	gx_print_error("fftw", _("can't create thread for measuring FFT plans"));
+	pending.clear();
+	return;
+    }
+    thread_started = true;
+    sem_post(&sem);
+}
+
+// plan on private arrays with the alignment of the problem;
+// mutex must be held
+fftwf_plan FFTPlanner::make_plan(const Problem& p, unsigned int flags) {
+    const int nc = p.n / 2 + 1;
+    int isize, osize;
+    switch (p.kind) {
+    case r2c: isize = p.n; osize = 2 * nc; break;
+    case c2r: isize = 2 * nc; osize = p.n; break;
+    default:  isize = osize = p.n; break;
+    }
+    if (p.inplace) {
+	isize = osize = max(isize, osize);
+    }
+    const int pad = 16;  // floats; more than any simd alignment
+    float *buf = fftwf_alloc_real(isize + osize + 3 * pad);
+    if (!buf) {
+	return 0;
+    }
+    float *in = buf + p.ialign / sizeof(float);
+    float *out = p.inplace ? in : buf + isize + 2 * pad + p.oalign / sizeof(float);
+    fftwf_plan plan = 0;
+    switch (p.kind) {
+    case r2c:
+	plan = fftwf_plan_dft_r2c_1d(p.n, in, reinterpret_cast<fftwf_complex*>(out), flags);
+	break;
+    case c2r:
+	plan = fftwf_plan_dft_c2r_1d(p.n, reinterpret_cast<fftwf_complex*>(in), out, flags);
+	break;
+    case r2hc:
+	plan = fftwf_plan_r2r_1d(p.n, in, out, FFTW_R2HC, flags);
+	break;
+    case hc2r:
+	plan = fftwf_plan_r2r_1d(p.n, in, out, FFTW_HC2R, flags);
+	break;
+    }
+    fftwf_free(buf);
+    return plan;
+}
+
+// in and out: the arrays used with fftwf_execute_*() (alignment and
+// in-place must match); returns 0 on error
+fftwf_plan FFTPlanner::plan(Kind kind, int n, void *in, void *out) {
+    Problem p(kind, n, in, out);
+    boost::mutex::scoped_lock lock(mutex);
+    fftwf_plan plan;
+    PlanMap::iterator i = cache.find(p);
+    if (i != cache.end()) {
+	plan = i->second;
+    } else {
+	plan = make_plan(p, FFTW_MEASURE | FFTW_WISDOM_ONLY);
+	if (!plan) {
+	    plan = make_plan(p, FFTW_ESTIMATE);
+	    if (!plan) {
+		return 0;
+	    }
+	    if (thread_started && measured.find(p) == measured.end() &&
+		find(pending.begin(), pending.end(), p) == pending.end()) {
+		pending.push_back(p);
+		sem_post(&sem);
+	    }
+	}
+	cache[p] = plan;
+	refs.insert(RefMap::value_type(plan, std::make_pair(p, 0)));
+    }
+    refs.find(plan)->second.second++;
+    return plan;
+}
+
+void FFTPlanner::release(fftwf_plan plan) {
+    if (!plan) {
+	return;
+    }
+    boost::mutex::scoped_lock lock(mutex);
+    RefMap::iterator i = refs.find(plan);
+    if (i == refs.end()) {
+	return;
+    }
+    if (--i->second.second > 0) {
+	return;
+    }
+    // unused plans stay in the cache (reactivation, other
+    // instances), replaced ones are destroyed
+    PlanMap::iterator c = cache.find(i->second.first);
+    if (c == cache.end() || c->second != plan) {
+	fftwf_destroy_plan(plan);
+	refs.erase(i);
+    }
+}
+
+// job thread, mutex must be held
+void FFTPlanner::measure(const Problem& p) {
+    measured.insert(p);
+    fftwf_plan plan = make_plan(p, FFTW_MEASURE | FFTW_WISDOM_ONLY);
+    if (!plan) {
+	plan = make_plan(p, FFTW_MEASURE);
+	if (!plan) {
+	    return;
+	}
+	wisdom_changed = true;
+    }
+    PlanMap::iterator c = cache.find(p);
+    if (c == cache.end()) {
+	// not used (yet), the wisdom is enough
+	fftwf_destroy_plan(plan);
+	return;
+    }
+    // replace the estimated plan; users switch on their next plan()
+    RefMap::iterator i = refs.find(c->second);
+    if (i->second.second == 0) {
+	fftwf_destroy_plan(i->first);
+	refs.erase(i);
+    }
+    c->second = plan;
+    refs.insert(RefMap::value_type(plan, std::make_pair(p, 0)));
+}
+
+// mutex must be held
+void FFTPlanner::save_wisdom() {
+    if (!wisdom_changed || wisdom_file.empty()) {
+	return;
+    }
+    std::string tmp = wisdom_file + "_tmp";
+    if (!fftwf_export_wisdom_to_filename(tmp.c_str()) ||
+	rename(tmp.c_str(), wisdom_file.c_str()) != 0) {
+	gx_print_warning("fftw", boost::format(_("can't write wisdom file %1%")) % wisdom_file);
+	unlink(tmp.c_str());
+	return;
+    }
+    wisdom_changed = false;
+}
+
+// measure one problem at a time, so that plan() is blocked only
+// for a short time
+void *FFTPlanner::run_thread(void *p) {
+    FFTPlanner& self = *static_cast<FFTPlanner*>(p);
+    while (true) {
+	sem_wait(&self.sem);
+	while (true) {
+	    if (gx_system::atomic_get(self.stop)) {
+		return NULL;
+	    }
+	    boost::mutex::scoped_lock lock(self.mutex);
+	    if (self.pending.empty()) {
+		self.save_wisdom();
+		gx_system::atomic_set(&self.conv_measured, 1);
+		break;
+	    }
+	    Problem pr = self.pending.front();
+	    self.pending.pop_front();
+	    self.measure(pr);
+	}
+    }
+    return NULL;
+}
+
+} // end namespace gx_engine
@@ -540,11 +540,13 @@ void ConvolverAdapter::change_buffersize(unsigned int size) {
         while (conv.is_runnable()) {
             conv.checkstate();
         }
+        conv.set_any_count(engine.get_any_count());
         conv.set_buffersize(size);
         if (size) {
             conv_start();
         }
     } else {
+        conv.set_any_count(engine.get_any_count());
         conv.set_buffersize(size);
     }
 }
@@ -909,6 +911,7 @@ BaseConvolver::~BaseConvolver() {
 
 void BaseConvolver::change_buffersize(unsigned int bufsize) {
     boost::mutex::scoped_lock lock(activate_mutex);
+    conv.set_any_count(engine.get_any_count());
     conv.set_buffersize(bufsize);
     if (activated) {
         if (!bufsize) {
@@ -997,6 +1000,7 @@ FixedBaseConvolver::~FixedBaseConvolver() {
 void FixedBaseConvolver::change_buffersize(unsigned int bufsize) {
     boost::mutex::scoped_lock lock(activate_mutex);
     buffersize = bufsize;
+    conv.set_any_count(engine.get_any_count());
     conv.set_buffersize(static_cast<int>(ceil((bufsize*bz))));
     if (activated) {
         if (!bufsize) {
@@ -1877,7 +1881,7 @@ void Directout::mem_alloc()
     bsize = int(engine.get_buffersize());
     assert(bsize>0);
     try {
-       outdata = new float[bsize]();
+       outdata = rt_alloc<float>(bsize);
     } catch(...) {
             gx_print_error("Directout", "cant allocate memory pool");
             return;
@@ -1889,7 +1893,7 @@ void Directout::mem_free()
 {
     mem_allocated = false;
     if (outdata) {
-        delete[] outdata;
+        rt_free(outdata);
         outdata = 0;
     }
 }
@@ -1947,32 +1951,28 @@ void __rt_func Directout::compute_static(int count, FAUSTFLOAT *input0, FAUSTFLO
 #include "drumseq.cc"
 #endif
 
-float* Drumout::set = 0;
-float* Drumout::data = 0;
-bool Drumout::mb = false;
-Plugin Drumout::output_drum = Plugin();
-Plugin Drumout::input_drum = Plugin();
-PluginDef Drumout::outputdrum = PluginDef();
-
-Drumout::Drumout() {
-
-    output_drum.set_pdef(&outputdrum);
-
-    outputdrum.version = PLUGINDEF_VERSION;
-    outputdrum.id = "drumout";
-    outputdrum.name = "?drumout";
-    outputdrum.stereo_audio = outputdrum_compute;
+Drumout::Drumout()
+    : PluginDef(),
+      set(0),
+      mb(false),
+      data(0),
+      input_drum(0) {
+    version = PLUGINDEF_VERSION;
+    id = "drumout";
+    name = "?drumout";
+    stereo_audio = outputdrum_compute;
 }
 
-void always_inline Drumout::outputdrum_compute(int count, float *input0, float *input1, float *output0, float *output1, PluginDef*) {
-    if (!(*set) || !input_drum.get_on_off() || !mb) {
+void always_inline Drumout::outputdrum_compute(int count, float *input0, float *input1, float *output0, float *output1, PluginDef *p) {
+    Drumout& self = *static_cast<Drumout*>(p);
+    if (!self.mb || !(*self.set) || !self.input_drum || !self.input_drum->get_on_off()) {
         return;
     }
     for (int i=0; i<count; i++) {
-        output0[i] =  input0[i] + data[i];
-        output1[i] =  input1[i] + data[i];
+        output0[i] =  input0[i] + self.data[i];
+        output1[i] =  input1[i] + self.data[i];
     }
-    memset(data,0,count*sizeof(float));
+    memset(self.data,0,count*sizeof(float));
 }
 
 void Drumout::set_data(float* mode, bool ready, float* buf) {
@@ -1981,7 +1981,7 @@ void Drumout::set_data(float* mode, bool ready, float* buf) {
     data = buf;
 }
 
-void Drumout::set_plugin(Plugin p) {
+void Drumout::set_plugin(Plugin *p) {
     input_drum = p;
 }
 
@@ -1994,7 +1994,7 @@ static const char* seq_groups[] = {
     0
 };
 
-DrumSequencer::DrumSequencer(EngineControl& engine_, sigc::slot<void> sync_)
+DrumSequencer::DrumSequencer(EngineControl& engine_, sigc::slot<void> sync_, Drumout *drumout_)
     : PluginDef(),
       Vectom(0),
       Vectom1(0),
@@ -2003,6 +2003,7 @@ DrumSequencer::DrumSequencer(EngineControl& engine_, sigc::slot<void> sync_)
       Vecsnare(0),
       Vechat(0),
       engine(engine_),
+      drumout(drumout_),
       mem_allocated(false),
       sync(sync_),
       ready(false),
@@ -2049,6 +2050,7 @@ inline void DrumSequencer::init(unsigned int samplingFreq)
     bsize = int(engine.get_buffersize());
     fSamplingFreq = samplingFreq;
     counter = 0;
+    sync_step = -1;
     step = 0;
     step_orig = 0;
     fSlow1 = 0.0;
@@ -2059,7 +2061,9 @@ inline void DrumSequencer::init(unsigned int samplingFreq)
     position = 0.0;
     mem_alloc();
     drums.init(samplingFreq);
-    Drumout::set_plugin(plugin);
+    if (drumout) {
+        drumout->set_plugin(&plugin);
+    }
 }
 
 void DrumSequencer::init_static(unsigned int samplingFreq, PluginDef *p)
@@ -2075,22 +2079,26 @@ void DrumSequencer::mem_alloc()
     bsize = int(engine.get_buffersize());
     assert(bsize>0);
     try {
-       outdata = new float[bsize]();
+       outdata = rt_alloc<float>(bsize);
     } catch(...) {
             gx_print_error("DrumSequencer", "cant allocate memory pool");
             return;
         }
     mem_allocated = true;
-    Drumout::set_data(&fSlow22, mem_allocated, outdata);
+    if (drumout) {
+        drumout->set_data(&fSlow22, mem_allocated, outdata);
+    }
 }
 
 void DrumSequencer::mem_free()
 {
     ready = false;
     mem_allocated = false;
-    Drumout::set_data(0, mem_allocated, 0);
+    if (drumout) {
+        drumout->set_data(0, mem_allocated, 0);
+    }
     if (outdata) {
-        delete[] outdata;
+        rt_free(outdata);
         outdata = 0;
     }
 }
@@ -2148,11 +2156,25 @@ void DrumSequencer::reset_snare() {
 
 void always_inline DrumSequencer::compute(int count, FAUSTFLOAT *input0, FAUSTFLOAT *output0)
 {
-    double     fSlow15 = (60.0/double(fsliderbpm*ftact))*fSamplingFreq;
-    counter += count;
+    double     fSlow15;
+    bool beat;
+    const TempoTracker& tempo = engine.tempo;
+    if (tempo.get_source() != TempoTracker::src_none) {
+        // follow midi clock / jack transport: steps on the beat grid
+        fSlow15 = (60.0/double(tempo.get_bpm()*ftact))*fSamplingFreq;
+        int next = int(tempo.get_beat_phase()*ftact + count/fSlow15) % max(1, int(ftact));
+        beat = (next != sync_step);
+        sync_step = next;
+        counter = 0;
+    } else {
+        fSlow15 = (60.0/double(fsliderbpm*ftact))*fSamplingFreq;
+        counter += count;
+        beat = (counter >= int(fSlow15));
+        sync_step = -1;
+    }
     int iSlow15 = (int)fSlow15;
     // beat
-    if (counter >= iSlow15) {
+    if (beat) {
         int istep = (int)step;
         fSlow1 = double(Vecsnare[istep]);
         // disable hat when sequencer runs to fast
@@ -2176,7 +2198,9 @@ void always_inline DrumSequencer::compute(int count, FAUSTFLOAT *input0, FAUSTFL
         }
         int m = ftact;
         int r = rand()%(m+1 - (-m))+ (-m);
-        counter -= iSlow15; //int(r*fsliderhum);
+        if (counter >= iSlow15) {
+            counter -= iSlow15; //int(r*fsliderhum);
+        }
         
         if (step<seq_size) step = fmin(seq_size,fmax(0,step + 1.0 + int(r*fsliderhum)));
         else step = 0.0;
@@ -2480,18 +2504,19 @@ void smbPitchShift::mem_alloc()
     fftFrameSize2 = fftFrameSize/2;
 
     try {
-        //create FFTW plan
-        ftPlanForward = fftwf_plan_dft_1d(fftFrameSize, fftw_in, fftw_out, FFTW_FORWARD, FFTW_ESTIMATE);
-        ftPlanInverse = fftwf_plan_dft_1d(fftFrameSize, fftw_in, fftw_out, FFTW_BACKWARD, FFTW_ESTIMATE);
+        //get FFTW plan (shared, measured in the background)
+        FFTPlanner& planner = FFTPlanner::getInstance();
+        ftPlanForward = planner.plan(FFTPlanner::r2c, fftFrameSize, fftw_real, fftw_cplx);
+        ftPlanInverse = planner.plan(FFTPlanner::c2r, fftFrameSize, fftw_cplx, fftw_real);
         // alloc buffers
-        fpb = new float[fftFrameSize2];
-        expect = new float[fftFrameSize2];
-        hanning = new float[fftFrameSize];
-        hanningd = new float[fftFrameSize];
-        resampin = new float[fftFrameSize];
-        resampin2 = new float[fftFrameSize];
-        resampout = new float[fftFrameSize*4];
-        indata2 = new float[fftFrameSize*4];
+        fpb = rt_alloc<float>(fftFrameSize2);
+        expect = rt_alloc<float>(fftFrameSize2);
+        hanning = rt_alloc<float>(fftFrameSize);
+        hanningd = rt_alloc<float>(fftFrameSize);
+        resampin = rt_alloc<float>(fftFrameSize);
+        resampin2 = rt_alloc<float>(fftFrameSize);
+        resampout = rt_alloc<float>(fftFrameSize*4);
+        indata2 = rt_alloc<float>(fftFrameSize*4);
     } catch(...) {
             gx_print_error("detune", "cant allocate memory pool");
             return;
@@ -2503,18 +2528,18 @@ void smbPitchShift::mem_free()
 {
     ready = false;
     mem_allocated = false;
-    if (fpb) { delete fpb; fpb = 0; }
-    if (expect) { delete expect; expect = 0; }
-    if (hanning) { delete hanning; hanning = 0; }
-    if (hanningd) { delete hanningd; hanningd = 0; }
-    if (resampin) { delete resampin; resampin = 0; }
-    if (resampin2) { delete resampin2; resampin2 = 0; }
-    if (resampout) { delete resampout; resampout = 0; }
-    if (indata2) { delete indata2; indata2 = 0; }
+    if (fpb) { rt_free(fpb); fpb = 0; }
+    if (expect) { rt_free(expect); expect = 0; }
+    if (hanning) { rt_free(hanning); hanning = 0; }
+    if (hanningd) { rt_free(hanningd); hanningd = 0; }
+    if (resampin) { rt_free(resampin); resampin = 0; }
+    if (resampin2) { rt_free(resampin2); resampin2 = 0; }
+    if (resampout) { rt_free(resampout); resampout = 0; }
+    if (indata2) { rt_free(indata2); indata2 = 0; }
     if (ftPlanForward)
-        {fftwf_destroy_plan(ftPlanForward);ftPlanForward = 0; }
+        { FFTPlanner::getInstance().release(ftPlanForward); ftPlanForward = 0; }
     if (ftPlanInverse) 
-        { fftwf_destroy_plan(ftPlanInverse);ftPlanInverse = 0; }
+        { FFTPlanner::getInstance().release(ftPlanInverse); ftPlanInverse = 0; }
 }
 
 int smbPitchShift::activate(bool start)
@@ -2563,16 +2588,138 @@ void __rt_func smbPitchShift::compute_static(int count, float *input0, float *ou
 }
 
 
+// branch free float approximations for the per bin loops of the
+// phase vocoder, so they can be vectorized by the compiler; measured
+// max. error against double precision, float rounding included:
+// pv_atan2 2.0e-6 rad, pv_sincos 3.7e-6, pv_wrap 1.4e-6 rad (far
+// below what is audible in the resynthesis)
+
+static inline float pv_wrap(float p) {
+    // map into +/- Pi
+    return p - float(2*M_PI) * floorf(p * float(1/(2*M_PI)) + 0.5f);
+}
+
+static inline float pv_atan2(float y, float x) {
+    float ax = fabsf(x);
+    float ay = fabsf(y);
+    float a = min(ax, ay) / (max(ax, ay) + 1e-30f);
+    float s = a * a;
+    float r = ((((( -0.01172120f * s + 0.05265332f) * s - 0.11643287f) * s
+                 + 0.19354346f) * s - 0.33262347f) * s + 0.99997726f) * a;
+    r = ay > ax ? float(M_PI/2) - r : r;
+    r = x < 0 ? float(M_PI) - r : r;
+    return y < 0 ? -r : r;
+}
+
+// x in [-Pi, Pi]
+static inline void pv_sincos(float x, float& sn, float& cs) {
+    bool fold = fabsf(x) > float(M_PI/2);
+    float fx = fold ? (x > 0 ? float(M_PI) - x : float(-M_PI) - x) : x;
+    float x2 = fx * fx;
+    sn = fx * (1.0f + x2 * (-1.0f/6 + x2 * (1.0f/120 + x2 * (-1.0f/5040 + x2 * (1.0f/362880)))));
+    float c = 1.0f + x2 * (-1.0f/2 + x2 * (1.0f/24 + x2 * (-1.0f/720 + x2 * (1.0f/40320 + x2 * (-1.0f/3628800)))));
+    cs = fold ? -c : c;
+}
+
+void always_inline smbPitchShift::process_frame(float pitchShift)
+{
+    const int n = fftFrameSize;
+    const int n2 = fftFrameSize2;
+    const float fpbin2 = freqPerBin2;
+    const float fpbin1 = freqPerBin1;
+    float *re = fftw_real;
+    const float *inf = gInFIFO;
+    const float *win = hanning;
+    const float *fp = fpb;
+    const float *ex = expect;
+
+    /* do windowing */
+    for (int j = 0; j < n; j++) {
+        re[j] = inf[j] * win[j];
+    }
+
+    /* ***************** ANALYSIS ******************* */
+    /* real input: r2c transform, only the n/2+1 bins are computed */
+    fftwf_execute_dft_r2c(ftPlanForward, fftw_real, fftw_cplx);
+
+    float *lph = gLastPhase;
+    float *amagn = gAnaMagn;
+    float *afreq = gAnaFreq;
+    for (int j = 0; j < n2; j++) {
+        float r = fftw_cplx[j][0];
+        float im = fftw_cplx[j][1];
+        float phase = pv_atan2(im, r);
+        /* phase difference minus the expected one, mapped into +/- Pi */
+        float d = pv_wrap(phase - lph[j] - ex[j]);
+        lph[j] = phase;
+        /* c2r doubles the bins 1..n/2-1, so no factor 2 here */
+        amagn[j] = sqrtf(r*r + im*im);
+        /* compute the k-th partials' true frequency */
+        afreq[j] = fp[j] + d * fpbin2;
+    }
+
+    /* ***************** PROCESSING ******************* */
+    /* this does the actual pitch shifting */
+    memset(gSynMagn, 0, (n2+1)*sizeof(float));
+    memset(gSynFreq, 0, (n2+1)*sizeof(float));
+    for (int j = 1; j < n2-2; j++) {
+        long index = j*pitchShift;
+        if (index < n2) {
+            if (index < n2*0.20)
+                gSynMagn[index] += gAnaMagn[j]*a;
+            else if (index < n2*0.45)
+                gSynMagn[index] += gAnaMagn[j]*b;
+            else if (index < n2*0.667)
+                gSynMagn[index] += gAnaMagn[j]*c;
+            else
+                gSynMagn[index] += gAnaMagn[j]*d;
+            gSynFreq[index] = gAnaFreq[j] * pitchShift;
+        }
+    }
+
+    /* ***************** SYNTHESIS ******************* */
+    float *sph = gSumPhase;
+    const float *smagn = gSynMagn;
+    const float *sfreq = gSynFreq;
+    for (int j = 0; j < n2; j++) {
+        /* bin deviation from the true frequency plus the overlap
+           phase advance, accumulated (and kept in +/- Pi) */
+        float phase = pv_wrap(sph[j] + (sfreq[j] - fp[j]) * fpbin1 + ex[j]);
+        sph[j] = phase;
+        float sn, cs;
+        pv_sincos(phase, sn, cs);
+        fftw_cplx[j][0] = smagn[j] * cs;
+        fftw_cplx[j][1] = smagn[j] * sn;
+    }
+    fftw_cplx[n2][0] = fftw_cplx[n2][1] = 0.0;
+
+    /* do inverse transform */
+    fftwf_execute_dft_c2r(ftPlanInverse, fftw_cplx, fftw_real);
+    /* do windowing and add to output accumulator */
+    float *acc = gOutputAccum;
+    const float *wind = hanningd;
+    for (int j = 0; j < n; j++) {
+        acc[j] += wind[j] * re[j];
+    }
+    memcpy(gOutFIFO, gOutputAccum, stepSize*sizeof(float));
+
+    /* shift accumulator */
+    memmove(gOutputAccum, gOutputAccum+stepSize, n*sizeof(float));
+
+    /* move input FIFO */
+    memmove(gInFIFO, gInFIFO+stepSize, inFifoLatency*sizeof(float));
+}
+
 void always_inline smbPitchShift::PitchShift(int count, float *indata, float *outdata)
 {
-    
+
     if (!ready || count != numSampsToProcess) {
         if (indata != outdata) {
             memcpy(outdata,indata,count*sizeof(float));
         }
         return;
     }
-    
+
     resamp.down(numSampsToResamp,indata,resampin);
     double     fSlow0 = (0.01 * wet);
     double     fSlow1 = (0.01 * dry);
@@ -2582,146 +2729,40 @@ void always_inline smbPitchShift::PitchShift(int count, float *indata, float *ou
         indata2[ii] = indata[i];
         ii++;
     }
-    // collect data for fft
+    switch(octave) {
+      case(0):
+        tone =0;
+        break;
+      case(1):
+        tone =12;
+        break;
+      case(2):
+        tone =-12;
+        break;
+      default:
+        tone =0;
+        break;
+    }
+    float pitchShift = pow(2., (semitones+tone)*0.0833333333);
+    // feed the FIFO as the data comes in: a frame is analysed and
+    // resynthesized every stepSize samples, so the frames are spread
+    // over the periods instead of all running in the period which
+    // completes the block for the upsampler
     for (i = 0; i < numSampsToResamp; i++) {
-        resampin2[ai] = resampin[i];
+        gInFIFO[gRover] = resampin[i];
+        resampin2[ai] = gOutFIFO[gRover-inFifoLatency];
         ai++;
+        gRover++;
+        /* now we have enough data for processing */
+        if (gRover >= fftFrameSize) {
+            gRover = inFifoLatency;
+            process_frame(pitchShift);
+        }
     }
-    // now we have enough data
+    // now we have a complete block
     if (ai>=fftFrameSize) {
         ai = 0;
         ii = 0;
-        switch(octave) {
-          case(0):
-            tone =0;
-            break;
-          case(1):
-            tone =12;
-            break;
-          case(2):
-            tone =-12;
-            break;
-          default:
-            tone =0;
-            break;
-        }
-        float pitchShift = pow(2., (semitones+tone)*0.0833333333);
-        /* main processing loop */
-        for (i = 0; i < fftFrameSize; i++) {
-
-            /* As long as we have not yet collected enough data just read in */
-            float fTemp = resampin2[i];
-            gInFIFO[gRover] = fTemp;
-            resampin2[i] = gOutFIFO[gRover-inFifoLatency];
-            gRover++;
-
-            /* now we have enough data for processing */
-            if (gRover >= fftFrameSize) {
-                gRover = inFifoLatency;
-
-                /* do windowing and re,im interleave */
-                for (k = 0; k < fftFrameSize;k++) {
-                    fftw_in[k][0] = gInFIFO[k] * hanning[k];
-                    fftw_in[k][1] = 0.0;
-                }
-
-
-                /* ***************** ANALYSIS ******************* */
-                /* do transform */
-                fftwf_execute(ftPlanForward);
-
-                /* this is the analysis step */
-                for (k = 0; k < fftFrameSize2; k++) {
-
-                    /* de-interlace FFT buffer */
-                    real = fftw_out[k][0];
-                    imag = fftw_out[k][1];
-
-                    /* compute magnitude and phase */
-                    magn = 2.*sqrt(real*real + imag*imag);
-                    phase = atan2(imag,real);
-
-                    /* compute phase difference */
-                    tmp = phase - gLastPhase[k];
-                    gLastPhase[k] = phase;
-
-                    /* subtract expected phase difference */
-                    tmp -= expect[k];
-
-                    /* map delta phase into +/- Pi interval */
-                    qpd = tmp*mpi1;
-                    if (qpd >= 0) qpd += qpd&1;
-                    else qpd -= qpd&1;
-                    tmp -= M_PI*(double)qpd;
-
-                    /* get deviation from bin frequency from the +/- Pi interval */
-                    /* compute the k-th partials' true frequency */
-                    tmp = fpb[k] + tmp*freqPerBin2;
-
-                    /* store magnitude and true frequency in analysis arrays */
-                    gAnaMagn[k] = magn;
-                    gAnaFreq[k] = tmp;
-
-                }
-
-                /* ***************** PROCESSING ******************* */
-                /* this does the actual pitch shifting */
-                memset(gSynMagn, 0, fftFrameSize*sizeof(float));
-                memset(gSynFreq, 0, fftFrameSize*sizeof(float));
-                for (k = 1; k < fftFrameSize2-2; k++) { 
-                    index = k*pitchShift;
-                    if (index < fftFrameSize2) { 
-                        if (index < fftFrameSize2*0.20)
-                            gSynMagn[index] += gAnaMagn[k]*a; 
-                        else if (index < fftFrameSize2*0.45)
-                            gSynMagn[index] += gAnaMagn[k]*b; 
-                        else if (index < fftFrameSize2*0.667)
-                            gSynMagn[index] += gAnaMagn[k]*c; 
-                        else 
-                            gSynMagn[index] += gAnaMagn[k]*d; 
-                        gSynFreq[index] = gAnaFreq[k] * pitchShift; 
-                    } 
-                }
-                
-                /* ***************** SYNTHESIS ******************* */
-                /* this is the synthesis step */
-                for (k = 0; k < fftFrameSize2; k++) {
-
-                    /* get magnitude and true frequency from synthesis arrays */
-                    magn = gSynMagn[k];
-                    //tmp = gSynFreq[k];
-
-                    /* subtract bin mid frequency */
-                    /* get bin deviation from freq deviation */
-                    /* take osamp into account */
-                    /* add the overlap phase advance back in */
-                    tmp = ((gSynFreq[k] - fpb[k]) * freqPerBin1) + expect[k];
-
-                    /* accumulate delta phase to get bin phase */
-                    gSumPhase[k] += tmp;
-                    phase = gSumPhase[k];
-                    if (magn == 0.0) continue;
-
-                    /* get real and imag part and re-interleave */                
-                    fftw_in[k][0] = magn * cos (phase);
-                    fftw_in[k][1] = magn * sin (phase);
-                } 
-
-                /* do inverse transform */
-                fftwf_execute(ftPlanInverse);
-                /* do windowing and add to output accumulator */ 
-                for(k=0; k < fftFrameSize; k++) {
-                    gOutputAccum[k] += hanningd[k] * fftw_out[ k][0] ;
-                }
-                for (k = 0; k < stepSize; k++) gOutFIFO[k] = gOutputAccum[k];
-
-                /* shift accumulator */
-                memmove(gOutputAccum, gOutputAccum+stepSize, fftFrameSize*sizeof(float));
-
-                /* move input FIFO */
-                for (k = 0; k < inFifoLatency; k++) gInFIFO[k] = gInFIFO[k+stepSize];
-            }
-        }
         resamp.up(fftFrameSize,resampin2,resampout);
         aio = 0;
     }
@@ -191,6 +191,46 @@ void TunerAdapter::set_module() {
  ** class OscilloscopeAdapter
  */
 
+OscilloscopeInfo::~OscilloscopeInfo() {
+    delete[] buffer;
+    for (int i = 0; i < 3; i++) {
+	delete[] frame[i];
+    }
+}
+
+void OscilloscopeInfo::alloc_frames(unsigned int size) {
+    for (int i = 0; i < 3; i++) {
+	frame[i] = new float[size];
+	memset(frame[i], 0, size*sizeof(float));
+	frame_size[i] = 0;
+    }
+    buffer = new float[size];
+    memset(buffer, 0, size*sizeof(float));
+}
+
+// rt thread: make the frame in back the last complete frame and
+// continue with the one replaced
+void OscilloscopeInfo::publish() {
+    int r;
+    do {
+	r = gx_system::atomic_get(ready);
+    } while (!gx_system::atomic_compare_and_exchange(&ready, r, back | frame_new));
+    back = r & 3;
+}
+
+// UI thread: take the last complete frame (if there is a new one)
+bool OscilloscopeInfo::fetch() {
+    int r;
+    do {
+	r = gx_system::atomic_get(ready);
+	if (!(r & frame_new)) {
+	    return false;
+	}
+    } while (!gx_system::atomic_compare_and_exchange(&ready, r, front));
+    front = r & 3;
+    return true;
+}
+
 void OscilloscopeInfo::readJSON(gx_system::JsonParser& jp) {
     jp.next(gx_system::JsonParser::begin_array);
     jp.next(gx_system::JsonParser::value_number);
@@ -244,6 +284,15 @@ void OscilloscopeInfo::update() {
     frames = jack->get_time_is()/100000;
     is_rt = jack->get_is_rt();
     bsize = jack->get_jack_bs();
+    if (!frame[0] || !fetch()) {
+	return;
+    }
+    unsigned int sz = frame_size[front];
+    memcpy(buffer, frame[front], sz*sizeof(float));
+    if (sz != buffer_size) {
+	buffer_size = sz;
+	size_change(buffer_size, buffer);
+    }
 }
 
 OscParameter::ParameterV(const string& id, OscilloscopeInfo *v)
@@ -326,6 +375,19 @@ OscilloscopeAdapter::OscilloscopeAdapter(ModuleSequencer& engine)
       info(),
       pmap(engine.get_param()),
       mul_buffer(1),
+      window(0),
+      trigger(trig_free),
+      level(0),
+      width(280),
+      capturing(false),
+      pos(0),
+      win(0),
+      cols(0),
+      col(0),
+      next(0),
+      cmin(0),
+      cmax(0),
+      last(0),
       plugin() {
     assert(info.buffer == 0);
     version = PLUGINDEF_VERSION;
@@ -337,6 +399,7 @@ OscilloscopeAdapter::OscilloscopeAdapter(ModuleSequencer& engine)
     register_params = osc_register;
     load_ui = osc_load_ui;
     plugin.set_pdef(this);
+    info.alloc_frames(2 * max_width);
     engine.signal_buffersize_change().connect(
 	sigc::mem_fun(*this, &OscilloscopeAdapter::change_buffersize));
 }
@@ -344,31 +407,85 @@ OscilloscopeAdapter::OscilloscopeAdapter(ModuleSequencer& engine)
 int OscilloscopeAdapter::osc_register(const ParamReg& reg) {
     OscilloscopeAdapter& self = *static_cast<OscilloscopeAdapter*>(reg.plugin);
     OscParameter::insert_param(self.pmap, "oscilloscope.info", &self.info);
+    static const value_pair trigger_values[] = {{"free"},{"rising"},{"falling"},{0}};
+    reg.registerIntVar("oscilloscope.trigger", N_("Trigger"), "BN", N_("trigger on signal edge"),
+		       &self.trigger, trig_free, 0, 0, trigger_values);
+    reg.registerFloatVar("oscilloscope.level", N_("Level"), "SN", N_("trigger level"),
+			 &self.level, 0.0, -1.0, 1.0, 0.01, 0);
+    reg.registerIntVar("oscilloscope.width", N_("Width"), "SN", N_("points (min/max pairs) per frame"),
+		       &self.width, 280, min_width, max_width, 0);
     return 0;
 }
 
+// the window (frame length in samples) is mul_buffer periods
 void OscilloscopeAdapter::change_buffersize(unsigned int size) {
-    //FIXME waveview display needs mutex
-    info.size_change(0, 0);
-    float *b = info.buffer;
-    unsigned int d = info.buffer_size < 1024 ? mul_buffer : 1;
-    info.buffer = new float[size * d];
-    info.buffer_size = size * d;
-    clear_buffer();
-    info.size_change(info.buffer_size, info.buffer);
-    delete[] b;
+    gx_system::atomic_set(&window, static_cast<int>(size) * mul_buffer);
 }
 
-// rt process function
-void OscilloscopeAdapter::fill_buffer(int count, float *input0, float *output0, PluginDef *p) {
-    OscilloscopeAdapter& self = *static_cast<OscilloscopeAdapter*>(p);
-    if (count*self.mul_buffer != static_cast<int>(self.info.buffer_size)) {
+// min/max decimation of the triggered window to cols pairs of
+// values, O(1) per sample independent of the window length
+inline void OscilloscopeAdapter::capture(int count, const float *buf) {
+    const int w = gx_system::atomic_get(window);
+    if (w <= 0) {
 	return;
     }
-    if (self.mul_buffer > 1) {
-	(void)memmove(self.info.buffer, &self.info.buffer[count], sizeof(float)*count*(self.mul_buffer-1));
+    float *f = info.frame[info.back];
+    for (int i = 0; i < count; i++) {
+	float x = buf[i];
+	if (!capturing) {
+	    bool t;
+	    switch (trigger) {
+	    case trig_rising:  t = last < level && x >= level; break;
+	    case trig_falling: t = last > level && x <= level; break;
+	    default:           t = true; break;
+	    }
+	    last = x;
+	    // auto trigger when armed for a whole window
+	    if (!t && ++pos < w) {
+		continue;
+	    }
+	    capturing = true;
+	    pos = 0;
+	    win = w;
+	    cols = min(max(width, static_cast<int>(min_width)), static_cast<int>(max_width));
+	    col = 0;
+	    next = (win + cols - 1) / cols;
+	    cmin = cmax = x;
+	} else {
+	    last = x;
+	    if (pos == next) {
+		f[2*col] = cmax;
+		f[2*col+1] = cmin;
+		// skipped columns (less samples than columns) get the sample
+		int c = static_cast<int>((static_cast<long long>(pos) * cols) / win);
+		while (++col < c) {
+		    f[2*col] = f[2*col+1] = x;
+		}
+		next = static_cast<int>(((static_cast<long long>(col) + 1) * win + cols - 1) / cols);
+		cmin = cmax = x;
+	    } else {
+		cmin = min(cmin, x);
+		cmax = max(cmax, x);
+	    }
+	}
+	if (++pos == win) {
+	    f[2*col] = cmax;
+	    f[2*col+1] = cmin;
+	    while (++col < cols) {
+		f[2*col] = f[2*col+1] = x;
+	    }
+	    info.frame_size[info.back] = 2 * cols;
+	    info.publish();
+	    f = info.frame[info.back];
+	    capturing = false;
+	    pos = 0;
+	}
     }
-    (void)memcpy(&self.info.buffer[count*(self.mul_buffer-1)], output0, sizeof(float)*count);
+}
+
+// rt process function
+void OscilloscopeAdapter::fill_buffer(int count, float *input0, float *output0, PluginDef *p) {
+    static_cast<OscilloscopeAdapter*>(p)->capture(count, output0);
 }
 
 void OscilloscopeAdapter::clear_buffer() {
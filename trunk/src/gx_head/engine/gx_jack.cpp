@@ -23,6 +23,7 @@
  */
 
 #include <errno.h>              // NOLINT
+#include <sys/resource.h>       // NOLINT
 #ifndef GUITARIX_AS_PLUGIN
 #include <jack/statistics.h>    // NOLINT
 #include <jack/jack.h>          // NOLINT
@@ -54,7 +55,9 @@ string GxJack::get_default_instancename() {
  ** rt_watchdog
  */
 
-static unsigned int rt_watchdog_counter;
+// advanced once per second by the watchdog thread; every GxJack
+// instance counts its own rt cycles since the last tick
+static volatile unsigned int rt_watchdog_tick;
 
 #ifndef SCHED_IDLE
 #define SCHED_IDLE SCHED_OTHER  // non-linux systems
@@ -65,7 +68,7 @@ static void *rt_watchdog_run(void *p) {
     spar.sched_priority = 0;
     pthread_setschedparam(pthread_self(), SCHED_IDLE, &spar);
     while (true) {
-	gx_system::atomic_set(&rt_watchdog_counter, 0);
+	gx_system::atomic_inc(&rt_watchdog_tick);
 	usleep(1000000);
     }
     return NULL;
@@ -85,8 +88,13 @@ static void rt_watchdog_start() {
     }
 }
 
-static inline bool rt_watchdog_check_alive(unsigned int bs, unsigned int sr) {
+inline bool GxJack::rt_watchdog_check_alive(unsigned int bs, unsigned int sr) {
     if (rt_watchdog_limit > 0) {
+	unsigned int tick = gx_system::atomic_get(rt_watchdog_tick);
+	if (tick != gx_system::atomic_get(rt_watchdog_seen)) {
+	    gx_system::atomic_set(&rt_watchdog_seen, tick);
+	    gx_system::atomic_set(&rt_watchdog_counter, 0);
+	}
 	if (gx_system::atomic_get(rt_watchdog_counter) > rt_watchdog_limit*(2*sr)/bs) {
 	    return false;
 	}
@@ -159,6 +167,11 @@ GxJack::GxJack(gx_engine::GxEngine& engine_)
       xrun(),
       last_xrun(0),
       xrun_msg_blocked(false),
+      pagefaults(),
+      pagefaults_insert(),
+      pagefault(),
+      rt_watchdog_counter(0),
+      rt_watchdog_seen(0),
       ports(),
       client(0),
       client_insert(0),
@@ -170,10 +183,12 @@ GxJack::GxJack(gx_engine::GxEngine& engine_)
       connection(),
       single_client(false) {
     connection_queue.new_data.connect(sigc::mem_fun(*this, &GxJack::fetch_connection_data));
+    buffersize_change.connect(sigc::mem_fun(*this, &GxJack::buffersize_reconfig));
     client_change_rt.connect(client_change);
     GxExit::get_instance().signal_exit().connect(
 	sigc::mem_fun(*this, &GxJack::cleanup_slot));
     xrun.connect(sigc::mem_fun(this, &GxJack::report_xrun));
+    pagefault.connect(sigc::mem_fun(this, &GxJack::report_pagefault));
 }
 
 GxJack::~GxJack() {
@@ -771,8 +786,11 @@ inline void GxJack::check_overload() {
 // ----- main jack process method gx_amp, mono -> mono
 // RT process thread
 int __rt_func GxJack::gx_jack_process(jack_nframes_t nframes, void *arg) {
+    // plugins (LV2 in particular) might have changed the mode
+    AVOIDDENORMALS();
     gx_system::measure_start();
     GxJack& self = *static_cast<GxJack*>(arg);
+    gx_engine::RtTrace::Record *tr = self.engine.rt_trace.begin_period(nframes);
     if (!self.is_jack_exit()) {
 	if (!self.engine.mono_chain.is_stopped()) {
 	    self.check_overload();
@@ -794,32 +812,57 @@ int __rt_func GxJack::gx_jack_process(jack_nframes_t nframes, void *arg) {
 
         // midi input processing
 	if (self.ports.midi_input.port) {
-	    self.engine.controller_map.compute_midi_in(
-		jack_port_get_buffer(self.ports.midi_input.port, nframes), arg);
+	    void *midi_input_port_buf = jack_port_get_buffer(self.ports.midi_input.port, nframes);
+	    if (tr) {
+		tr->midi_events = jack_midi_get_event_count(midi_input_port_buf);
+	    }
+	    self.engine.controller_map.compute_midi_in(midi_input_port_buf, arg);
 	}
         // jack transport support
     if ( self.transport_state != self.old_transport_state) {
         self.engine.controller_map.process_trans(self.transport_state);
         self.old_transport_state = self.transport_state;
     }
+	// tempo for the next period (midi clock, else transport BBT)
+	bool bbt = (self.transport_state == JackTransportRolling &&
+		    (self.current.valid & JackPositionBBT));
+	if (self.engine.tempo.update(
+		jack_last_frame_time(self.client), nframes, self.jack_sr, bbt,
+		bbt ? self.current.beats_per_minute : 0,
+		bbt && self.current.ticks_per_beat > 0 ? self.current.tick / self.current.ticks_per_beat : 0)) {
+	    self.engine.controller_map.process_tempo(self.engine.tempo.get_rounded_bpm());
+	}
     }
     // midi CC output processing
     void *buf = self.get_midi_buffer(nframes);
     self.process_midi_cc(buf, nframes);
 
     gx_system::measure_pause();
+    if (tr) {
+	tr->mono_ns = gx_engine::RtTrace::now() - tr->start;
+    }
     self.engine.mono_chain.post_rt_finished();
     if (self.single_client) {
         self.gx_jack_insert_process(nframes, arg);
     }
+    if (self.pagefaults.update()) {
+	self.pagefault();
+    }
+    if (tr) {
+	tr->minflt += self.pagefaults.get_last_minor();
+	tr->majflt += self.pagefaults.get_last_major();
+    }
     return 0;
 }
 
 // ----- main jack process method, gx_fx_amp, mono -> stereo
 // RT process_insert thread
 int __rt_func GxJack::gx_jack_insert_process(jack_nframes_t nframes, void *arg) {
+    AVOIDDENORMALS();
     GxJack& self = *static_cast<GxJack*>(arg);
     gx_system::measure_cont();
+    gx_engine::RtTrace::Record *tr = self.engine.rt_trace.current();
+    gint64 t0 = tr ? gx_engine::RtTrace::now() : 0;
     if (!self.is_jack_exit()) {
 	if (!self.engine.stereo_chain.is_stopped()) {
 	    self.check_overload();
@@ -837,7 +880,20 @@ int __rt_func GxJack::gx_jack_insert_process(jack_nframes_t nframes, void *arg)
 	    get_float_buf(self.ports.output2.port, nframes));
     }
     gx_system::measure_stop();
+    if (tr) {
+	tr->stereo_ns = gx_engine::RtTrace::now() - t0;
+    }
     self.engine.stereo_chain.post_rt_finished();
+    // in single client mode called from gx_jack_process, which counts
+    if (!self.single_client) {
+	if (self.pagefaults_insert.update()) {
+	    self.pagefault();
+	}
+	if (tr) {
+	    tr->minflt += self.pagefaults_insert.get_last_minor();
+	    tr->majflt += self.pagefaults_insert.get_last_major();
+	}
+    }
     return 0;
 }
 
@@ -970,6 +1026,9 @@ int GxJack::gx_jack_srate_callback(jack_nframes_t samplerate, void* arg) {
 
 // ---- jack buffer size change callback
 // RT process thread
+// the engine is stopped here; the modules are reconfigured for the
+// new size (buffer allocation, fft plans, convolver setup) in
+// buffersize_reconfig(), which runs in the main loop
 int GxJack::gx_jack_buffersize_callback(jack_nframes_t nframes, void* arg) {
     GxJack& self = *static_cast<GxJack*>(arg);
     if (self.jack_bs == nframes) {
@@ -977,8 +1036,6 @@ int GxJack::gx_jack_buffersize_callback(jack_nframes_t nframes, void* arg) {
     }
     self.engine.set_stateflag(gx_engine::GxEngine::SF_JACK_RECONFIG);
     self.jack_bs = nframes;
-    self.engine.set_buffersize(nframes);
-    self.engine.clear_stateflag(gx_engine::GxEngine::SF_JACK_RECONFIG);
     self.buffersize_change();
 	// create buffer to bypass the insert ports
 	delete[] self.insert_buffer;
@@ -987,6 +1044,16 @@ int GxJack::gx_jack_buffersize_callback(jack_nframes_t nframes, void* arg) {
     return 0;
 }
 
+// main loop, connected to buffersize_change before any other slot
+void GxJack::buffersize_reconfig() {
+    jack_nframes_t n;
+    do {
+	n = jack_bs;
+	engine.set_buffersize(n);
+    } while (n != jack_bs); // changed again while reconfiguring
+    engine.clear_stateflag(gx_engine::GxEngine::SF_JACK_RECONFIG);
+}
+
 // ---- jack shutdown callback in case jackd shuts down on us
 void GxJack::gx_jack_shutdown_callback() {
     set_jack_exit(true);
@@ -1036,6 +1103,100 @@ void GxJack::report_xrun() {
 	(boost::format(_(" delay of at least %1% microsecs")) % last_xrun).str());
 }
 
+void GxJack::report_pagefault_clear() {
+    pagefaults.clear_pending();
+    pagefaults_insert.clear_pending();
+}
+
+// faults which happen while a message is blocked are summed up
+// into the next one
+void GxJack::report_pagefault() {
+    int minor, major, periods, max_faults;
+    int minor2, major2, periods2, max_faults2;
+    pagefaults.fetch(minor, major, periods, max_faults);
+    pagefaults_insert.fetch(minor2, major2, periods2, max_faults2);
+    Glib::signal_timeout().connect_once(
+	sigc::mem_fun(this, &GxJack::report_pagefault_clear), 1000);
+    if (!periods && !periods2) {
+	return;
+    }
+    std::string msg =
+	(boost::format(_("page faults: %1% minor, %2% major in %3% periods (max. %4% in one period)"))
+	 % (minor + minor2) % (major + major2) % (periods + periods2)
+	 % max(max_faults, max_faults2)).str();
+    if (major + major2) {
+	gx_print_warning(_("Jack RT thread"), msg);
+    } else {
+	gx_print_info(_("Jack RT thread"), msg);
+    }
+}
+
+/****************************************************************
+ ** class PageFaultCount
+ */
+
+PageFaultCount::PageFaultCount()
+    : thread(),
+      last_minor(-1),
+      last_major(-1),
+      minor(0),
+      major(0),
+      periods(0),
+      max_faults(0),
+      pending(0),
+      last_dminor(0),
+      last_dmajor(0) {
+}
+
+// rt thread; returns true when the ui thread should be notified
+bool __rt_func PageFaultCount::update() {
+    last_dminor = last_dmajor = 0;
+#ifdef RUSAGE_THREAD
+    struct rusage ru;
+    if (getrusage(RUSAGE_THREAD, &ru) != 0) {
+	return false;
+    }
+    pthread_t self = pthread_self();
+    if (last_minor < 0 || !pthread_equal(self, thread)) {
+	// first period in a (new) jack thread
+	thread = self;
+	last_minor = ru.ru_minflt;
+	last_major = ru.ru_majflt;
+	return false;
+    }
+    int dminor = ru.ru_minflt - last_minor;
+    int dmajor = ru.ru_majflt - last_major;
+    last_minor = ru.ru_minflt;
+    last_major = ru.ru_majflt;
+    last_dminor = dminor;
+    last_dmajor = dmajor;
+    if (!dminor && !dmajor) {
+	return false;
+    }
+    g_atomic_int_add(&minor, dminor);
+    g_atomic_int_add(&major, dmajor);
+    gx_system::atomic_inc(&periods);
+    int m = gx_system::atomic_get(max_faults);
+    if (dminor + dmajor > m) {
+	gx_system::atomic_compare_and_exchange(&max_faults, m, dminor + dmajor);
+    }
+    return gx_system::atomic_compare_and_exchange(&pending, 0, 1);
+#else
+    return false;
+#endif
+}
+
+void PageFaultCount::fetch(int& minor_, int& major_, int& periods_, int& max_faults_) {
+    minor_ = gx_system::atomic_get(minor);
+    g_atomic_int_add(&minor, -minor_);
+    major_ = gx_system::atomic_get(major);
+    g_atomic_int_add(&major, -major_);
+    periods_ = gx_system::atomic_get(periods);
+    g_atomic_int_add(&periods, -periods_);
+    max_faults_ = gx_system::atomic_get(max_faults);
+    gx_system::atomic_compare_and_exchange(&max_faults, max_faults_, 0);
+}
+
 // ---- jack xrun callback
 int GxJack::gx_jack_xrun_callback(void* arg) {
     GxJack& self = *static_cast<GxJack*>(arg);
@@ -25,6 +25,10 @@
 #include "engine.h"               // NOLINT
 
 #include <sys/stat.h>
+#include <sys/file.h>
+#include <fcntl.h>
+#include <giomm/zlibcompressor.h>
+#include <giomm/zlibdecompressor.h>
 
 namespace gx_system {
 
@@ -239,6 +243,124 @@ void JsonStringWriter::send_notify_end() {
 }
 
 
+/****************************************************************
+ ** JsonAttachment
+ */
+
+static inline void swap_float_le(char *p, unsigned int count) {
+#if G_BYTE_ORDER == G_BIG_ENDIAN
+    guint32 *q = reinterpret_cast<guint32*>(p);
+    for (unsigned int i = 0; i < count; ++i) {
+	q[i] = GUINT32_SWAP_LE_BE(q[i]);
+    }
+#endif
+}
+
+static bool run_converter(Glib::RefPtr<Gio::Converter> conv, const char *p, size_t n, std::string& out) {
+    char buf[65536];
+    try {
+	while (true) {
+	    gsize rd, wr;
+	    Gio::ConverterResult r = conv->convert(
+		p, n, buf, sizeof(buf), Gio::CONVERTER_INPUT_AT_END, rd, wr);
+	    out.append(buf, wr);
+	    p += rd;
+	    n -= rd;
+	    if (r == Gio::CONVERTER_FINISHED) {
+		return true;
+	    }
+	}
+    } catch (Glib::Error& e) {
+	return false;
+    }
+}
+
+// writes the metadata into jw and returns the frame to be sent in
+// front of the message
+std::string JsonAttachment::make_frame(const float *data, unsigned int count, int accept, JsonWriter& jw) {
+    std::string payload(reinterpret_cast<const char*>(data), count * sizeof(float));
+    swap_float_le(&payload[0], count);
+    int enc = enc_f32;
+    // audio data doesn't compress well, only worth it for larger
+    // chunks (impulse responses)
+    if ((accept & accept_deflate) && payload.size() >= 65536) {
+	std::string z;
+	if (run_converter(Gio::ZlibCompressor::create(Gio::ZLIB_COMPRESSOR_FORMAT_RAW, -1),
+			  payload.data(), payload.size(), z) && z.size() < payload.size()) {
+	    payload.swap(z);
+	    enc = enc_f32_deflate;
+	}
+    }
+    jw.begin_object();
+    jw.write_key("attachment");
+    jw.begin_object();
+    jw.write_kv("encoding", enc);
+    jw.write_kv("count", count);
+    jw.write_kv("length", static_cast<unsigned int>(payload.size()));
+    jw.end_object();
+    jw.end_object();
+    guint32 len = GUINT32_TO_LE(payload.size());
+    std::string frame(1, static_cast<char>(frame_marker));
+    frame.append(reinterpret_cast<const char*>(&len), sizeof(len));
+    frame += payload;
+    return frame;
+}
+
+// header: first header_size bytes of a frame
+unsigned int JsonAttachment::payload_length(const std::string& header) {
+    guint32 len;
+    memcpy(&len, header.data()+1, sizeof(len));
+    return GUINT32_FROM_LE(len);
+}
+
+// reads the metadata object written by make_frame; returns the
+// decoded samples (allocated with new[])
+float *JsonAttachment::read(JsonParser& jp, const std::string& payload, unsigned int *count) {
+    int enc = -1;
+    unsigned int n = 0;
+    unsigned int length = 0;
+    jp.next(JsonParser::begin_object);
+    jp.next(JsonParser::value_key);
+    if (jp.current_value() != "attachment") {
+	throw JsonException("attachment expected");
+    }
+    jp.next(JsonParser::begin_object);
+    while (jp.peek() != JsonParser::end_object) {
+	jp.next(JsonParser::value_key);
+	if (jp.read_kv("encoding", enc) ||
+	    jp.read_kv("count", n) ||
+	    jp.read_kv("length", length)) {
+	} else {
+	    jp.skip_object();
+	}
+    }
+    jp.next(JsonParser::end_object);
+    jp.next(JsonParser::end_object);
+    if (length != payload.size()) {
+	throw JsonException("attachment: length mismatch");
+    }
+    std::string raw;
+    const std::string *p = &payload;
+    if (enc == enc_f32_deflate) {
+	if (!run_converter(Gio::ZlibDecompressor::create(Gio::ZLIB_COMPRESSOR_FORMAT_RAW),
+			   payload.data(), payload.size(), raw)) {
+	    throw JsonException("attachment: bad compressed data");
+	}
+	p = &raw;
+    } else if (enc != enc_f32) {
+	throw JsonException("attachment: unknown encoding");
+    }
+    if (p->size() != n * sizeof(float)) {
+	throw JsonException("attachment: size mismatch");
+    }
+    float *data = new float[n];
+    memcpy(data, p->data(), p->size());
+    swap_float_le(reinterpret_cast<char*>(data), n);
+    *count = n;
+    return data;
+}
+
+
 /****************************************************************
  ** JsonParser
  */
@@ -720,12 +842,33 @@ void JsonReader::close() {
     JsonParser::close();
 }
 
+// size of fn, -1 if it doesn't exist
+static off_t file_size(const std::string& fn) {
+    struct stat st;
+    if (stat(fn.c_str(), &st) != 0) {
+	return -1;
+    }
+    return st.st_size;
+}
+
 JsonParser *StateFile::create_reader() {
+    if (!read_only) {
+	journal.flush();
+    }
     if (is) {
 	is->seekg(0);
     } else {
 	check_mtime(filename, mtime);
-	is = new ifstream(filename.c_str());
+	std::string text;
+	if (read_only) {
+	    // the journal of a running instance is applied in memory
+	    journal_size = file_size(StateJournal::journal_name(filename));
+	}
+	if (read_only && StateJournal::read(filename, text)) {
+	    is = new istringstream(text);
+	} else {
+	    is = new ifstream(filename.c_str());
+	}
     }
     JsonReader *jp = new JsonReader(is);
     jp->next(JsonParser::begin_array);
@@ -744,6 +887,7 @@ JsonParser *StateFile::create_reader() {
 }
 
 void StateFile::set_filename(const string& fn) {
+    journal.set_filename(fn);
     filename = fn;
     delete is;
     is = 0;
@@ -753,7 +897,15 @@ void StateFile::ensure_is_current() {
     if (filename.empty() || !mtime) {
 	return;
     }
-    if (check_mtime(filename, mtime)) {
+    bool current = check_mtime(filename, mtime);
+    if (read_only) {
+	// a running instance only appends to the journal, the state
+	// file changes when the journal is compacted
+	off_t js = journal_size;
+	journal_size = file_size(StateJournal::journal_name(filename));
+	current = current && js == journal_size;
+    }
+    if (current) {
 	return;
     }
     delete is;
@@ -847,6 +999,9 @@ ModifyStatePreservePreset::~ModifyStatePreservePreset() {
 }
 
 JsonWriter *StateFile::create_writer(bool *preserve_preset) {
+    // the file is written completely, the next save() starts anew
+    journal.flush();
+    journal.reset();
     JsonWriter *jw;
     if (*preserve_preset) {
 	jw = new ModifyStatePreservePreset(filename, preserve_preset);
@@ -858,6 +1013,534 @@ JsonWriter *StateFile::create_writer(bool *preserve_preset) {
     return jw;
 }
 
+void StateFile::save(AbstractStateIO& io, bool preserve_preset) {
+    journal.save(io, preserve_preset);
+    // file will be rewritten by the journal
+    delete is;
+    is = 0;
+}
+
+
+/****************************************************************
+ ** class StateJournal
+ */
+
+// json text of the next value of jp
+static std::string json_text(JsonParser& jp) {
+    JsonStringWriter jw;
+    switch (jp.peek()) {
+    case JsonParser::value_null:
+    case JsonParser::value_false:
+    case JsonParser::value_true:
+	jp.next();
+	jw.write_lit(jp.current_value());
+	break;
+    default:
+	jp.copy_object(jw);
+	break;
+    }
+    return jw.get_string();
+}
+
+// sections up to the end of the enclosing array
+void StateJournal::State::read(JsonParser& jp) {
+    while (jp.peek() != JsonParser::end_array) {
+	jp.next(JsonParser::value_string);
+	std::string name = jp.current_value();
+	if (sections.find(name) == sections.end()) {
+	    order.push_back(name);
+	}
+	if (name == "settings") {
+	    sections[name] = "";
+	    jp.next(JsonParser::begin_object);
+	    while (jp.peek() != JsonParser::end_object) {
+		jp.next(JsonParser::value_key);
+		std::string id = jp.current_value();
+		settings[id] = json_text(jp);
+	    }
+	    jp.next(JsonParser::end_object);
+	} else {
+	    sections[name] = json_text(jp);
+	}
+    }
+}
+
+void StateJournal::State::apply(const Entry& e) {
+    if (e.kind == 's') {
+	if (sections.find(e.key) == sections.end()) {
+	    order.push_back(e.key);
+	}
+	sections[e.key] = e.value;
+    } else {
+	if (sections.find("settings") == sections.end()) {
+	    order.insert(order.begin(), "settings");
+	    sections["settings"] = "";
+	}
+	if (e.kind == 'p') {
+	    settings[e.key] = e.value;
+	} else {
+	    settings.erase(e.key);
+	}
+    }
+}
+
+void StateJournal::State::write(JsonWriter& jw) const {
+    for (std::vector<std::string>::const_iterator i = order.begin(); i != order.end(); ++i) {
+	jw.write(*i);
+	if (*i == "settings") {
+	    jw.begin_object(true);
+	    for (std::map<std::string, std::string>::const_iterator j = settings.begin();
+		 j != settings.end(); ++j) {
+		jw.write_key(j->first);
+		jw.write_lit(j->second);
+		jw.newline();
+	    }
+	    jw.end_object(true);
+	} else {
+	    jw.write_lit(sections.find(*i)->second);
+	}
+	jw.newline();
+    }
+}
+
+StateJournal::StateJournal()
+    : filename(),
+      saved(),
+      full(true),
+      queue_mutex(),
+      queue(),
+      mutex(),
+      disk(),
+      disk_file(),
+      dirty(false),
+      records(0),
+      fd(-1),
+      read_only(false),
+      pthr(),
+      sem(),
+      stop(0),
+      thread_started(false) {
+    sem_init(&sem, 0, 0);
+}
+
+StateJournal::~StateJournal() {
+    if (thread_started) {
+	gx_system::atomic_set(&stop, 1);
+	sem_post(&sem);
+	pthread_join(pthr, NULL);
+    }
+    flush();
+    sem_destroy(&sem);
+}
+
+// write the state of the current file completely and start anew
+// with the next one
+void StateJournal::set_filename(const string& fn) {
+    if (fn == filename) {
+	return;
+    }
+    flush();
+    filename = fn;
+    reset();
+}
+
+// the state file has been written by someone else
+void StateJournal::reset() {
+    saved.clear();
+    full = true;
+    boost::mutex::scoped_lock lock(mutex);
+    disk.clear();
+    disk_file.clear();
+}
+
+void StateJournal::save(AbstractStateIO& io, bool preserve_preset) {
+    if (filename.empty() || read_only) {
+	return;
+    }
+    // current_preset is always included; the writer drops it when
+    // preserve_preset is set and the file has one
+    JsonStringWriter jw;
+    jw.begin_array();
+    io.write_state(jw, false);
+    jw.end_array();
+    JsonStringParser jp;
+    jp.get_ostream() << jw.get_string();
+    jp.start_parser();
+    State now;
+    jp.next(JsonParser::begin_array);
+    now.read(jp);
+    jp.next(JsonParser::end_array);
+    Request *r = new Request;
+    r->filename = filename;
+    r->full = full;
+    r->preserve_preset = preserve_preset;
+    for (std::map<std::string, std::string>::iterator i = now.settings.begin();
+	 i != now.settings.end(); ++i) {
+	std::map<std::string, std::string>::iterator j = saved.settings.find(i->first);
+	if (full || j == saved.settings.end() || j->second != i->second) {
+	    r->entries.push_back(Entry('p', i->first, i->second));
+	}
+    }
+    if (!full) {
+	for (std::map<std::string, std::string>::iterator i = saved.settings.begin();
+	     i != saved.settings.end(); ++i) {
+	    if (now.settings.find(i->first) == now.settings.end()) {
+		r->entries.push_back(Entry('d', i->first, ""));
+	    }
+	}
+    }
+    for (std::vector<std::string>::iterator i = now.order.begin(); i != now.order.end(); ++i) {
+	if (*i == "settings") {
+	    continue;
+	}
+	std::map<std::string, std::string>::iterator j = saved.sections.find(*i);
+	if (full || j == saved.sections.end() || j->second != now.sections[*i]) {
+	    r->entries.push_back(Entry('s', *i, now.sections[*i]));
+	}
+    }
+    saved = now;
+    if (preserve_preset) {
+	// compare with the file version next time
+	saved.sections.erase("current_preset");
+    }
+    full = false;
+    if (r->entries.empty()) {
+	delete r;
+	return;
+    }
+    {
+	boost::mutex::scoped_lock lock(queue_mutex);
+	queue.push_back(r);
+    }
+    if (!thread_started) {
+	if (pthread_create(&pthr, NULL, run_thread, this)) {
+	    gx_print_error(_("save state"), _("can't create thread for writing the state"));
+	    flush();
+	    return;
+	}
+	thread_started = true;
+    }
+    sem_post(&sem);
+}
+
+// writes data to fn and waits until it's on disk
+static bool write_synced(const std::string& fn, const std::string& data) {
+    int fd = ::open(fn.c_str(), O_WRONLY|O_CREAT|O_TRUNC, 0644);
+    if (fd < 0) {
+	return false;
+    }
+    const char *p = data.data();
+    size_t n = data.size();
+    while (n > 0) {
+	ssize_t k = ::write(fd, p, n);
+	if (k <= 0) {
+	    break;
+	}
+	p += k;
+	n -= k;
+    }
+    bool ok = n == 0 && fsync(fd) == 0;
+    return ::close(fd) == 0 && ok;
+}
+
+// makes a rename or unlink in the directory of fn durable
+static void sync_dir(const std::string& fn) {
+    int fd = ::open(Glib::path_get_dirname(fn).c_str(), O_RDONLY|O_DIRECTORY);
+    if (fd < 0) {
+	return;
+    }
+    fsync(fd);
+    ::close(fd);
+}
+
+// opens the journal of fn for appending and locks it; -1 when it
+// doesn't exist (flags without O_CREAT) or is locked by another
+// instance
+int StateJournal::lock_journal(const std::string& fn, int flags) {
+    std::string jn = journal_name(fn);
+    int jfd = ::open(jn.c_str(), O_WRONLY|O_APPEND|flags, 0644);
+    if (jfd < 0) {
+	return -1;
+    }
+    // the owner might have compacted and removed it before our lock
+    struct stat a, b;
+    if (flock(jfd, LOCK_EX|LOCK_NB) != 0 || fstat(jfd, &a) != 0 ||
+	stat(jn.c_str(), &b) != 0 || a.st_ino != b.st_ino || a.st_dev != b.st_dev) {
+	::close(jfd);
+	return -1;
+    }
+    return jfd;
+}
+
+// sections of the state file fn (none if it doesn't exist); false
+// on a parse error
+bool StateJournal::read_file(const std::string& fn, State& st) {
+    ifstream is(fn.c_str());
+    if (!is.good()) {
+	return true;
+    }
+    try {
+	JsonParser jp(&is);
+	jp.next(JsonParser::begin_array);
+	SettingsFileHeader header;
+	header.read(jp);
+	st.read(jp);
+    } catch (JsonException& e) {
+	return false;
+    }
+    return true;
+}
+
+// applies the records of journal js to st and returns their number;
+// a torn last record (crash while writing) ends the journal
+int StateJournal::replay(istream& js, State& st) {
+    int n = 0;
+    std::string line;
+    while (std::getline(js, line)) {
+	istringstream ls(line);
+	JsonParser jp(&ls);
+	try {
+	    jp.next(JsonParser::begin_array);
+	    jp.next(JsonParser::value_string);
+	    char kind = jp.current_value()[0];
+	    jp.next(JsonParser::value_string);
+	    std::string key = jp.current_value();
+	    std::string value;
+	    if (kind != 'd') {
+		value = json_text(jp);
+	    }
+	    jp.next(JsonParser::end_array);
+	    st.apply(Entry(kind, key, value));
+	    n++;
+	} catch (JsonException& e) {
+	    break;
+	}
+    }
+    return n;
+}
+
+// state file fn with its journal applied, for users which must not
+// write (the journal may belong to a running instance); false when
+// there is no journal or the state file can't be parsed
+bool StateJournal::read(const std::string& fn, std::string& text) {
+    // journal first: when it's compacted meanwhile, it is applied to
+    // the new state file, which already contains it
+    ifstream js(journal_name(fn).c_str());
+    if (!js.good()) {
+	return false;
+    }
+    State st;
+    if (!read_file(fn, st) || !replay(js, st)) {
+	return false;
+    }
+    ostringstream os;
+    JsonWriter jw(&os);
+    jw.begin_array();
+    SettingsFileHeader::write(jw);
+    st.write(jw);
+    jw.end_array(true);
+    jw.close();
+    text = os.str();
+    return true;
+}
+
+// mutex must be held; a journal left by a crashed instance is
+// applied and compacted, the journal of a running instance is not
+// touched
+void StateJournal::load(const std::string& fn) {
+    disk.clear();
+    disk_file = fn;
+    dirty = false;
+    records = 0;
+    if (fd >= 0) {
+	::close(fd);
+	fd = -1;
+    }
+    int jfd = -1;
+    ifstream js;
+    if (access(journal_name(fn).c_str(), F_OK) == 0) {
+	jfd = lock_journal(fn, 0);
+	if (jfd < 0) {
+	    gx_print_warning(_("save state"),
+			     boost::format(_("%1% is in use by another instance")) % journal_name(fn));
+	} else {
+	    js.open(journal_name(fn).c_str());
+	}
+    }
+    if (!read_file(fn, disk)) {
+	gx_print_warning(_("save state"), boost::format(_("parse error in %1%")) % fn);
+    }
+    if (jfd < 0) {
+	return;
+    }
+    fd = jfd;
+    records = replay(js, disk);
+    if (records) {
+	dirty = true;
+	compact();
+    } else {
+	unlink(journal_name(fn).c_str());
+	::close(fd);
+	fd = -1;
+    }
+}
+
+// mutex must be held; applies r to disk and returns the effective
+// changes in changes
+void StateJournal::apply(const Request& r, std::vector<Entry>& changes) {
+    if (r.full) {
+	// parameters missing in a complete state are journaled as
+	// removed, so that the journal holds all changes
+	std::set<std::string> ids;
+	for (std::vector<Entry>::const_iterator i = r.entries.begin(); i != r.entries.end(); ++i) {
+	    if (i->kind == 'p') {
+		ids.insert(i->key);
+	    }
+	}
+	for (std::map<std::string, std::string>::iterator i = disk.settings.begin();
+	     i != disk.settings.end(); ++i) {
+	    if (ids.find(i->first) == ids.end()) {
+		changes.push_back(Entry('d', i->first, ""));
+	    }
+	}
+	disk.settings.clear();
+    }
+    for (std::vector<Entry>::const_iterator i = r.entries.begin(); i != r.entries.end(); ++i) {
+	if (i->kind == 's' && r.preserve_preset && i->key == "current_preset" &&
+	    disk.sections.find(i->key) != disk.sections.end()) {
+	    continue;
+	}
+	disk.apply(*i);
+	changes.push_back(*i);
+    }
+    if (!changes.empty()) {
+	dirty = true;
+    }
+}
+
+// mutex must be held; on failure the changes are only in disk (and
+// get into the state file by the next compact())
+bool StateJournal::append(const std::vector<Entry>& entries) {
+    if (entries.empty() || disk_file.empty()) {
+	return true;
+    }
+    if (fd < 0) {
+	fd = lock_journal(disk_file, O_CREAT);
+	if (fd < 0) {
+	    gx_print_error(_("save state"),
+			   boost::format(_("couldn't open %1%")) % journal_name(disk_file));
+	    return false;
+	}
+	sync_dir(disk_file);  // new journal
+    }
+    std::string buf;
+    for (std::vector<Entry>::const_iterator i = entries.begin(); i != entries.end(); ++i) {
+	JsonStringWriter jw;
+	jw.begin_array();
+	jw.write(std::string(1, i->kind));
+	jw.write(i->key);
+	if (i->kind != 'd') {
+	    jw.write_lit(i->value);
+	}
+	jw.end_array();
+	buf += jw.get_string();
+	buf += '\n';
+    }
+    if (::write(fd, buf.data(), buf.size()) != static_cast<ssize_t>(buf.size()) ||
+	fdatasync(fd) != 0) {
+	gx_print_error(_("save state"),
+		       boost::format(_("couldn't write %1%")) % journal_name(disk_file));
+	return false;
+    }
+    records += entries.size();
+    return true;
+}
+
+// mutex must be held; writes disk as new state file and removes
+// the journal (when it's ours); the new file is on disk before it
+// replaces the old one, and the rename before the journal is gone
+void StateJournal::compact() {
+    if (disk_file.empty() || !dirty) {
+	return;
+    }
+    ostringstream os;
+    JsonWriter jw(&os);
+    jw.begin_array();
+    SettingsFileHeader::write(jw);
+    disk.write(jw);
+    jw.end_array(true);
+    jw.close();
+    string tmpfile = disk_file + "_tmp";
+    if (!write_synced(tmpfile, os.str())) {
+	gx_print_error(_("save state"), boost::format(_("couldn't write %1%")) % tmpfile);
+	unlink(tmpfile.c_str());
+	return;
+    }
+    if (rename(tmpfile.c_str(), disk_file.c_str()) != 0) {
+	gx_print_error(_("save state"),
+		       boost::format(_("couldn't rename %1% to %2%")) % tmpfile % disk_file);
+	return;
+    }
+    sync_dir(disk_file);
+    if (fd >= 0) {
+	unlink(journal_name(disk_file).c_str());  // still locked
+	::close(fd);
+	fd = -1;
+    }
+    records = 0;
+    dirty = false;
+}
+
+// mutex must be held; all changes are appended to the journal, a
+// complete state or a long journal is compacted afterwards
+void StateJournal::process_queue() {
+    std::list<Request*> l;
+    {
+	boost::mutex::scoped_lock lock(queue_mutex);
+	l.swap(queue);
+    }
+    for (std::list<Request*>::iterator i = l.begin(); i != l.end(); ++i) {
+	Request *r = *i;
+	if (r->filename != disk_file) {
+	    compact();
+	    load(r->filename);
+	}
+	std::vector<Entry> changes;
+	apply(*r, changes);
+	if (!append(changes) || r->full || records > max_records) {
+	    compact();
+	}
+	delete r;
+    }
+}
+
+// make the state file complete (waits for the writer)
+void StateJournal::flush() {
+    boost::mutex::scoped_lock lock(mutex);
+    if (read_only) {
+	return;
+    }
+    process_queue();
+    if (disk_file.empty() && !filename.empty() &&
+	access(journal_name(filename).c_str(), F_OK) == 0) {
+	load(filename);  // journal of a crashed instance
+    }
+    compact();
+}
+
+void *StateJournal::run_thread(void *p) {
+    StateJournal& self = *static_cast<StateJournal*>(p);
+    while (true) {
+	sem_wait(&self.sem);
+	if (gx_system::atomic_get(self.stop)) {
+	    return NULL;
+	}
+	boost::mutex::scoped_lock lock(self.mutex);
+	self.process_queue();
+    }
+    return NULL;
+}
+
 
 /****************************************************************
  ** class PresetFile
@@ -1357,6 +2040,398 @@ PresetFile::iterator PresetFile::begin() {
 }
 
 
+/****************************************************************
+ ** class PresetIndex
+ */
+
+static bool ends_with(const std::string& s, const char *t) {
+    size_t n = strlen(t);
+    return s.size() >= n && s.compare(s.size()-n, n, t) == 0;
+}
+
+// the "engine" object of a preset
+void PresetIndex::Preset::read_engine(JsonParser& jp) {
+    jp.next(JsonParser::begin_object);
+    while (jp.peek() != JsonParser::end_object) {
+	jp.next(JsonParser::value_key);
+	std::string id = jp.current_value();
+	switch (jp.peek()) {
+	case JsonParser::value_number:
+	    jp.next();
+	    if (ends_with(id, ".on_off") && jp.current_value_float() != 0) {
+		plugins.push_back(id.substr(0, id.size()-7));
+	    }
+	    break;
+	case JsonParser::value_string:
+	    jp.next();
+	    if (ends_with(id, ".IRFile")) {
+		if (!jp.current_value().empty()) {
+		    irfiles.push_back(jp.current_value());
+		}
+	    } else if (!ends_with(id, ".pp")) {
+		params[id] = jp.current_value();
+	    }
+	    break;
+	case JsonParser::begin_object:
+	    // convolver settings (jconv.IRFile, ...)
+	    jp.next();
+	    while (jp.peek() != JsonParser::end_object) {
+		jp.next(JsonParser::value_key);
+		if (ends_with(jp.current_value(), ".IRFile") &&
+		    jp.peek() == JsonParser::value_string) {
+		    jp.next();
+		    if (!jp.current_value().empty()) {
+			irfiles.push_back(jp.current_value());
+		    }
+		} else {
+		    jp.skip_object();
+		}
+	    }
+	    jp.next(JsonParser::end_object);
+	    break;
+	default:
+	    jp.skip_object();
+	    break;
+	}
+    }
+    jp.next(JsonParser::end_object);
+}
+
+void PresetIndex::Preset::readJSON(JsonParser& jp) {
+    jp.next(JsonParser::begin_array);
+    jp.next(JsonParser::value_string);
+    name = jp.current_value();
+    jp.next(JsonParser::begin_array);
+    while (jp.peek() != JsonParser::end_array) {
+	jp.next(JsonParser::value_string);
+	plugins.push_back(jp.current_value());
+    }
+    jp.next(JsonParser::end_array);
+    jp.next(JsonParser::begin_array);
+    while (jp.peek() != JsonParser::end_array) {
+	jp.next(JsonParser::value_string);
+	irfiles.push_back(jp.current_value());
+    }
+    jp.next(JsonParser::end_array);
+    jp.next(JsonParser::begin_object);
+    while (jp.peek() != JsonParser::end_object) {
+	jp.next(JsonParser::value_key);
+	std::string id = jp.current_value();
+	jp.next(JsonParser::value_string);
+	params[id] = jp.current_value();
+    }
+    jp.next(JsonParser::end_object);
+    jp.next(JsonParser::end_array);
+}
+
+void PresetIndex::Preset::writeJSON(JsonWriter& jw) const {
+    jw.begin_array();
+    jw.write(name);
+    jw.begin_array();
+    for (std::vector<std::string>::const_iterator i = plugins.begin(); i != plugins.end(); ++i) {
+	jw.write(*i);
+    }
+    jw.end_array();
+    jw.begin_array();
+    for (std::vector<Glib::ustring>::const_iterator i = irfiles.begin(); i != irfiles.end(); ++i) {
+	jw.write(*i);
+    }
+    jw.end_array();
+    jw.begin_object();
+    for (std::map<std::string, Glib::ustring>::const_iterator i = params.begin(); i != params.end(); ++i) {
+	jw.write_key(i->first);
+	jw.write(i->second);
+    }
+    jw.end_object();
+    jw.end_array(true);
+}
+
+PresetIndex::PresetIndex()
+    : index_file(),
+      mutex(),
+      banks(),
+      files(),
+      loaded(false),
+      pthr(),
+      sem(),
+      stop(0),
+      thread_started(false) {
+    sem_init(&sem, 0, 0);
+}
+
+PresetIndex::~PresetIndex() {
+    if (thread_started) {
+	gx_system::atomic_set(&stop, 1);
+	sem_post(&sem);
+	pthread_join(pthr, NULL);
+    }
+    sem_destroy(&sem);
+}
+
+// set the banks to index (bank list order) and start the scan
+void PresetIndex::update(const FileList& l) {
+    if (index_file.empty()) {
+	return;
+    }
+    {
+	boost::mutex::scoped_lock lock(mutex);
+	files = l;
+    }
+    if (!thread_started) {
+	if (pthread_create(&pthr, NULL, run_thread, this)) {
+	    gx_print_error(_("preset index"), _("can't create thread for indexing presets"));
+	    index_file.clear();
+	    return;
+	}
+	thread_started = true;
+    }
+    sem_post(&sem);
+}
+
+// thread; returns false if the file can't be parsed
+bool PresetIndex::parse_bank(const std::string& fname, Bank& b) {
+    ifstream is(fname.c_str());
+    if (is.fail()) {
+	return false;
+    }
+    try {
+	JsonParser jp(&is);
+	jp.next(JsonParser::begin_array);
+	SettingsFileHeader header;
+	header.read(jp);
+	while (jp.peek() != JsonParser::end_array) {
+	    jp.next(JsonParser::value_string);
+	    b.presets.push_back(Preset());
+	    Preset& p = b.presets.back();
+	    p.name = jp.current_value();
+	    if (jp.peek() != JsonParser::begin_object) {
+		jp.skip_object();
+		continue;
+	    }
+	    jp.next(JsonParser::begin_object);
+	    while (jp.peek() != JsonParser::end_object) {
+		jp.next(JsonParser::value_key);
+		if (jp.current_value() == "engine") {
+		    p.read_engine(jp);
+		} else {
+		    jp.skip_object();
+		}
+	    }
+	    jp.next(JsonParser::end_object);
+	}
+	jp.next(JsonParser::end_array);
+    } catch (JsonException& e) {
+	b.presets.clear();
+	return false;
+    }
+    return true;
+}
+
+// thread
+void PresetIndex::load() {
+    ifstream is(index_file.c_str());
+    if (is.fail()) {
+	return;
+    }
+    BankMap m;
+    try {
+	JsonParser jp(&is);
+	jp.next(JsonParser::begin_array);
+	jp.next(JsonParser::value_string);
+	if (jp.current_value() != "gx_preset_index") {
+	    return;
+	}
+	jp.next(JsonParser::value_number);
+	if (jp.current_value_int() != 1) {
+	    return;
+	}
+	jp.next(JsonParser::begin_object);
+	while (jp.peek() != JsonParser::end_object) {
+	    jp.next(JsonParser::value_key);
+	    Bank& b = m[jp.current_value()];
+	    jp.next(JsonParser::begin_array);
+	    jp.next(JsonParser::value_number);
+	    b.mtime = strtoll(jp.current_value().c_str(), 0, 10);
+	    jp.next(JsonParser::begin_array);
+	    while (jp.peek() != JsonParser::end_array) {
+		b.presets.push_back(Preset());
+		b.presets.back().readJSON(jp);
+	    }
+	    jp.next(JsonParser::end_array);
+	    jp.next(JsonParser::end_array);
+	}
+	jp.next(JsonParser::end_object);
+	jp.next(JsonParser::end_array);
+    } catch (JsonException& e) {
+	return;  // rebuild
+    }
+    boost::mutex::scoped_lock lock(mutex);
+    banks.swap(m);
+}
+
+// thread
+void PresetIndex::save() {
+    ostringstream os;
+    {
+	boost::mutex::scoped_lock lock(mutex);
+	JsonWriter jw(&os);
+	jw.begin_array();
+	jw.write("gx_preset_index");
+	jw.write(1);
+	jw.begin_object(true);
+	for (BankMap::iterator i = banks.begin(); i != banks.end(); ++i) {
+	    jw.write_key(i->first);
+	    jw.begin_array();
+	    jw.write_lit(gx_system::to_string(static_cast<long long>(i->second.mtime)));
+	    jw.begin_array(true);
+	    for (std::vector<Preset>::iterator j = i->second.presets.begin();
+		 j != i->second.presets.end(); ++j) {
+		j->writeJSON(jw);
+	    }
+	    jw.end_array();
+	    jw.end_array(true);
+	}
+	jw.end_object(true);
+	jw.end_array(true);
+	jw.close();
+    }
+    // unique tmp name: several engines (--rigs) might save an index
+    // at the same time
+    std::string tmpfile = index_file + "_XXXXXX";
+    std::vector<char> tmpl(tmpfile.begin(), tmpfile.end());
+    tmpl.push_back('\0');
+    int fd = mkstemp(&tmpl[0]);
+    if (fd < 0) {
+	return;
+    }
+    tmpfile = &tmpl[0];
+    fchmod(fd, 0644);
+    std::string data = os.str();
+    bool ok = ::write(fd, data.data(), data.size()) == static_cast<ssize_t>(data.size());
+    if (::close(fd) != 0 || !ok || rename(tmpfile.c_str(), index_file.c_str()) != 0) {
+	unlink(tmpfile.c_str());
+    }
+}
+
+// thread: reparse the banks with changed mtime
+void PresetIndex::run() {
+    if (!loaded) {
+	load();
+	loaded = true;
+    }
+    FileList l;
+    {
+	boost::mutex::scoped_lock lock(mutex);
+	l = files;
+    }
+    bool changed = false;
+    std::set<std::string> wanted;
+    for (FileList::iterator i = l.begin(); i != l.end(); ++i) {
+	if (gx_system::atomic_get(stop)) {
+	    return;
+	}
+	wanted.insert(i->first);
+	bool known;
+	time_t m = 0;
+	{
+	    boost::mutex::scoped_lock lock(mutex);
+	    BankMap::iterator j = banks.find(i->first);
+	    known = (j != banks.end());
+	    if (known) {
+		m = j->second.mtime;
+	    }
+	}
+	time_t oldm = m;
+	if (check_mtime(i->first, m) && known) {
+	    continue;
+	}
+	if (known && m == 0 && oldm == 0) {
+	    continue;  // still missing
+	}
+	Bank b;
+	b.mtime = m;
+	if (m) {
+	    parse_bank(i->first, b);  // unparsable: no presets until changed
+	}
+	boost::mutex::scoped_lock lock(mutex);
+	banks[i->first].presets.swap(b.presets);
+	banks[i->first].mtime = b.mtime;
+	changed = true;
+    }
+    {
+	boost::mutex::scoped_lock lock(mutex);
+	for (BankMap::iterator i = banks.begin(); i != banks.end(); ) {
+	    if (wanted.find(i->first) == wanted.end()) {
+		banks.erase(i++);
+		changed = true;
+	    } else {
+		++i;
+	    }
+	}
+    }
+    if (changed) {
+	save();
+    }
+}
+
+void *PresetIndex::run_thread(void *p) {
+    PresetIndex& self = *static_cast<PresetIndex*>(p);
+    while (true) {
+	sem_wait(&self.sem);
+	if (gx_system::atomic_get(self.stop)) {
+	    return NULL;
+	}
+	self.run();
+    }
+    return NULL;
+}
+
+static bool contains_nocase(const Glib::ustring& s, const Glib::ustring& t) {
+    return s.casefold().find(t) != Glib::ustring::npos;
+}
+
+// query fields are and-ed, empty fields match everything; banks
+// which are not indexed yet are missing in the result
+void PresetIndex::search(const PresetQuery& q, std::vector<PresetMatch>& result) {
+    Glib::ustring name = q.name.casefold();
+    Glib::ustring irfile = q.irfile.casefold();
+    Glib::ustring value = q.value.casefold();
+    boost::mutex::scoped_lock lock(mutex);
+    for (FileList::iterator i = files.begin(); i != files.end(); ++i) {
+	BankMap::iterator b = banks.find(i->first);
+	if (b == banks.end()) {
+	    continue;
+	}
+	for (std::vector<Preset>::iterator p = b->second.presets.begin();
+	     p != b->second.presets.end(); ++p) {
+	    if (!name.empty() && !contains_nocase(p->name, name)) {
+		continue;
+	    }
+	    if (!q.plugin.empty() &&
+		std::find(p->plugins.begin(), p->plugins.end(), q.plugin) == p->plugins.end()) {
+		continue;
+	    }
+	    if (!irfile.empty()) {
+		std::vector<Glib::ustring>::iterator f = p->irfiles.begin();
+		while (f != p->irfiles.end() && !contains_nocase(*f, irfile)) {
+		    ++f;
+		}
+		if (f == p->irfiles.end()) {
+		    continue;
+		}
+	    }
+	    if (!q.param.empty()) {
+		std::map<std::string, Glib::ustring>::iterator v = p->params.find(q.param);
+		if (v == p->params.end() || !contains_nocase(v->second, value)) {
+		    continue;
+		}
+	    }
+	    result.push_back(PresetMatch(i->second, p->name));
+	}
+    }
+}
+
+
 /****************************************************************
  ** class PresetBanks
  */
@@ -1364,7 +2439,7 @@ PresetFile::iterator PresetFile::begin() {
 static const char *std_presetname_postfix = ".gx";
 
 PresetBanks::PresetBanks()
-    : banklist(), filepath(), mtime(), preset_dir() {
+    : banklist(), filepath(), mtime(), preset_dir(), index() {
 }
 
 PresetBanks::~PresetBanks() {
@@ -1483,6 +2558,27 @@ bool PresetBanks::has_file(const std::string& file) const {
     return false;
 }
 
+void PresetBanks::start_index(const std::string& index_file) {
+    index.set_filename(index_file);
+    update_index();
+}
+
+// call when the bank list or a bank file changed
+void PresetBanks::update_index() {
+    PresetIndex::FileList l;
+    for (bl_type::iterator i = banklist.begin(); i != banklist.end(); ++i) {
+	l.push_back(std::make_pair((*i)->get_filename(), (*i)->get_name()));
+    }
+    index.update(l);
+}
+
+// result is from the current index; also starts a rescan, so that
+// changed bank files show up in the next search
+void PresetBanks::search(const PresetQuery& q, std::vector<PresetMatch>& result) {
+    index.search(q, result);
+    update_index();
+}
+
 void PresetBanks::collect_lost_banks(const char* scratchpad_name, const char* scratchpad_file) {
     Glib::RefPtr<Gio::FileEnumerator> en = Gio::File::create_for_path(
 	preset_dir)->enumerate_children(G_FILE_ATTRIBUTE_STANDARD_NAME);
@@ -1838,9 +2934,7 @@ void GxSettingsBase::set_source_to_state() {
 void GxSettingsBase::save_to_state(bool preserve_preset) {
     gx_print_info("write state",boost::format("%2% [%1%]")
 			     % preserve_preset % statefile.get_filename());
-    JsonWriter *jw = statefile.create_writer(&preserve_preset);
-    state_io->write_state(*jw, preserve_preset);
-    delete jw;
+    statefile.save(*state_io, preserve_preset);
 #if 0
     if (!preserve_preset && setting_is_preset()) {
 	set_source_to_state();
@@ -191,10 +191,10 @@ void LiveLooper::init_static(unsigned int samplingFreq, PluginDef *p)
 void LiveLooper::mem_alloc()
 {
     try {
-        if (!tape1) tape1 = new float[tape1_size]();
-        if (!tape2) tape2 = new float[tape2_size]();
-        if (!tape3) tape3 = new float[tape3_size]();
-        if (!tape4) tape4 = new float[tape4_size]();
+        if (!tape1) tape1 = rt_alloc<float>(tape1_size);
+        if (!tape2) tape2 = rt_alloc<float>(tape2_size);
+        if (!tape3) tape3 = rt_alloc<float>(tape3_size);
+        if (!tape4) tape4 = rt_alloc<float>(tape4_size);
         } catch(...) {
             gx_print_error("dubber", "out of memory");
             return;
@@ -207,10 +207,10 @@ void LiveLooper::mem_free()
 {
     gx_system::atomic_set(&ready,0);
     mem_allocated = false;
-    if (tape1) { delete[] tape1; tape1 = 0; }
-    if (tape2) { delete[] tape2; tape2 = 0; }
-    if (tape3) { delete[] tape3; tape3 = 0; }
-    if (tape4) { delete[] tape4; tape4 = 0; }
+    if (tape1) { rt_free(tape1); tape1 = 0; }
+    if (tape2) { rt_free(tape2); tape2 = 0; }
+    if (tape3) { rt_free(tape3); tape3 = 0; }
+    if (tape4) { rt_free(tape4); tape4 = 0; }
 }
 
 int LiveLooper::do_resample(int inrate, int insize, float *input, int maxsize) {
@@ -267,10 +267,10 @@ inline int LiveLooper::load_from_wave(std::string fname, float **tape, int tape_
                 res = true;
             }
             if(i>n) {
-                delete[] *tape;
+                rt_free(*tape);
                 *tape = NULL;
                 try {
-                    *tape = new float[i];
+                    *tape = rt_alloc<float>(i);
                     } catch(...) {
                     gx_print_error("dubber", "out of memory");
                     return 0;
@@ -295,10 +295,10 @@ inline int LiveLooper::load_from_wave(std::string fname, float **tape, int tape_
                 res = true;
             }
             if(i>n) {
-                delete[] *tape;
+                rt_free(*tape);
                 *tape = NULL;
                 try {
-                    *tape = new float[i];
+                    *tape = rt_alloc<float>(i);
                     } catch(...) {
                     gx_print_error("dubber", "out of memory");
                     return 0;
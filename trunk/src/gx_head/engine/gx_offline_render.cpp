@@ -0,0 +1,294 @@
+/*
+ * Copyright (C) 2009, 2010 Hermann Meyer, James Warden, Andreas Degert
+ * Copyright (C) 2011 Pete Shorthose
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ * --------------------------------------------------------------------------
+ *
+ *  This is the offline (non-realtime) driver for the guitarix engine
+ *
+ * --------------------------------------------------------------------------
+ */
+
+#include <sys/wait.h>           // NOLINT
+#include <sndfile.hh>           // NOLINT
+#include "engine.h"             // NOLINT
+#include "gx_offline_render.h"  // NOLINT
+
+namespace gx_engine {
+
+/****************************************************************
+ ** class OfflineRenderer
+ */
+
+OfflineRenderer::OfflineRenderer(gx_system::CmdlineOptions& options, unsigned int blocksize_)
+    : engine(options.get_plugin_dir(), get_group_table(), options),
+      jack(engine),
+      settings(options, jack, engine.stereo_convolver, midi_std_ctr,
+	       engine.controller_map, engine),
+      blocksize(blocksize_),
+      monobuf(new float[blocksize_]),
+      outbuf1(new float[blocksize_]),
+      outbuf2(new float[blocksize_]) {
+    settings.disable_autosave(true);
+    settings.disable_save_on_exit(true);
+    engine.oscilloscope.set_jack(jack);
+    // no realtime deadline: let the rt thread wait for the
+    // convolver background partitions instead of dropping them
+    engine.mono_convolver.set_sync(true);
+    engine.stereo_convolver.set_sync(true);
+    engine.cabinet.set_sync(true);
+    engine.cabinet_st.set_sync(true);
+    engine.preamp.set_sync(true);
+    engine.preamp_st.set_sync(true);
+    engine.contrast.set_sync(true);
+    engine.get_param().set_init_values();
+}
+
+OfflineRenderer::~OfflineRenderer() {
+    engine.set_stateflag(ModuleSequencer::SF_INITIALIZING);
+    delete[] monobuf;
+    delete[] outbuf1;
+    delete[] outbuf2;
+}
+
+bool OfflineRenderer::load_preset(const Glib::ustring& bank, const Glib::ustring& name) {
+    gx_system::PresetFile *pf = settings.banks.get_file(bank);
+    if (!pf) {
+	gx_print_error(_("render"), boost::format(_("bank '%1%' not found")) % bank);
+	return false;
+    }
+    if (!pf->has_entry(name)) {
+	gx_print_error(_("render"), boost::format(_("bank '%1%' has no preset '%2%'")) % bank % name);
+	return false;
+    }
+    settings.load_preset(pf, name);
+    return true;
+}
+
+// execute pending idle / timeout handler (rack changes, convolver
+// updates); there is no main loop running while rendering
+void OfflineRenderer::run_pending() {
+    Glib::RefPtr<Glib::MainContext> ctx = Glib::MainContext::get_default();
+    while (ctx->iteration(false));
+}
+
+void OfflineRenderer::start_engine(unsigned int samplerate) {
+    AVOIDDENORMALS();
+    // with the chains stopped the sequencer doesn't wait for the
+    // (nonexistent) rt thread
+    engine.set_stateflag(ModuleSequencer::SF_INITIALIZING);
+    engine.init(samplerate, blocksize, SCHED_OTHER, 0);
+    run_pending();
+    engine.update_module_lists();
+    engine.clear_rack_changed();
+    engine.clear_module_states();
+    engine.clear_stateflag(ModuleSequencer::SF_INITIALIZING);
+    // run the ramp-up on silence so the file starts at full level
+    memset(monobuf, 0, blocksize*sizeof(float));
+    float *silence = monobuf;
+    for (int i = 0; i < 1000; ++i) {
+	if (engine.mono_chain.get_ramp_mode() == ProcessingChainBase::ramp_mode_off &&
+	    engine.stereo_chain.get_ramp_mode() == ProcessingChainBase::ramp_mode_off) {
+	    break;
+	}
+	process_block(silence);
+	memset(monobuf, 0, blocksize*sizeof(float));
+    }
+}
+
+// same data flow as GxJack::gx_jack_process + gx_jack_insert_process
+// in single client mode
+inline void OfflineRenderer::process_block(float *input) {
+    engine.mono_chain.process(blocksize, input, monobuf);
+    engine.mono_chain.post_rt_finished();
+    engine.stereo_chain.process(blocksize, monobuf, monobuf, outbuf1, outbuf2);
+    engine.stereo_chain.post_rt_finished();
+}
+
+bool OfflineRenderer::render(const std::string& infile, const std::string& outfile,
+			     unsigned int samplerate) {
+    SndfileHandle in(infile);
+    if (!in) {
+	gx_print_error(_("render"), boost::format(_("can't open %1%: %2%"))
+		       % infile % in.strError());
+	return false;
+    }
+    if (!samplerate) {
+	if (in.samplerate() <= 0) {
+	    gx_print_error(_("render"), boost::format(_("%1%: invalid samplerate %2%"))
+			   % infile % in.samplerate());
+	    return false;
+	}
+	samplerate = in.samplerate();
+    }
+    gx_resample::StreamingResampler resamp;
+    bool resampling = (static_cast<int>(samplerate) != in.samplerate());
+    if (resampling && !resamp.setup(in.samplerate(), samplerate, 1)) {
+	gx_print_error(_("render"), boost::format(_("can't resample %1% from %2% to %3% Hz"))
+		       % infile % in.samplerate() % samplerate);
+	return false;
+    }
+    SndfileHandle out(outfile, SFM_WRITE, SF_FORMAT_WAV | SF_FORMAT_FLOAT, 2, samplerate);
+    if (!out) {
+	gx_print_error(_("render"), boost::format(_("can't create %1%: %2%"))
+		       % outfile % out.strError());
+	return false;
+    }
+    start_engine(samplerate);
+
+    int nchan = in.channels();
+    std::vector<float> frames(blocksize * nchan);
+    std::vector<float> mono(blocksize);
+    std::vector<float> rsbuf(
+	resampling ? max(resamp.get_max_out_size(blocksize), resamp.get_max_flush_size()) : 0);
+    std::vector<float> pending;  // engine input, processed up to pos
+    size_t pos = 0;
+    std::vector<float> inter(2 * blocksize);
+    std::vector<float> block(blocksize);
+    sf_count_t written = 0;
+    bool eof = false;
+    while (!eof || pos < pending.size()) {
+	if (!eof) {
+	    pending.erase(pending.begin(), pending.begin() + pos);  // less than blocksize
+	    pos = 0;
+	    sf_count_t n = in.readf(&frames[0], blocksize);
+	    if (n <= 0) {
+		eof = true;
+		if (resampling) {
+		    int k = resamp.flush(&rsbuf[0]);
+		    pending.insert(pending.end(), rsbuf.begin(), rsbuf.begin() + k);
+		}
+	    } else {
+		// guitar DI tracks: use the downmix of all channels
+		for (sf_count_t i = 0; i < n; ++i) {
+		    float s = 0;
+		    for (int c = 0; c < nchan; ++c) {
+			s += frames[i*nchan+c];
+		    }
+		    mono[i] = s / nchan;
+		}
+		if (resampling) {
+		    int k = resamp.process(n, &mono[0], &rsbuf[0]);
+		    pending.insert(pending.end(), rsbuf.begin(), rsbuf.begin() + k);
+		} else {
+		    pending.insert(pending.end(), mono.begin(), mono.begin() + n);
+		}
+	    }
+	}
+	while (pending.size() - pos >= blocksize || (eof && pos < pending.size())) {
+	    unsigned int cnt = min<size_t>(blocksize, pending.size() - pos);
+	    std::copy(pending.begin() + pos, pending.begin() + pos + cnt, block.begin());
+	    std::fill(block.begin() + cnt, block.end(), 0.0);
+	    pos += cnt;
+	    process_block(&block[0]);
+	    if (engine.mono_chain.has_fault_pending() || engine.stereo_chain.has_fault_pending()) {
+		run_pending();  // no main loop: run the fault recovery here
+	    }
+	    for (unsigned int i = 0; i < cnt; ++i) {
+		inter[2*i] = outbuf1[i];
+		inter[2*i+1] = outbuf2[i];
+	    }
+	    if (out.writef(&inter[0], cnt) != cnt) {
+		gx_print_error(_("render"), boost::format(_("write error on %1%: %2%"))
+			       % outfile % out.strError());
+		engine.set_stateflag(ModuleSequencer::SF_INITIALIZING);
+		return false;
+	    }
+	    written += cnt;
+	}
+    }
+    engine.set_stateflag(ModuleSequencer::SF_INITIALIZING);
+    gx_print_info(_("render"), boost::format(_("%1% -> %2% (%3% frames at %4% Hz)"))
+		  % infile % outfile % written % samplerate);
+    return true;
+}
+
+static bool split_bank_preset(const Glib::ustring& s, Glib::ustring& bank, Glib::ustring& preset) {
+    Glib::ustring::size_type n = s.find(':');
+    if (n == Glib::ustring::npos) {
+	return false;
+    }
+    bank = s.substr(0, n);
+    preset = s.substr(n+1);
+    return !bank.empty() && !preset.empty();
+}
+
+static int render_subset(gx_system::CmdlineOptions& options,
+			 const std::vector<RenderJob>& jobs, unsigned int start, unsigned int step) {
+    OfflineRenderer renderer(options, options.get_render_blocksize());
+    Glib::ustring bank, preset;
+    const Glib::ustring& bp = options.get_render_preset();
+    if (bp.empty()) {
+	renderer.load_state();
+    } else if (!split_bank_preset(bp, bank, preset)) {
+	gx_print_error(_("render"), boost::format(_("bad preset specification '%1%' (use BANK:PRESET)")) % bp);
+	return jobs.size();
+    } else if (!renderer.load_preset(bank, preset)) {
+	return jobs.size();
+    }
+    int failed = 0;
+    for (unsigned int i = start; i < jobs.size(); i += step) {
+	if (!renderer.render(jobs[i].infile, jobs[i].outfile, options.get_render_samplerate())) {
+	    failed += 1;
+	}
+    }
+    return failed;
+}
+
+// Every parallel job gets its own process with its own engine
+// instance: the engine (parameter table, plugin list, convolver
+// threads) is not designed to be shared between threads.
+int OfflineRenderer::render_jobs(gx_system::CmdlineOptions& options,
+				 const std::vector<RenderJob>& jobs) {
+    unsigned int njobs = min<size_t>(options.get_render_jobs(), jobs.size());
+    if (njobs <= 1) {
+	return render_subset(options, jobs, 0, 1);
+    }
+    std::vector<pid_t> children;
+    int failed = 0;
+    for (unsigned int i = 0; i < njobs; ++i) {
+	pid_t pid = fork();
+	if (pid == 0) {
+	    int rc = render_subset(options, jobs, i, njobs);
+	    _exit(min(rc, 255));
+	}
+	if (pid < 0) {
+	    gx_print_error(_("render"), _("can't create worker process"));
+	    for (unsigned int j = i; j < jobs.size(); j += njobs) {
+		failed += 1;
+	    }
+	    continue;
+	}
+	children.push_back(pid);
+    }
+    for (std::vector<pid_t>::iterator i = children.begin(); i != children.end(); ++i) {
+	int status;
+	while (waitpid(*i, &status, 0) == -1) {
+	    if (errno != EINTR) {
+		status = -1;
+		break;
+	    }
+	}
+	if (status == -1 || !WIFEXITED(status)) {
+	    failed += 1;
+	} else {
+	    failed += WEXITSTATUS(status);
+	}
+    }
+    return failed;
+}
+
+} // end namespace gx_engine
@@ -474,53 +474,6 @@ bool ControllerArray::deleteParameter(Parameter& p) {
 }
 
 
-/****************************************************************
- ** class MidiClockToBpm
- */
-
-
-MidiClockToBpm::MidiClockToBpm()
-    : time1(0),
-      time_diff(0),
-      collect(0),
-      collect_(0),
-      bpm(0),
-      bpm_new(0),
-      ret(false) {}
-
-unsigned int MidiClockToBpm::rounded(float f) {
-    if (f >= 0x1.0p23) return (unsigned int) f;
-    return (unsigned int) (f + 0.49999997f);
-}
-
-bool MidiClockToBpm::time_to_bpm(double time, unsigned int* bpm_) {
-    ret = false;
-    // if time drift to far, reset bpm detection.
-    if ((time-time1)> (1.05*time_diff) || (time-time1)*1.05 < (time_diff)) { 
-        bpm = 0;
-        collect = 0;
-        collect_ = 0;
-    } else {
-        bpm_new = ((1000000000. / (time-time1) / 24) * 60);
-        bpm += bpm_new;
-        collect++;
-        
-        if (collect >= (bpm_new*bpm_new*0.0002)+1) {
-            bpm = (bpm/collect);
-            if (collect_>=2) {
-                (*bpm_) = rounded(min(360.,max(24.,bpm))); 
-                collect_ = 0;
-                ret = true;
-            }
-            collect_++;
-            collect = 1;
-        }
-    }
-    time_diff = time-time1;
-    time1 = time;
-    return ret;
-}
-
 /****************************************************************
  ** class MidiControllerList
  */
@@ -534,9 +487,6 @@ MidiControllerList::MidiControllerList()
       mute_change(-1),
       bank_change(-1),
       bank_changed(0),
-      time0(0),
-      bpm_(9),
-      mp(),
       pgm_chg(),
       mute_chg(),
       bank_chg(),
@@ -801,9 +751,18 @@ void MidiControllerList::process_trans(int transport_state) {
 #endif
 }
 
+// tempo from TempoTracker::update() (midi clock or jack transport)
+void MidiControllerList::process_tempo(unsigned int bpm) {
+    set_bpm_val(bpm);
+    val_chg();
+}
+
 // ----- jack process callback for the midi input
 void MidiControllerList::compute_midi_in(void* midi_input_port_buf, void *arg) {
 #ifndef GUITARIX_AS_PLUGIN
+    gx_jack::GxJack& jack = *static_cast<gx_jack::GxJack*>(arg);
+    TempoTracker& tempo = jack.get_engine().tempo;
+    jack_nframes_t frame_time = jack_last_frame_time(jack.client);
     jack_midi_event_t in_event;
     jack_nframes_t event_count = jack_midi_get_event_count(midi_input_port_buf);
     unsigned int i;
@@ -836,16 +795,10 @@ void MidiControllerList::compute_midi_in(void* midi_input_port_buf, void *arg) {
             //fprintf(stderr,"Note On %i", (int)in_event.buffer[1]);
         } else if ((in_event.buffer[0] ) > 0xf0) {   // midi clock
             if ((in_event.buffer[0] ) == 0xf8) {   // midi beat clock
-                clock_gettime(CLOCK_MONOTONIC, &ts1);
-                gx_jack::GxJack& jack = *static_cast<gx_jack::GxJack*>(arg);
-                static unsigned int sr = jack.get_jack_sr();
-                time0 = (ts1.tv_sec*1000000000.0)+(ts1.tv_nsec)+
-                        (1000000000.0/(double)(sr/(double)in_event.time));
-                if (mp.time_to_bpm(time0, &bpm_)) {
-                    set_bpm_val(bpm_);
-                    val_chg();
-                }
+                // tempo is published by TempoTracker::update()
+                tempo.midi_clock(frame_time + in_event.time);
             } else if ((in_event.buffer[0] ) == 0xfa) {   // midi clock start
+                tempo.midi_start();
                 set_ctr_val(23, 127);
                 val_chg();
             } else if ((in_event.buffer[0] ) == 0xfb) {   // midi clock continue
@@ -854,7 +807,7 @@ void MidiControllerList::compute_midi_in(void* midi_input_port_buf, void *arg) {
                 set_ctr_val(23, 0);
                 val_chg();
             } else if ((in_event.buffer[0] ) == 0xf2) {   // midi clock position
-              // not implemented 
+                tempo.midi_song_position((in_event.buffer[2]<<7) | in_event.buffer[1]);
               //  set_ctr_val(24,(in_event.buffer[2]<<7) | in_event.buffer[1]);
             }
         }
@@ -892,8 +845,11 @@ void ParameterGroups::group_exists(const string& id) {
     }
 }
 
-void ParameterGroups::group_is_new(const string& id) {
-    if (groups.find(id) != groups.end()) {
+// the same group is inserted once per engine instance, only a
+// conflicting name is an error
+void ParameterGroups::group_is_new(const string& id, const string& group) {
+    map<string, string>::iterator i = groups.find(id);
+    if (i != groups.end() && i->second != group) {
         gx_print_error("Debug Check", "Group already exists: " + id);
     }
 }
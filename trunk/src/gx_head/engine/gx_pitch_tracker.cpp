@@ -88,8 +88,9 @@ PitchTracker::PitchTracker()
 
 PitchTracker::~PitchTracker() {
     stop_thread();
-    fftwf_destroy_plan(m_fftwPlanFFT);
-    fftwf_destroy_plan(m_fftwPlanIFFT);
+    FFTPlanner& planner = FFTPlanner::getInstance();
+    planner.release(m_fftwPlanFFT);
+    planner.release(m_fftwPlanIFFT);
     fftwf_free(m_fftwBufferTime);
     fftwf_free(m_fftwBufferFreq);
     delete[] m_input;
@@ -121,14 +122,13 @@ bool PitchTracker::setParameters(int priority, int policy, int sampleRate, int b
     if (m_buffersize != buffersize) {
         m_buffersize = buffersize;
         m_fftSize = m_buffersize + (m_buffersize+1) / 2;
-        fftwf_destroy_plan(m_fftwPlanFFT);
-        fftwf_destroy_plan(m_fftwPlanIFFT);
-        m_fftwPlanFFT = fftwf_plan_r2r_1d(
-                            m_fftSize, m_fftwBufferTime, m_fftwBufferFreq,
-                            FFTW_R2HC, FFTW_ESTIMATE);
-        m_fftwPlanIFFT = fftwf_plan_r2r_1d(
-                             m_fftSize, m_fftwBufferFreq, m_fftwBufferTime,
-                             FFTW_HC2R, FFTW_ESTIMATE);
+        FFTPlanner& planner = FFTPlanner::getInstance();
+        planner.release(m_fftwPlanFFT);
+        planner.release(m_fftwPlanIFFT);
+        m_fftwPlanFFT = planner.plan(
+                            FFTPlanner::r2hc, m_fftSize, m_fftwBufferTime, m_fftwBufferFreq);
+        m_fftwPlanIFFT = planner.plan(
+                             FFTPlanner::hc2r, m_fftSize, m_fftwBufferFreq, m_fftwBufferTime);
     }
 
     if (!m_fftwPlanFFT || !m_fftwPlanIFFT) {
@@ -322,6 +322,7 @@ static int findsubMaximum(float *input, int len, float threshold) {
 }
 
 void PitchTracker::run() {
+    AVOIDDENORMALS();
     for (;;) {
         busy = false;
         sem_wait(&m_trig);
@@ -344,7 +345,7 @@ void PitchTracker::run() {
 
         memcpy(m_fftwBufferTime, m_input, m_buffersize * sizeof(*m_fftwBufferTime));
         memset(m_fftwBufferTime+m_buffersize, 0, (m_fftSize - m_buffersize) * sizeof(*m_fftwBufferTime));
-        fftwf_execute(m_fftwPlanFFT);
+        fftwf_execute_r2r(m_fftwPlanFFT, m_fftwBufferTime, m_fftwBufferFreq);
         for (int k = 1; k < m_fftSize/2; k++) {
             m_fftwBufferFreq[k] = sq(m_fftwBufferFreq[k]) + sq(m_fftwBufferFreq[m_fftSize-k]);
             m_fftwBufferFreq[m_fftSize-k] = 0.0;
@@ -352,7 +353,7 @@ void PitchTracker::run() {
         m_fftwBufferFreq[0] = sq(m_fftwBufferFreq[0]);
         m_fftwBufferFreq[m_fftSize/2] = sq(m_fftwBufferFreq[m_fftSize/2]);
 
-        fftwf_execute(m_fftwPlanIFFT);
+        fftwf_execute_r2r(m_fftwPlanIFFT, m_fftwBufferFreq, m_fftwBufferTime);
 
         double sumSq = 2.0 * static_cast<double>(m_fftwBufferTime[0]) / static_cast<double>(m_fftSize);
         for (int k = 0; k < m_fftSize - m_buffersize; k++) {
@@ -215,7 +215,10 @@ Plugin::Plugin(PluginDef *pl)
       p_plug_visible(0),
       p_on_off(0),
       p_position(0),
-      p_effect_post_pre(0) {
+      p_effect_post_pre(0),
+      fault(0),
+      fault_repeat(0),
+      last_recovery(0) {
     set_pdef(pl);
 }
 
@@ -240,7 +243,10 @@ Plugin::Plugin(gx_system::JsonParser& jp, ParamMap& pmap)
       p_plug_visible(0),
       p_on_off(0),
       p_position(0),
-      p_effect_post_pre(0) {
+      p_effect_post_pre(0),
+      fault(0),
+      fault_repeat(0),
+      last_recovery(0) {
     PluginDef *p = new PluginDef();
     p->delete_instance = delete_plugindef_instance;
     jp.next(gx_system::JsonParser::begin_object);
@@ -377,6 +383,36 @@ void Plugin::copy_position(const Plugin& plugin) {
     set_effect_post_pre(plugin.get_effect_post_pre());
 }
 
+// Called in the ui thread after the rt thread detected non-finite
+// output and stopped running the plugin, so the plugin state can be
+// reset here without locking. A plugin faulting again and again is
+// switched off. Returns false in that case.
+bool Plugin::recover_fault() {
+    gint64 now = g_get_monotonic_time();
+    if (now - last_recovery < 2 * G_USEC_PER_SEC) {
+        fault_repeat += 1;
+    } else {
+        fault_repeat = 0;
+    }
+    last_recovery = now;
+    if (pdef->clear_state) {
+        pdef->clear_state(pdef);
+    } else if (pdef->activate_plugin) {
+        // activate_plugin(true) on an active plugin doesn't
+        // necessarily reset the state
+        pdef->activate_plugin(false, pdef);
+        if (pdef->activate_plugin(true, pdef) != 0) {
+            fault_repeat = 3;
+        }
+    }
+    bool ok = fault_repeat < 3;
+    if (!ok) {
+        set_on_off(false);
+    }
+    gx_system::atomic_set(&fault, 0);
+    return ok;
+}
+
 
 /****************************************************************
  ** class PluginList
@@ -466,6 +502,20 @@ int PluginList::load_library(const string& path, PluginPos pos) {
     return cnt;
 }
 
+// circuit description for the DK runtime (see gx_dkcircuit.h)
+int PluginList::load_circuit(const string& path, PluginPos pos) {
+    DKCircuit *p = DKCircuit::create(path);
+    if (!p) {
+        return -1;
+    }
+    if (!add(p, pos)) {
+        p->delete_instance(p);
+        return -1;
+    }
+    gx_print_info(_("Plugin Loader"), Glib::ustring::compose("loaded[%1]: %2", path, p->id));
+    return 1;
+}
+
 int PluginList::load_from_path(const string& path, PluginPos pos) {
     DIR *dp;
     struct dirent *dirp;
@@ -483,6 +533,10 @@ int PluginList::load_from_path(const string& path, PluginPos pos) {
             if (res > 0) {
                 cnt += res;
             }
+        } else if (n.size() > 4 && n.compare(n.size()-4,4,".dkc") == 0) {
+            if (load_circuit(path+n, pos) > 0) {
+                cnt++;
+            }
         }
     }
     closedir(dp);
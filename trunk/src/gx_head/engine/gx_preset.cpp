@@ -964,12 +964,15 @@ GxSettings::GxSettings(gx_system::CmdlineOptions& opt, gx_jack::GxJack& jack_, g
     statefile.set_filename(make_default_state_filename());
     banks.parse(opt.get_preset_filepath(bank_list), opt.get_preset_dir(), opt.get_factory_dir(),
                 scratchpad_name, scratchpad_file);
-    instance = this;
+    instances.push_back(this);
     GxExit::get_instance().signal_exit().connect(
         sigc::mem_fun(*this, &GxSettings::exit_handler));
 #ifndef GUITARIX_AS_PLUGIN
     jack.signal_client_change().connect(
         sigc::mem_fun(*this, &GxSettings::jack_client_changed));
+    banks.start_index(opt.get_preset_filepath("presetindex.js"));
+    presetlist_changed.connect(
+        sigc::mem_fun(banks, &gx_system::PresetBanks::update_index));
 #else
     no_autosave = true;
     no_save_on_exit = true;
@@ -978,10 +981,22 @@ GxSettings::GxSettings(gx_system::CmdlineOptions& opt, gx_jack::GxJack& jack_, g
     get_sequencer_p.connect(sigc::mem_fun(*this, &GxSettings::on_get_sequencer_pos));
 }
 
-GxSettings *GxSettings::instance = 0;
+std::list<GxSettings*> GxSettings::instances;
+
+// save the state of all rigs (on session save or SIGUSR1),
+// returns false if there is no engine instance
+bool GxSettings::save_all_states() {
+    for (std::list<GxSettings*>::iterator i = instances.begin(); i != instances.end(); ++i) {
+        bool cur_state = (*i)->get_auto_save_state();
+        (*i)->disable_autosave(false);
+        (*i)->auto_save_state();
+        (*i)->disable_autosave(cur_state);
+    }
+    return !instances.empty();
+}
 
 GxSettings::~GxSettings() {
-    instance = 0;
+    instances.remove(this);
     if (!no_save_on_exit)
         auto_save_state();
 }
@@ -998,6 +1013,7 @@ void GxSettings::auto_save_state() {
         banks.check_save();
         if (!no_autosave) {
             save_to_state();
+            flush_state();
         }
     }
 }
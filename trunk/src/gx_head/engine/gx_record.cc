@@ -222,16 +222,16 @@ inline void SCapture::close_stream(SNDFILE **sf)
 
 void SCapture::mem_alloc()
 {
-    if (!fRec0) fRec0 = new float[MAXRECSIZE];
-    if (!fRec1) fRec1 = new float[MAXRECSIZE];
+    if (!fRec0) fRec0 = rt_alloc<float>(MAXRECSIZE);
+    if (!fRec1) fRec1 = rt_alloc<float>(MAXRECSIZE);
     mem_allocated = true;
 }
 
 void SCapture::mem_free()
 {
     mem_allocated = false;
-    if (fRec0) { delete fRec0; fRec0 = 0; }
-    if (fRec1) { delete fRec1; fRec1 = 0; }
+    if (fRec0) { rt_free(fRec0); fRec0 = 0; }
+    if (fRec1) { rt_free(fRec1); fRec1 = 0; }
 }
 
 int SCapture::activate(bool start)
@@ -0,0 +1,174 @@
+/*
+ * Copyright (C) 2009, 2010 Hermann Meyer, James Warden, Andreas Degert
+ * Copyright (C) 2011 Pete Shorthose
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ * --------------------------------------------------------------------------
+ *
+ *  locked and prefaulted memory for plugin state used in the rt thread
+ *
+ * --------------------------------------------------------------------------
+ */
+
+#include <sys/mman.h>           // NOLINT
+#include <unistd.h>             // NOLINT
+#include "engine.h"             // NOLINT
+
+namespace gx_engine {
+
+/****************************************************************
+ ** class RtArena
+ */
+
+const size_t RtArena::min_region_size;
+const size_t RtArena::header_size;
+
+RtArena::RtArena()
+    : regions(),
+      free_blocks(),
+      used(0),
+      mapped(0),
+      lock_warned(false),
+      mutex() {
+}
+
+// never destroyed: plugins might release their memory after
+// static destructors have run
+RtArena& RtArena::get_instance() {
+    static RtArena *instance = new RtArena();
+    return *instance;
+}
+
+static inline size_t round_up(size_t n, size_t m) {
+    return (n + m - 1) / m * m;
+}
+
+void RtArena::add_region(size_t size) {
+    size = round_up(max(size, min_region_size), sysconf(_SC_PAGESIZE));
+    int flags = MAP_PRIVATE | MAP_ANONYMOUS;
+#ifdef MAP_POPULATE
+    flags |= MAP_POPULATE;
+#endif
+    void *p = mmap(0, size, PROT_READ | PROT_WRITE, flags, -1, 0);
+    if (p == MAP_FAILED) {
+	throw std::bad_alloc();
+    }
+    bool locked = (mlock(p, size) == 0);
+    if (!locked && !lock_warned) {
+	lock_warned = true;
+	gx_print_warning(
+	    "RtArena",
+	    boost::format(_("can't lock plugin memory (%1% bytes): %2%"))
+	    % size % strerror(errno));
+    }
+    regions.push_back(Region(static_cast<char*>(p), size, locked));
+    free_blocks[static_cast<char*>(p)] = size;
+    mapped += size;
+}
+
+RtArena::Region *RtArena::find_region(char *p) {
+    for (std::list<Region>::iterator i = regions.begin(); i != regions.end(); ++i) {
+	if (p >= i->base && p < i->base + i->size) {
+	    return &*i;
+	}
+    }
+    return 0;
+}
+
+// keep the first region, unmap others which are completely free
+void RtArena::release_free_regions() {
+    if (regions.empty()) {
+	return;
+    }
+    std::list<Region>::iterator i = regions.begin();
+    for (++i; i != regions.end(); ) {
+	std::map<char*, size_t>::iterator f = free_blocks.find(i->base);
+	if (f == free_blocks.end() || f->second != i->size) {
+	    ++i;
+	    continue;
+	}
+	free_blocks.erase(f);
+	if (i->locked) {
+	    munlock(i->base, i->size);
+	}
+	munmap(i->base, i->size);
+	mapped -= i->size;
+	i = regions.erase(i);
+    }
+}
+
+void *RtArena::alloc(size_t size) {
+    size_t n = round_up(size + header_size, header_size);
+    char *blk;
+    {
+	boost::mutex::scoped_lock lock(mutex);
+	std::map<char*, size_t>::iterator f;
+	for (f = free_blocks.begin(); f != free_blocks.end(); ++f) {
+	    if (f->second >= n) {
+		break;
+	    }
+	}
+	if (f == free_blocks.end()) {
+	    add_region(n);
+	    f = free_blocks.find(regions.back().base);
+	}
+	blk = f->first;
+	size_t sz = f->second;
+	free_blocks.erase(f);
+	if (sz - n >= 4 * header_size) {
+	    free_blocks[blk + n] = sz - n;
+	} else {
+	    n = sz;
+	}
+	Header *h = reinterpret_cast<Header*>(blk);
+	h->size = n;
+	h->region = find_region(blk);
+	used += n;
+    }
+    // also prefaults the block if the region could not be locked
+    memset(blk + header_size, 0, n - header_size);
+    return blk + header_size;
+}
+
+void RtArena::free(void *p) {
+    if (!p) {
+	return;
+    }
+    char *blk = static_cast<char*>(p) - header_size;
+    Header *h = reinterpret_cast<Header*>(blk);
+    size_t n = h->size;
+    Region *r = h->region;
+    boost::mutex::scoped_lock lock(mutex);
+    used -= n;
+    // coalesce with the neighbours inside the same region
+    std::map<char*, size_t>::iterator next = free_blocks.find(blk + n);
+    if (next != free_blocks.end() && blk + n < r->base + r->size) {
+	n += next->second;
+	free_blocks.erase(next);
+    }
+    std::map<char*, size_t>::iterator prev = free_blocks.lower_bound(blk);
+    if (prev != free_blocks.begin()) {
+	--prev;
+	if (prev->first + prev->second == blk && prev->first >= r->base) {
+	    prev->second += n;
+	    release_free_regions();
+	    return;
+	}
+    }
+    free_blocks[blk] = n;
+    release_free_regions();
+}
+
+} // end namespace gx_engine
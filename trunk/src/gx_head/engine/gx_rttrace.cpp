@@ -0,0 +1,234 @@
+/*
+ * Copyright (C) 2009, 2010 Hermann Meyer, James Warden, Andreas Degert
+ * Copyright (C) 2011 Pete Shorthose
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ * --------------------------------------------------------------------------
+ *
+ *  per-period telemetry of the rt threads, dumped on xrun / overload
+ *
+ * --------------------------------------------------------------------------
+ */
+
+#include <dirent.h>             // NOLINT
+#include "engine.h"             // NOLINT
+
+namespace gx_engine {
+
+/****************************************************************
+ ** class RtTrace
+ */
+
+static const char dump_prefix[] = "rttrace-";
+static const int max_dumps = 8;
+static const gint64 min_dump_interval = 10000000000LL; // ns
+
+RtTrace::RtTrace()
+    : ring(0),
+      write_index(0),
+      filled(0),
+      generation(0),
+      state(st_running),
+      post_count(-1),
+      reason(0),
+      frozen(),
+      chains(),
+      dump_dir(),
+      snapshot(),
+      snapshot_chains(),
+      snapshot_reason(),
+      snapshot_time(0),
+      last_dump(0),
+      dumped() {
+    frozen.connect(sigc::mem_fun(this, &RtTrace::on_frozen));
+}
+
+RtTrace::~RtTrace() {
+    rt_free(ring);
+}
+
+// without init() the trace is switched off (plugin builds)
+void RtTrace::init(const std::string& dir) {
+    dump_dir = dir;
+    if (!ring) {
+	ring = rt_alloc<Record>(ring_size);
+    }
+}
+
+// called from the rt thread, the jack xrun callback or the
+// convolver threads
+void __rt_func RtTrace::trigger(int ov_type, const char *reason_) {
+    if (!ring) {
+	return;
+    }
+    Record& r = ring[gx_system::atomic_get(write_index)];
+    g_atomic_int_or(reinterpret_cast<volatile guint*>(&r.overload), ov_type);
+    if (gx_system::atomic_compare_and_exchange(&state, st_running, st_triggered)) {
+	gx_system::atomic_set(&reason, reason_);
+    }
+}
+
+// records carry the generation, the module ids are kept here
+// until no record of the generation is left in the ring
+void RtTrace::commit(const std::vector<std::string>& mono, const std::vector<std::string>& stereo) {
+    if (!ring) {
+	return;
+    }
+    int g = gx_system::atomic_get(generation) + 1;
+    Chains& c = chains[g];
+    c.mono = mono;
+    c.stereo = stereo;
+    gx_system::atomic_set(&generation, g);
+    int oldest = ring[(gx_system::atomic_get(write_index) + 1) & (ring_size - 1)].generation;
+    if (gx_system::atomic_get(filled) < ring_size) {
+	oldest = ring[1].generation;
+    }
+    while (chains.size() > 1 && chains.begin()->first < oldest) {
+	chains.erase(chains.begin());
+    }
+}
+
+void RtTrace::on_frozen() {
+    int n = gx_system::atomic_get(filled);
+    int last = gx_system::atomic_get(write_index);
+    snapshot.resize(n);
+    for (int i = 0; i < n; ++i) {
+	snapshot[i] = ring[(last - n + 1 + i) & (ring_size - 1)];
+    }
+    snapshot_chains = chains;
+    const char *r = gx_system::atomic_get(reason);
+    snapshot_reason = r ? r : "";
+    snapshot_time = now();
+    gx_system::atomic_set(&reason, static_cast<const char*>(0));
+    gx_system::atomic_set(&state, st_running);
+    if (dump_dir.empty() || snapshot_time - last_dump < min_dump_interval) {
+	return;
+    }
+    last_dump = snapshot_time;
+    if (g_mkdir_with_parents(dump_dir.c_str(), 0755) != 0) {
+	gx_print_error(
+	    _("rt trace"),
+	    boost::format(_("can't create directory %1%")) % dump_dir);
+	return;
+    }
+    char tbuf[32];
+    time_t t = time(0);
+    strftime(tbuf, sizeof(tbuf), "%Y%m%d-%H%M%S", localtime(&t));
+    std::string fname = Glib::build_filename(
+	dump_dir, std::string(dump_prefix) + tbuf + ".json");
+    std::ofstream os(fname.c_str());
+    gx_system::JsonWriter jw(&os);
+    writeJSON(jw);
+    jw.close();
+    os.close();
+    if (!os.good()) {
+	gx_print_error(
+	    _("rt trace"),
+	    boost::format(_("can't write %1%")) % fname);
+	return;
+    }
+    remove_old_dumps();
+    gx_print_info(
+	_("rt trace"),
+	boost::format(_("%1%: last %2% periods written to %3%"))
+	% snapshot_reason % n % fname);
+    dumped(fname);
+}
+
+// names sort by time, keep the newest ones
+void RtTrace::remove_old_dumps() {
+    DIR *d = opendir(dump_dir.c_str());
+    if (!d) {
+	return;
+    }
+    std::set<std::string> files;
+    struct dirent *e;
+    while ((e = readdir(d)) != 0) {
+	if (strncmp(e->d_name, dump_prefix, sizeof(dump_prefix)-1) == 0) {
+	    files.insert(e->d_name);
+	}
+    }
+    closedir(d);
+    int k = files.size() - max_dumps;
+    for (std::set<std::string>::iterator i = files.begin(); k > 0; ++i, --k) {
+	unlink(Glib::build_filename(dump_dir, *i).c_str());
+    }
+}
+
+static inline int ns2us(gint64 v) {
+    return (v + 500) / 1000;
+}
+
+static void write_ids(gx_system::JsonWriter& jw, const std::vector<std::string>& ids) {
+    jw.begin_array();
+    for (std::vector<std::string>::const_iterator i = ids.begin(); i != ids.end(); ++i) {
+	jw.write(*i);
+    }
+    jw.end_array();
+}
+
+// period start in microseconds relative to the time the trace was
+// frozen, durations in nanoseconds; plugin times are in the order
+// of the chains of the period's generation
+void RtTrace::writeJSON(gx_system::JsonWriter& jw) const {
+    jw.begin_object(true);
+    jw.write_kv("reason", snapshot_reason);
+    jw.write_key("chains");
+    jw.begin_object(true);
+    for (std::map<int, Chains>::const_iterator i = snapshot_chains.begin();
+	 i != snapshot_chains.end(); ++i) {
+	jw.write_key(gx_system::to_string(i->first));
+	jw.begin_object();
+	jw.write_key("mono");
+	write_ids(jw, i->second.mono);
+	jw.write_key("stereo");
+	write_ids(jw, i->second.stereo);
+	jw.end_object(true);
+    }
+    jw.end_object(true);
+    jw.write_key("periods");
+    jw.begin_array(true);
+    for (std::vector<Record>::const_iterator r = snapshot.begin(); r != snapshot.end(); ++r) {
+	jw.begin_object();
+	jw.write_kv("t", ns2us(r->start - snapshot_time));
+	jw.write_kv("frames", r->nframes);
+	jw.write_kv("mono", r->mono_ns);
+	jw.write_kv("stereo", r->stereo_ns);
+	jw.write_kv("midi", r->midi_events);
+	jw.write_kv("generation", r->generation);
+	jw.write_kv("overload", r->overload);
+	jw.write_kv("mono_ramp", r->mono_ramp);
+	jw.write_kv("stereo_ramp", r->stereo_ramp);
+	jw.write_kv("minflt", r->minflt);
+	jw.write_kv("majflt", r->majflt);
+	jw.write_key("mono_plugins");
+	jw.begin_array();
+	for (int i = 0; i < r->mono_plugins; ++i) {
+	    jw.write(r->mono_plugin_ns[i]);
+	}
+	jw.end_array();
+	jw.write_key("stereo_plugins");
+	jw.begin_array();
+	for (int i = 0; i < r->stereo_plugins; ++i) {
+	    jw.write(r->stereo_plugin_ns[i]);
+	}
+	jw.end_array();
+	jw.end_object(true);
+    }
+    jw.end_array(true);
+    jw.end_object(true);
+}
+
+} // end namespace gx_engine
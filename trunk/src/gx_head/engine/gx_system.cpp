@@ -337,28 +337,69 @@ std::string PrefixConverter::replace_path(const std::string& dir) const {
  ** class DirectoryListing
  */
 
+// The listing of a directory only changes when entries are added,
+// removed or renamed, which always updates the modification time of
+// the directory itself (content types are guessed from the names).
+// So the last enumeration result of each directory is kept and
+// reused as long as the directory stamp stays the same.
+struct IRDirCacheEntry {
+    std::string stamp;
+    std::vector<FileName> listing;
+};
+
+static std::map<std::string, IRDirCacheEntry> ir_dir_cache;
+static boost::mutex ir_dir_cache_mutex;
+
+static std::string dir_stamp(const Glib::RefPtr<Gio::File>& file) {
+    Glib::RefPtr<Gio::FileInfo> info = file->query_info(
+	G_FILE_ATTRIBUTE_TIME_MODIFIED "," G_FILE_ATTRIBUTE_TIME_MODIFIED_USEC);
+    return (boost::format("%1%.%2%")
+	    % info->get_attribute_uint64(G_FILE_ATTRIBUTE_TIME_MODIFIED)
+	    % info->get_attribute_uint32(G_FILE_ATTRIBUTE_TIME_MODIFIED_USEC)).str();
+}
+
 IRFileListing::IRFileListing(const std::string& path) {
     Glib::RefPtr<Gio::File> file = Gio::File::create_for_path(path);
-    if (file->query_exists()) {
-        Glib::RefPtr<Gio::FileEnumerator> child_enumeration =
-              file->enumerate_children(G_FILE_ATTRIBUTE_STANDARD_NAME
-				       "," G_FILE_ATTRIBUTE_STANDARD_DISPLAY_NAME
-				       "," G_FILE_ATTRIBUTE_STANDARD_FAST_CONTENT_TYPE);
-        Glib::RefPtr<Gio::FileInfo> file_info;
-        while ((file_info = child_enumeration->next_file())) {
-            std::string content_type = file_info->get_attribute_string(
-                G_FILE_ATTRIBUTE_STANDARD_FAST_CONTENT_TYPE);
-	    if (content_type.substr(0, 6) == "audio/") {
-		listing.push_back(
-		    FileName(
-			file_info->get_attribute_byte_string(G_FILE_ATTRIBUTE_STANDARD_NAME),
-			file_info->get_attribute_string(G_FILE_ATTRIBUTE_STANDARD_DISPLAY_NAME)));
-	    }
-        }
-    } else {
+    if (!file->query_exists()) {
         gx_print_error(
 	    "jconvolver",
 	    boost::format(_("Error reading file path %1%")) % path);
+	return;
+    }
+    std::string stamp;
+    try {
+	stamp = dir_stamp(file);
+    } catch (Gio::Error& e) {
+	// no stamp: enumerate and don't cache
+    }
+    if (!stamp.empty()) {
+	boost::mutex::scoped_lock lock(ir_dir_cache_mutex);
+	std::map<std::string, IRDirCacheEntry>::iterator i = ir_dir_cache.find(path);
+	if (i != ir_dir_cache.end() && i->second.stamp == stamp) {
+	    listing = i->second.listing;
+	    return;
+	}
+    }
+    Glib::RefPtr<Gio::FileEnumerator> child_enumeration =
+	file->enumerate_children(G_FILE_ATTRIBUTE_STANDARD_NAME
+				 "," G_FILE_ATTRIBUTE_STANDARD_DISPLAY_NAME
+				 "," G_FILE_ATTRIBUTE_STANDARD_FAST_CONTENT_TYPE);
+    Glib::RefPtr<Gio::FileInfo> file_info;
+    while ((file_info = child_enumeration->next_file())) {
+	std::string content_type = file_info->get_attribute_string(
+	    G_FILE_ATTRIBUTE_STANDARD_FAST_CONTENT_TYPE);
+	if (content_type.substr(0, 6) == "audio/") {
+	    listing.push_back(
+		FileName(
+		    file_info->get_attribute_byte_string(G_FILE_ATTRIBUTE_STANDARD_NAME),
+		    file_info->get_attribute_string(G_FILE_ATTRIBUTE_STANDARD_DISPLAY_NAME)));
+	}
+    }
+    if (!stamp.empty()) {
+	boost::mutex::scoped_lock lock(ir_dir_cache_mutex);
+	IRDirCacheEntry& e = ir_dir_cache[path];
+	e.stamp = stamp;
+	e.listing = listing;
     }
 }
 
@@ -492,6 +533,7 @@ CmdlineOptions::CmdlineOptions()
       optgroup_jack("jack", TCLR2("JACK configuration options")),
       optgroup_overload("overload", TCLR2("Switch to bypass mode on overload condition")),
       optgroup_file("file", TCLR2("File options")),
+      optgroup_render("render", TCLR2("Offline rendering options (no JACK)")),
       optgroup_debug("debug", TCLR2("Debug options")),
       version(false), clear(false),
       jack_input(shellvar("GUITARIX2JACK_INPUTS")),
@@ -515,8 +557,10 @@ CmdlineOptions::CmdlineOptions()
       loop_dir(),
       rcset(shellvar("GUITARIX_RC_STYLE")),
       nogui(false),
+      rigs(1),
       rpcport(RPCPORT_DEFAULT),
       rpcaddress(),
+      rpc_origins(),
       onlygui(false),
       liveplaygui(false),
       hideonquit(false),
@@ -534,6 +578,12 @@ CmdlineOptions::CmdlineOptions()
       lterminal(false),
       a_save(false),
       auto_save(false),
+      render_inputs(),
+      render_output_dir(),
+      render_preset(),
+      render_samplerate(-1),
+      render_blocksize(256),
+      render_jobs(1),
 #ifndef NDEBUG
       dump_parameter(false),
 #endif
@@ -601,6 +651,11 @@ CmdlineOptions::CmdlineOptions()
     opt_nogui.set_short_name('N');
     opt_nogui.set_long_name("nogui");
     opt_nogui.set_description("start without GUI");
+    Glib::OptionEntry opt_rigs;
+    opt_rigs.set_long_name("rigs");
+    opt_rigs.set_description(
+	"run N independent engines in one process (only with -N, default: 1)");
+    opt_rigs.set_arg_description("N");
     Glib::OptionEntry opt_rpcport;
     opt_rpcport.set_short_name('p');
     opt_rpcport.set_long_name("rpcport");
@@ -611,6 +666,11 @@ CmdlineOptions::CmdlineOptions()
     opt_rpchost.set_long_name("rpchost");
     opt_rpchost.set_description("set hostname to connect to");
     opt_rpchost.set_arg_description("HOSTNAME");
+    Glib::OptionEntry opt_rpcorigin;
+    opt_rpcorigin.set_long_name("rpc-origin");
+    opt_rpcorigin.set_description(
+	"allow websocket connections from web pages of ORIGIN (can be repeated, * allows all)");
+    opt_rpcorigin.set_arg_description("ORIGIN");
     Glib::OptionEntry opt_onlygui;
     opt_onlygui.set_short_name('G');
     opt_onlygui.set_long_name("onlygui");
@@ -647,8 +707,10 @@ CmdlineOptions::CmdlineOptions()
     opt_tuner_feedback.set_description("send tuner midi feedback");
     main_group.add_entry(opt_version, version);
     main_group.add_entry(opt_nogui, nogui);
+    main_group.add_entry(opt_rigs, rigs);
     main_group.add_entry(opt_rpcport, rpcport);
     main_group.add_entry(opt_rpchost, rpcaddress);
+    main_group.add_entry(opt_rpcorigin, rpc_origins);
     main_group.add_entry(opt_onlygui, onlygui);
     main_group.add_entry(opt_liveplaygui, liveplaygui);
     main_group.add_entry(opt_hideonquit, hideonquit);
@@ -790,6 +852,39 @@ CmdlineOptions::CmdlineOptions()
     opt_auto_save.set_description(_("enable auto save (only in server mode)"));
     optgroup_file.add_entry(opt_auto_save, auto_save);
 
+    // RENDER options
+    Glib::OptionEntry opt_render_input;
+    opt_render_input.set_short_name('R');
+    opt_render_input.set_long_name("render-input");
+    opt_render_input.set_description(_("render sound file offline through the engine (may be repeated)"));
+    opt_render_input.set_arg_description("FILE");
+    optgroup_render.add_entry_filename(opt_render_input, render_inputs);
+    Glib::OptionEntry opt_render_output_dir;
+    opt_render_output_dir.set_long_name("render-output-dir");
+    opt_render_output_dir.set_description(_("directory for rendered files (default: directory of input file)"));
+    opt_render_output_dir.set_arg_description("DIR");
+    optgroup_render.add_entry_filename(opt_render_output_dir, render_output_dir);
+    Glib::OptionEntry opt_render_preset;
+    opt_render_preset.set_long_name("render-preset");
+    opt_render_preset.set_description(_("preset used for rendering (default: state file)"));
+    opt_render_preset.set_arg_description("BANK:PRESET");
+    optgroup_render.add_entry(opt_render_preset, render_preset);
+    Glib::OptionEntry opt_render_samplerate;
+    opt_render_samplerate.set_long_name("render-samplerate");
+    opt_render_samplerate.set_description(_("engine samplerate (default: samplerate of input file)"));
+    opt_render_samplerate.set_arg_description("HZ");
+    optgroup_render.add_entry(opt_render_samplerate, render_samplerate);
+    Glib::OptionEntry opt_render_blocksize;
+    opt_render_blocksize.set_long_name("render-blocksize");
+    opt_render_blocksize.set_description(_("engine block size (default: 256)"));
+    opt_render_blocksize.set_arg_description("FRAMES");
+    optgroup_render.add_entry(opt_render_blocksize, render_blocksize);
+    Glib::OptionEntry opt_render_jobs;
+    opt_render_jobs.set_long_name("render-jobs");
+    opt_render_jobs.set_description(_("number of engine instances rendering in parallel (default: 1)"));
+    opt_render_jobs.set_arg_description("N");
+    optgroup_render.add_entry(opt_render_jobs, render_jobs);
+
     // DEBUG options
     Glib::OptionEntry opt_builder_dir;
     opt_builder_dir.set_short_name('B');
@@ -821,6 +916,7 @@ CmdlineOptions::CmdlineOptions()
     add_group(optgroup_jack);
     add_group(optgroup_overload);
     add_group(optgroup_file);
+    add_group(optgroup_render);
     add_group(optgroup_debug);
 }
 
@@ -1011,6 +1107,11 @@ void CmdlineOptions::process(int argc, char** argv) {
 	    Glib::OptionError::BAD_VALUE,
 	    _("-N and -L cannot be used together"));
 	}
+    if (rigs != 1 && (!nogui || rigs < 1)) {
+		throw Glib::OptionError(
+	    Glib::OptionError::BAD_VALUE,
+	    _("--rigs needs -N and a positive number"));
+	}
     if (onlygui && !setbank.empty()) {
 		throw Glib::OptionError(
 	    Glib::OptionError::BAD_VALUE,
@@ -1019,7 +1120,7 @@ void CmdlineOptions::process(int argc, char** argv) {
     if (lterminal) {
 	GxLogger::get_logger().signal_message().connect(
 	    sigc::ptr_fun(log_terminal));
-	if (nogui) {
+	if (nogui || get_render()) {
 	    GxLogger::get_logger().unplug_queue();
 	}
     }
@@ -1052,6 +1153,25 @@ void CmdlineOptions::process(int argc, char** argv) {
 	}
     }
 #endif
+    if (get_render()) {
+	if (render_blocksize < static_cast<int>(Convproc::MINQUANT) ||
+	    render_blocksize > static_cast<int>(Convproc::MAXQUANT)) {
+	    throw Glib::OptionError(
+		Glib::OptionError::BAD_VALUE,
+		(boost::format(_("render block size must be between %1% and %2%"))
+		 % Convproc::MINQUANT % Convproc::MAXQUANT).str());
+	}
+	if (render_samplerate != -1 && render_samplerate <= 0) {
+	    throw Glib::OptionError(
+		Glib::OptionError::BAD_VALUE,
+		(boost::format(_("invalid render samplerate %1%"))
+		 % render_samplerate).str());
+	}
+	if (render_jobs < 1) {
+	    render_jobs = 1;
+	}
+	make_ending_slash(render_output_dir);
+    }
     if (jack_outputs.size() > 2) {
 	gx_print_warning(
 	    _("main"),
@@ -0,0 +1,155 @@
+/*
+ * Copyright (C) 2009, 2010 Hermann Meyer, James Warden, Andreas Degert
+ * Copyright (C) 2011 Pete Shorthose
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ * --------------------------------------------------------------------------
+ *
+ *  tempo and beat phase from MIDI clock or jack transport
+ *
+ * --------------------------------------------------------------------------
+ */
+
+#include "engine.h"             // NOLINT
+
+namespace gx_engine {
+
+/****************************************************************
+ ** class TempoTracker
+ */
+
+static const int lock_ticks = 12;       // ticks with wide bandwidth
+static const double bw_lock = 2.0;      // DLL bandwidth (Hz) while locking
+static const double bw_track = 0.5;     // DLL bandwidth (Hz) when locked
+static const double max_omega = 0.3;    // keeps the loop stable at low tempo
+static const double max_error = 0.5;    // tick error (in periods) that restarts locking
+static const double timeout = 2.0;      // missing ticks (in periods): clock stopped
+static const int min_bpm = 24;
+static const int max_bpm = 360;
+
+TempoTracker::TempoTracker()
+    : sr(48000),
+      base(0),
+      t0(0),
+      t1(0),
+      period(0),
+      ticks(0),
+      beat_tick(ticks_per_beat-1),
+      last_bpm(0),
+      bpm(0),
+      phase(0),
+      source(src_none) {
+}
+
+void TempoTracker::restart(unsigned int frame) {
+    base = frame;
+    t0 = 0;
+    t1 = 0;
+    ticks = 1;
+}
+
+void TempoTracker::midi_clock(unsigned int frame) {
+    beat_tick = (beat_tick + 1) % ticks_per_beat;
+    if (ticks == 0) {
+	restart(frame);
+	return;
+    }
+    double dt = static_cast<int>(frame - base);
+    if (ticks == 1) {
+	if (dt <= 0) {
+	    restart(frame);
+	    return;
+	}
+	period = dt;
+	t0 = dt;
+	t1 = dt + period;
+	ticks = 2;
+    } else {
+	double e = dt - t1;
+	if (fabs(e) > max_error * period) {
+	    // tempo jump or lost ticks
+	    restart(frame);
+	    return;
+	}
+	double w = 2 * M_PI * (ticks < lock_ticks ? bw_lock : bw_track) * period / sr;
+	if (w > max_omega) {
+	    w = max_omega;
+	}
+	t0 = t1;
+	t1 += M_SQRT2 * w * e + period;
+	period += w * w * e;
+	if (ticks < lock_ticks) {
+	    ticks++;
+	}
+    }
+    // move the origin to keep the times small
+    int s = static_cast<int>(t0);
+    base += s;
+    t0 -= s;
+    t1 -= s;
+}
+
+void TempoTracker::midi_start() {
+    beat_tick = ticks_per_beat - 1;  // next tick starts a beat
+}
+
+void TempoTracker::midi_song_position(int pos) {
+    int t = (pos * (ticks_per_beat / 4) - 1) % ticks_per_beat;
+    beat_tick = t < 0 ? t + ticks_per_beat : t;
+}
+
+// called at the end of a period (after the midi input), publishes
+// tempo and phase for frame + nframes (start of the next period);
+// returns true when the rounded tempo of an active source changed
+bool TempoTracker::update(unsigned int frame, unsigned int nframes, unsigned int sr_,
+			  bool transport_valid, double transport_bpm,
+			  double transport_phase) {
+    sr = sr_;
+    const unsigned int next = frame + nframes;
+    if (ticks > 0) {
+	double dt = static_cast<int>(next - base);
+	if (ticks == 1 ? dt > sr : dt - t1 > timeout * period) {
+	    ticks = 0;  // clock stopped
+	}
+    }
+    int src = src_none;
+    double b = 0;
+    double ph = 0;
+    if (ticks >= lock_ticks) {
+	double dt = static_cast<int>(next - base);
+	src = src_midi_clock;
+	b = 60.0 * sr / (ticks_per_beat * period);
+	ph = (beat_tick + (dt - t0) / (t1 - t0)) / ticks_per_beat;
+    } else if (transport_valid && transport_bpm > 0) {
+	src = src_transport;
+	b = transport_bpm;
+	ph = transport_phase + nframes * transport_bpm / (60.0 * sr);
+    }
+    ph -= floor(ph);
+    bpm.store(b, std::memory_order_relaxed);
+    phase.store(ph, std::memory_order_relaxed);
+    source.store(src, std::memory_order_relaxed);
+    if (src == src_none) {
+	return false;
+    }
+    int r = static_cast<int>(min(double(max_bpm), max(double(min_bpm), b)) + 0.5);
+    if (r == last_bpm) {
+	return false;
+    }
+    last_bpm = r;
+    return true;
+}
+
+} // end namespace gx_engine
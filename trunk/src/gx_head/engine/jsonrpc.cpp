@@ -21,6 +21,8 @@
 #include <netinet/tcp.h>
 #include <sys/types.h>
 #include <sys/socket.h>
+#include <giomm/zlibcompressor.h>
+#include <giomm/zlibdecompressor.h>
 #if HAVE_BLUEZ
 #include <bluetooth/bluetooth.h>
 #include <bluetooth/rfcomm.h>
@@ -245,7 +247,13 @@ CmdConnection::CmdConnection(GxService& serv_, const Glib::RefPtr<Gio::SocketCon
       current_offset(0),
       midi_config_mode(false),
       flags(),
-      maxlevel() {
+      maxlevel(),
+      protocol(proto_detect),
+      ws_in(),
+      ws_message(),
+      ws_message_op(0),
+      ws_message_deflated(false),
+      ws_deflate(false) {
     gx_engine::ParamMap& pmap = serv.settings.get_param();
     for (gx_engine::ParamMap::iterator i = pmap.begin(); i != pmap.end(); ++i) {
         if (i->second->isMaxlevel()) {
@@ -280,6 +288,8 @@ static struct {
     { "plugins_changed", CmdConnection::f_plugins_changed, CmdConnection::f_plugins_changed },
     { "misc", CmdConnection::f_misc_msg, CmdConnection::f_misc_msg },
     { "units_changed", CmdConnection::f_units_changed, CmdConnection::f_units_changed },
+    { "plugin_fault", CmdConnection::f_plugin_fault, CmdConnection::f_plugin_fault },
+    { "rt_trace", CmdConnection::f_rt_trace, CmdConnection::f_rt_trace },
 };
 
 bool CmdConnection::find_token(const Glib::ustring& token, msg_type *start, msg_type *end) {
@@ -594,6 +604,25 @@ void CmdConnection::call(gx_system::JsonWriter& jw, const methodnames *mn, JsonA
         jw.write(serv.settings.banks.get_file(params[0]->getString())->get_filename());
     }
 
+    FUNCTION(preset_search) {
+        gx_system::PresetQuery q;
+        q.name = params[0]->getString();
+        q.plugin = params[1]->getString();
+        q.irfile = params[2]->getString();
+        q.param = params[3]->getString();
+        q.value = params[4]->getString();
+        std::vector<gx_system::PresetMatch> l;
+        serv.settings.banks.search(q, l);
+        jw.begin_array();
+        for (std::vector<gx_system::PresetMatch>::iterator i = l.begin(); i != l.end(); ++i) {
+            jw.begin_array();
+            jw.write(i->bank);
+            jw.write(i->name);
+            jw.end_array();
+        }
+        jw.end_array();
+    }
+
     FUNCTION(bank_get_contents) {
         const std::string& fname = serv.settings.banks.get_file(params[0]->getString())->get_filename();
         jw.begin_array();
@@ -680,6 +709,18 @@ void CmdConnection::call(gx_system::JsonWriter& jw, const methodnames *mn, JsonA
         jw.write(serv.jack.get_jcpu_load());
     }
 
+#ifndef GUITARIX_AS_PLUGIN
+    // last frozen rt trace (null if none has been recorded yet)
+    FUNCTION(rt_trace) {
+        gx_engine::RtTrace& tr = serv.jack.get_engine().rt_trace;
+        if (tr.has_snapshot()) {
+            tr.writeJSON(jw);
+        } else {
+            jw.write_null();
+        }
+    }
+#endif
+
     FUNCTION(load_impresp_dirs) {
         std::vector<gx_system::FileName> dirs;
         gx_system::list_subdirs(serv.settings.get_options().get_IR_pathlist(), dirs);
@@ -702,18 +743,24 @@ void CmdConnection::call(gx_system::JsonWriter& jw, const methodnames *mn, JsonA
         if (!ret) {
             return;
         }
+        // optional 2nd parameter: JsonAttachment capabilities of the client
+        int accept = (params.size() > 1 ? params[1]->getInt() : 0);
         jw.begin_array();
         jw.write(audio_size);
         jw.write(audio_chan);
         jw.write(audio_type);
         jw.write(audio_form);
         jw.write(audio_rate);
-        jw.begin_array();
-        for (unsigned int i = 0; i < audio_size*audio_chan; i++) {
-            jw.write(buffer[i]);
+        if (accept & gx_system::JsonAttachment::accept_f32) {
+            add_attachment(jw, buffer, audio_size*audio_chan, accept);
+        } else {
+            jw.begin_array();
+            for (unsigned int i = 0; i < audio_size*audio_chan; i++) {
+                jw.write(buffer[i]);
+            }
+            jw.end_array();
         }
         jw.end_array();
-        jw.end_array();
         delete[] buffer;
     }
 
@@ -1071,6 +1118,7 @@ void CmdConnection::notify(gx_system::JsonStringWriter& jw, const methodnames *m
             } else {
                 auto o = dynamic_cast<gx_engine::OscParameter*>(&p);
                 assert(o);
+                o->get_value().update();
                 o->get_value().writeJSON((*jw));
             }
         }
@@ -1276,6 +1324,292 @@ void CmdConnection::error_response(gx_system::JsonWriter& jw, int code, const ch
     jw.end_object();
 }
 
+/****************************************************************
+ ** WebSocket transport (RFC 6455)
+ **
+ ** A client which starts with an HTTP GET request is switched to
+ ** WebSocket framing (browsers can connect without a proxy). Each
+ ** text message carries one JSON-RPC message or batch, responses
+ ** and notifications are sent the same way. JsonAttachment frames
+ ** are sent as binary messages in front of their response.
+ ** permessage-deflate (RFC 7692) is used when the client offers
+ ** it; every message is compressed on its own, so no window state
+ ** is kept between messages.
+ */
+
+enum {
+    ws_op_continuation = 0x0,
+    ws_op_text         = 0x1,
+    ws_op_binary       = 0x2,
+    ws_op_close        = 0x8,
+    ws_op_ping         = 0x9,
+    ws_op_pong         = 0xa,
+};
+
+static const unsigned int ws_max_request = 8192;
+static const unsigned int ws_max_message = 16 << 20;
+static const unsigned int ws_min_deflate = 512;  // send smaller messages uncompressed
+static const char ws_guid[] = "258EAFA5-E914-47DA-95CA-C5AB0DC85B11";
+static const char ws_deflate_tail[] = "\x00\x00\xff\xff";
+
+// sync flushed (de)compression of one message; fails when out
+// would get larger than max_out (inflating a "deflate bomb")
+static bool ws_convert(Glib::RefPtr<Gio::Converter> conv, const char *p, size_t n,
+                       std::string& out, size_t max_out) {
+    char buf[16384];
+    try {
+        while (true) {
+            gsize rd, wr;
+            Gio::ConverterResult r = conv->convert(
+                p, n, buf, sizeof(buf), Gio::CONVERTER_FLUSH, rd, wr);
+            if (out.size() + wr > max_out) {
+                return false;
+            }
+            out.append(buf, wr);
+            p += rd;
+            n -= rd;
+            if (r == Gio::CONVERTER_FINISHED || (r == Gio::CONVERTER_FLUSHED && n == 0)) {
+                return true;
+            }
+        }
+    } catch (Glib::Error& e) {
+        return false;
+    }
+}
+
+static std::string ws_accept_key(const std::string& key) {
+    std::string s = key + ws_guid;
+    guint8 digest[20];
+    gsize len = sizeof(digest);
+    GChecksum *cs = g_checksum_new(G_CHECKSUM_SHA1);
+    g_checksum_update(cs, reinterpret_cast<const guchar*>(s.data()), s.size());
+    g_checksum_get_digest(cs, digest, &len);
+    g_checksum_free(cs);
+    gchar *b = g_base64_encode(digest, len);
+    std::string r(b);
+    g_free(b);
+    return r;
+}
+
+/*
+** Browsers send the Origin of the page that opens the connection;
+** without a check any web page could control the engine. Clients
+** without Origin (not a browser) are accepted, origins only when
+** listed with --rpc-origin. GxService doesn't serve pages, so an
+** origin matching the Host header is no reason to accept it (DNS
+** rebinding: the attacker's domain resolves to this host).
+*/
+static bool ws_origin_allowed(const std::string& origin,
+                              const std::vector<Glib::ustring>& allowed) {
+    if (origin.empty()) {
+        return true;
+    }
+    for (std::vector<Glib::ustring>::const_iterator i = allowed.begin(); i != allowed.end(); ++i) {
+        if (*i == "*" || *i == origin) {
+            return true;
+        }
+    }
+    return false;
+}
+
+// returns false if the connection has been removed
+bool CmdConnection::ws_handshake(const char *p, int n) {
+    ws_in.append(p, n);
+    size_t end = ws_in.find("\r\n\r\n");
+    if (end == std::string::npos) {
+        if (ws_in.size() > ws_max_request) {
+            serv.remove_connection(this);
+            return false;
+        }
+        return true;
+    }
+    std::map<std::string, std::string> hdr;
+    std::istringstream is(ws_in.substr(0, end));
+    std::string line;
+    std::getline(is, line);  // request line
+    while (std::getline(is, line)) {
+        size_t c = line.find(':');
+        if (c == std::string::npos) {
+            continue;
+        }
+        std::string v = line.substr(c+1);
+        size_t b = v.find_first_not_of(" \t");
+        size_t e = v.find_last_not_of(" \t\r");
+        hdr[Glib::ustring(line.substr(0, c)).lowercase()] =
+            (b == std::string::npos ? "" : v.substr(b, e-b+1));
+    }
+    ws_in.erase(0, end+4);
+    if (Glib::ustring(hdr["upgrade"]).lowercase() != "websocket"
+        || hdr["sec-websocket-key"].empty()) {
+        send_raw("HTTP/1.1 400 Bad Request\r\nConnection: close\r\n"
+                 "Content-Length: 0\r\n\r\n");
+        serv.remove_connection(this);
+        return false;
+    }
+    if (hdr["sec-websocket-version"] != "13") {
+        send_raw("HTTP/1.1 426 Upgrade Required\r\nSec-WebSocket-Version: 13\r\n"
+                 "Connection: close\r\nContent-Length: 0\r\n\r\n");
+        serv.remove_connection(this);
+        return false;
+    }
+    if (!ws_origin_allowed(hdr["origin"], serv.settings.get_options().get_rpc_origins())) {
+        gx_print_warning(
+            "JSON-RPC", boost::format(_("websocket connection from origin %1% refused"))
+            % hdr["origin"]);
+        send_raw("HTTP/1.1 403 Forbidden\r\nConnection: close\r\n"
+                 "Content-Length: 0\r\n\r\n");
+        serv.remove_connection(this);
+        return false;
+    }
+    std::string ext = hdr["sec-websocket-extensions"];
+    // we always compress with the full window
+    ws_deflate = (ext.find("permessage-deflate") != std::string::npos
+                  && ext.find("server_max_window_bits") == std::string::npos);
+    std::string resp =
+        "HTTP/1.1 101 Switching Protocols\r\n"
+        "Upgrade: websocket\r\n"
+        "Connection: Upgrade\r\n"
+        "Sec-WebSocket-Accept: " + ws_accept_key(hdr["sec-websocket-key"]) + "\r\n";
+    if (ws_deflate) {
+        resp += "Sec-WebSocket-Extensions: permessage-deflate; client_no_context_takeover\r\n";
+    }
+    resp += "\r\n";
+    send_raw(resp);
+    protocol = proto_websocket;
+    if (!ws_in.empty()) {
+        std::string rest;
+        rest.swap(ws_in);
+        return ws_data_in(rest.data(), rest.size());
+    }
+    return true;
+}
+
+// decodes the (masked) client frames; returns false if the
+// connection has been removed
+bool CmdConnection::ws_data_in(const char *p, int n) {
+    ws_in.append(p, n);
+    while (true) {
+        const unsigned char *h = reinterpret_cast<const unsigned char*>(ws_in.data());
+        size_t avail = ws_in.size();
+        if (avail < 2) {
+            return true;
+        }
+        bool fin = h[0] & 0x80;
+        bool rsv1 = h[0] & 0x40;
+        int op = h[0] & 0x0f;
+        bool masked = h[1] & 0x80;
+        guint64 len = h[1] & 0x7f;
+        size_t hlen = 2;
+        if (len == 126) {
+            hlen = 4;
+        } else if (len == 127) {
+            hlen = 10;
+        }
+        if (avail < hlen + 4) {
+            return true;
+        }
+        if (len == 126) {
+            len = (h[2] << 8) | h[3];
+        } else if (len == 127) {
+            len = 0;
+            for (int i = 2; i < 10; i++) {
+                len = (len << 8) | h[i];
+            }
+        }
+        if (!masked || len > ws_max_message) {
+            serv.remove_connection(this);
+            return false;
+        }
+        const unsigned char *mask = h + hlen;
+        hlen += 4;
+        if (avail < hlen + len) {
+            return true;
+        }
+        std::string payload(ws_in, hlen, len);
+        for (size_t i = 0; i < len; i++) {
+            payload[i] ^= mask[i & 3];
+        }
+        ws_in.erase(0, hlen + len);
+        switch (op) {
+        case ws_op_close:
+            ws_send(payload.data(), min<size_t>(payload.size(), 2), ws_op_close);
+            serv.remove_connection(this);
+            return false;
+        case ws_op_ping:
+            ws_send(payload.data(), payload.size(), ws_op_pong);
+            continue;
+        case ws_op_pong:
+            continue;
+        case ws_op_continuation:
+            if (ws_message.size() + len > ws_max_message) {
+                serv.remove_connection(this);
+                return false;
+            }
+            ws_message += payload;
+            break;
+        default:
+            ws_message.swap(payload);
+            ws_message_op = op;
+            ws_message_deflated = rsv1 && ws_deflate;
+            break;
+        }
+        if (fin && !ws_message_in()) {
+            return false;
+        }
+    }
+}
+
+bool CmdConnection::ws_message_in() {
+    std::string msg;
+    msg.swap(ws_message);
+    if (ws_message_deflated) {
+        std::string z;
+        msg.append(ws_deflate_tail, 4);
+        if (!ws_convert(Gio::ZlibDecompressor::create(Gio::ZLIB_COMPRESSOR_FORMAT_RAW),
+                        msg.data(), msg.size(), z, ws_max_message)) {
+            serv.remove_connection(this);
+            return false;
+        }
+        msg.swap(z);
+    }
+    if (ws_message_op != ws_op_text) {
+        return true;  // no binary messages from clients
+    }
+    jp.get_ostream().write(msg.data(), msg.size());
+    process(jp);
+    jp.reset();
+    return true;
+}
+
+// server frames are not masked
+void CmdConnection::ws_send(const char *p, size_t n, int opcode) {
+    std::string z;
+    unsigned char b0 = 0x80 | opcode;
+    if (ws_deflate && opcode < ws_op_close && n >= ws_min_deflate
+        && ws_convert(Gio::ZlibCompressor::create(Gio::ZLIB_COMPRESSOR_FORMAT_RAW, -1), p, n, z, n + 64)
+        && z.size() >= 4 && z.compare(z.size()-4, 4, ws_deflate_tail, 4) == 0) {
+        z.resize(z.size() - 4);
+        p = z.data();
+        n = z.size();
+        b0 |= 0x40;
+    }
+    std::string frame(1, b0);
+    if (n < 126) {
+        frame += static_cast<char>(n);
+    } else if (n < 65536) {
+        frame += static_cast<char>(126);
+        frame += static_cast<char>(n >> 8);
+        frame += static_cast<char>(n & 0xff);
+    } else {
+        frame += static_cast<char>(127);
+        for (int i = 7; i >= 0; i--) {
+            frame += static_cast<char>((static_cast<guint64>(n) >> (8*i)) & 0xff);
+        }
+    }
+    frame.append(p, n);
+    send_raw(frame);
+}
+
 static bool sendbytes(int fd, const std::string& s, unsigned int *off) {
     unsigned int len = s.size() - *off;
     int n = write(fd, s.c_str() + *off, len);
@@ -1322,6 +1656,22 @@ bool CmdConnection::on_data_in(Glib::IOCondition cond) {
             serv.remove_connection(this);
             return false;
         }
+        if (protocol == proto_detect) {
+            // a JSON-RPC stream can't start with an HTTP method
+            protocol = (buf[0] == 'G' ? proto_handshake : proto_jsonrpc);
+        }
+        if (protocol == proto_handshake) {
+            if (!ws_handshake(buf, n)) {
+                return false;
+            }
+            continue;
+        }
+        if (protocol == proto_websocket) {
+            if (!ws_data_in(buf, n)) {
+                return false;
+            }
+            continue;
+        }
         char *p = buf;
         while (n-- > 0) {
             jp.put(*p);
@@ -1335,7 +1685,34 @@ bool CmdConnection::on_data_in(Glib::IOCondition cond) {
 }
 
 void CmdConnection::send(gx_system::JsonStringWriter& jw) {
-    std::string s = jw.get_string();
+    send(jw.get_string());
+}
+
+void CmdConnection::send(const std::string& s) {
+    if (protocol == proto_websocket) {
+        // drop the message delimiter of the stream protocol
+        size_t n = s.size();
+        if (n > 0 && s[n-1] == '\n') {
+            n--;
+        }
+        ws_send(s.data(), n, ws_op_text);
+    } else {
+        send_raw(s);
+    }
+}
+
+// WebSocket messages have their own length, so only the payload of
+// the frame is sent
+void CmdConnection::send_attachment(const std::string& frame) {
+    if (protocol == proto_websocket) {
+        ws_send(frame.data() + gx_system::JsonAttachment::header_size,
+                frame.size() - gx_system::JsonAttachment::header_size, ws_op_binary);
+    } else {
+        send_raw(frame);
+    }
+}
+
+void CmdConnection::send_raw(const std::string& s) {
     if (outgoing.size() == 0) {
         assert(current_offset == 0);
         ssize_t len = s.size();
@@ -1352,6 +1729,7 @@ void CmdConnection::send(gx_system::JsonStringWriter& jw) {
 }
 
 void CmdConnection::process(gx_system::JsonStringParser& jp) {
+    frames.clear();
     try {
         gx_system::JsonStringWriter jw;
         bool resp = false;
@@ -1369,11 +1747,17 @@ void CmdConnection::process(gx_system::JsonStringParser& jp) {
             resp = request(jp, jw, false);
         }
         if (!resp) {
+            frames.clear();
             return;
         }
         jw.finish();
+        for (std::list<std::string>::iterator i = frames.begin(); i != frames.end(); ++i) {
+            send_attachment(*i);
+        }
+        frames.clear();
         send(jw);
     } catch (gx_system::JsonException& e) {
+        frames.clear();
         gx_print_error(
             "JSON-RPC", Glib::ustring::compose("error: %1, request: '%2'",
                                                e.what(), jp.get_string()));
@@ -1382,6 +1766,7 @@ void CmdConnection::process(gx_system::JsonStringParser& jp) {
         jw.finish();
         send(jw);
     } catch (RpcError& e) {
+        frames.clear();
         gx_system::JsonStringWriter jw;
         error_response(jw, e.code, e.message);
         jw.finish();
@@ -1741,6 +2126,10 @@ GxService::GxService(gx_preset::GxSettings& settings_, gx_jack::GxJack& jack_,
         sigc::mem_fun(*this, &GxService::preset_changed));
     jack.get_engine().signal_state_change().connect(
         sigc::mem_fun(*this, &GxService::on_engine_state_change));
+    jack.get_engine().signal_plugin_fault().connect(
+        sigc::mem_fun(*this, &GxService::on_plugin_fault));
+    jack.get_engine().rt_trace.signal_dumped().connect(
+        sigc::mem_fun(*this, &GxService::on_rt_trace_dumped));
     jack.get_engine().tuner.signal_freq_changed().connect(
         sigc::mem_fun(this, &GxService::on_tuner_freq_changed));
     tuner_switcher.signal_display().connect(
@@ -2057,6 +2446,30 @@ void GxService::on_engine_state_change(gx_engine::GxEngineState state) {
     broadcast_list.push(bd);
 }
 
+void GxService::on_plugin_fault(const std::string& id, bool switched_off) {
+    if (!broadcast_listeners(CmdConnection::f_plugin_fault)) {
+        return;
+    }
+    gx_system::JsonStringWriter *jw = new gx_system::JsonStringWriter;
+    jw->send_notify_begin("plugin_fault");
+    jw->write(id);
+    jw->write(switched_off);
+    broadcast_data bd = {jw,CmdConnection::f_plugin_fault,0};
+    broadcast_list.push(bd);
+}
+
+// the trace itself is fetched with rt_trace
+void GxService::on_rt_trace_dumped(const std::string& fname) {
+    if (!broadcast_listeners(CmdConnection::f_rt_trace)) {
+        return;
+    }
+    gx_system::JsonStringWriter *jw = new gx_system::JsonStringWriter;
+    jw->send_notify_begin("rt_trace");
+    jw->write(fname);
+    broadcast_data bd = {jw,CmdConnection::f_rt_trace,0};
+    broadcast_list.push(bd);
+}
+
 void GxService::preset_changed() {
     if (!broadcast_listeners(CmdConnection::f_preset_changed)) {
         return;
@@ -2131,8 +2544,10 @@ void GxService::save_state() {
     if (!settings.get_options().get_opt_autosave()) {
         return;
     }
-    static const int min_idle = 10;  // seconds; after this idle time save state
-    static const int max_delay = 30; // seconds; maximum age of unsaved data
+    // saving is incremental (journal written in the background), so
+    // it can be done soon after a change
+    static const int min_idle = 2;   // seconds; after this idle time save state
+    static const int max_delay = 10; // seconds; maximum age of unsaved data
     time_t now = time(NULL);
     if (oldest_unsaved == 0) {
         oldest_unsaved = last_change = now;
@@ -2141,7 +2556,6 @@ void GxService::save_state() {
     }
     if (now - oldest_unsaved >= max_delay || now - last_change >= min_idle) {
         settings.save_to_state();
-        sync();
         oldest_unsaved = 0;
         save_conn.disconnect();
     } else {
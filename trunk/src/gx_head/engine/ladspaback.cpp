@@ -21,6 +21,11 @@
 #endif
 #include <ladspa.h>
 #include <dlfcn.h>
+#include <poll.h>
+#include <signal.h>
+#include <sys/wait.h>
+#include <glibmm/checksum.h>
+#include <glibmm/fileutils.h>
 
 #include "engine.h"
 
@@ -943,23 +948,23 @@ void LadspaPluginList::add_plugin(const LADSPA_Descriptor& desc, pluginmap& d, c
     d[make_key(desc.UniqueID)] = new PluginDesc(desc, tp, ctrl_ports, path, index);
 }
 
+// runs in a scan subprocess: no logging here, the error message is
+// passed back to the caller
 //static
-void LadspaPluginList::load_defs(const std::string& path, pluginmap& d) {
+bool LadspaPluginList::load_defs(const std::string& path, pluginmap& d, ustring& error) {
     void *handle;
     handle = dlopen(path.c_str(), RTLD_LOCAL|RTLD_NOW);
     if (!handle) {
-        gx_print_warning(
-            "ladspalist",
-            ustring::compose(_("Cannot open plugin: %1\n"), dlerror()));
-        return;
+        error = ustring::compose(_("Cannot open plugin: %1\n"), dlerror());
+        return false;
     }
     LADSPA_Descriptor_Function ladspa_descriptor = (LADSPA_Descriptor_Function)dlsym(handle, "ladspa_descriptor");
     const char *dlsym_error = dlerror();
     if (dlsym_error) {
-        gx_print_warning("ladspalist", dlsym_error);
+        error = dlsym_error;
         dlclose(handle);
         handle = 0;
-        return;
+        return false;
     }
     int i = 0;
     while (true) {
@@ -971,6 +976,205 @@ void LadspaPluginList::load_defs(const std::string& path, pluginmap& d) {
         i += 1;
     }
     dlclose(handle);
+    return true;
+}
+
+struct ScanJob {
+    std::string path;
+    std::string stamp;
+    pid_t pid;
+    int fd;
+    gint64 start;
+    std::string data;
+    ScanJob(const std::string& path_, const std::string& stamp_)
+        : path(path_), stamp(stamp_), pid(-1), fd(-1), start(), data() {}
+};
+
+static const int scan_timeout = 10;  // seconds until a hanging scan is killed
+
+// result of a scan subprocess:
+// {"error": <message>, "plugins": [<PluginDesc>...]}
+static void scan_result_parse(const std::string& data, std::vector<PluginDesc*>& plugins,
+                              ustring& error);
+
+//static
+void LadspaPluginList::scan_libraries(const std::vector<std::string>& libs, ScanCache& cache, pluginmap& d) {
+    std::list<ScanJob> pending;
+    for (std::vector<std::string>::const_iterator i = libs.begin(); i != libs.end(); ++i) {
+        std::string stamp = ScanCache::file_stamp(*i);
+        bool crashed;
+        if (!stamp.empty() && cache.get(*i, stamp, d, &crashed)) {
+            if (crashed) {
+                gx_print_warning(
+                    "ladspalist",
+                    ustring::compose(_("skipping %1 (crashed in an earlier scan)"), *i));
+            }
+            continue;
+        }
+        pending.push_back(ScanJob(*i, stamp));
+    }
+    if (pending.empty()) {
+        return;
+    }
+    // Every library is opened in its own forked process, so a
+    // plugin crashing (or hanging) in its initialization can't take
+    // down the application. The child only does dlopen / dlsym and
+    // writes the serialized descriptors into a pipe.
+    unsigned int maxjobs = std::max(1L, std::min(sysconf(_SC_NPROCESSORS_ONLN), 8L));
+    std::list<ScanJob> running;
+    while (!pending.empty() || !running.empty()) {
+        while (!pending.empty() && running.size() < maxjobs) {
+            ScanJob job = pending.front();
+            pending.pop_front();
+            int fds[2];
+            if (pipe(fds) == 0) {
+                job.pid = fork();
+                if (job.pid < 0) {
+                    close(fds[0]);
+                    close(fds[1]);
+                }
+            } else {
+                job.pid = -1;
+            }
+            if (job.pid == 0) {
+                close(fds[0]);
+                pluginmap pd;
+                ustring error;
+                load_defs(job.path, pd, error);
+                gx_system::JsonStringWriter jw;
+                jw.begin_object();
+                jw.write_kv("error", error.raw());
+                jw.write_key("plugins");
+                jw.begin_array();
+                for (pluginmap::iterator j = pd.begin(); j != pd.end(); ++j) {
+                    j->second->serializeJSON(jw);
+                }
+                jw.end_array();
+                jw.end_object();
+                std::string s = jw.get_string();
+                const char *p = s.c_str();
+                size_t n = s.size();
+                while (n > 0) {
+                    ssize_t k = write(fds[1], p, n);
+                    if (k < 0) {
+                        if (errno == EINTR) {
+                            continue;
+                        }
+                        _exit(1);
+                    }
+                    p += k;
+                    n -= k;
+                }
+                _exit(0);
+            }
+            if (job.pid < 0) {
+                // no subprocess available: scan in-process
+                pluginmap pd;
+                ustring error;
+                if (!load_defs(job.path, pd, error)) {
+                    gx_print_warning("ladspalist", error);
+                }
+                for (pluginmap::iterator j = pd.begin(); j != pd.end(); ++j) {
+                    d[j->first] = j->second;
+                }
+                continue;
+            }
+            close(fds[1]);
+            job.fd = fds[0];
+            job.start = g_get_monotonic_time();
+            running.push_back(job);
+        }
+        std::vector<struct pollfd> pfd(running.size());
+        int n = 0;
+        for (std::list<ScanJob>::iterator j = running.begin(); j != running.end(); ++j, ++n) {
+            pfd[n].fd = j->fd;
+            pfd[n].events = POLLIN;
+            pfd[n].revents = 0;
+        }
+        if (poll(&pfd[0], pfd.size(), 1000) < 0 && errno != EINTR) {
+            gx_print_error("ladspalist", ustring::compose("poll: %1", strerror(errno)));
+            break;
+        }
+        gint64 now = g_get_monotonic_time();
+        n = 0;
+        for (std::list<ScanJob>::iterator j = running.begin(); j != running.end(); ++n) {
+            bool done = false;
+            if (pfd[n].revents & (POLLIN|POLLHUP|POLLERR)) {
+                char buf[4096];
+                ssize_t k = read(j->fd, buf, sizeof(buf));
+                if (k > 0) {
+                    j->data.append(buf, k);
+                } else if (k == 0 || errno != EINTR) {
+                    done = true;
+                }
+            }
+            if (!done && now - j->start > scan_timeout * G_USEC_PER_SEC) {
+                kill(j->pid, SIGKILL);
+                done = true;
+            }
+            if (!done) {
+                ++j;
+                continue;
+            }
+            close(j->fd);
+            int status;
+            while (waitpid(j->pid, &status, 0) == -1) {
+                if (errno != EINTR) {
+                    status = -1;
+                    break;
+                }
+            }
+            std::vector<PluginDesc*> plugins;
+            if (status == -1 || !WIFEXITED(status) || WEXITSTATUS(status) != 0) {
+                gx_print_warning(
+                    "ladspalist",
+                    ustring::compose(_("scanning %1 failed, library disabled until it changes"), j->path));
+                if (!j->stamp.empty()) {
+                    cache.put(j->path, j->stamp, plugins, true, d);
+                }
+            } else {
+                ustring error;
+                scan_result_parse(j->data, plugins, error);
+                if (!error.empty()) {
+                    // not cached: the library might just miss a
+                    // dependency which gets installed later
+                    gx_print_warning("ladspalist", error);
+                    ScanCache::insert(plugins, d);
+                } else if (j->stamp.empty()) {
+                    ScanCache::insert(plugins, d);
+                } else {
+                    cache.put(j->path, j->stamp, plugins, false, d);
+                }
+            }
+            j = running.erase(j);
+        }
+    }
+}
+
+static void scan_result_parse(const std::string& data, std::vector<PluginDesc*>& plugins,
+                              ustring& error) {
+    gx_system::JsonStringParser jp;
+    jp.get_ostream() << data;
+    jp.start_parser();
+    try {
+        jp.next(JsonParser::begin_object);
+        while (jp.peek() != JsonParser::end_object) {
+            jp.next(JsonParser::value_key);
+            if (jp.read_kv("error", error)) {
+            } else if (jp.current_value() == "plugins") {
+                jp.next(JsonParser::begin_array);
+                while (jp.peek() != JsonParser::end_array) {
+                    plugins.push_back(ScanCache::parse_plugin(jp));
+                }
+                jp.next(JsonParser::end_array);
+            } else {
+                jp.skip_object();
+            }
+        }
+        jp.next(JsonParser::end_object);
+    } catch (JsonException& e) {
+        error = _("bad scan result");
+    }
 }
 
 bool PluginDesc::check_changed() {
@@ -1262,6 +1466,198 @@ void PluginDesc::set_old() {
 }
 
 
+/****************************************************************
+ ** class ScanCache
+ */
+
+static const int scan_cache_version = 1;
+
+ScanCache::Entry::~Entry() {
+    if (owned) {
+        for (std::vector<PluginDesc*>::iterator i = plugins.begin(); i != plugins.end(); ++i) {
+            delete *i;
+        }
+    }
+}
+
+ScanCache::ScanCache(const std::string& filename_)
+    : filename(filename_), entries(), dirty(false) {
+    read();
+}
+
+ScanCache::~ScanCache() {
+    for (entrymap::iterator i = entries.begin(); i != entries.end(); ++i) {
+        delete i->second;
+    }
+}
+
+//static
+PluginDesc *ScanCache::parse_plugin(gx_system::JsonParser& jp) {
+    return new PluginDesc(jp);
+}
+
+// a cache from another version is silently dropped (the set of
+// supported LV2 features and the descriptor format may have changed)
+void ScanCache::read() {
+    ifstream is(filename.c_str());
+    if (is.fail()) {
+        return;
+    }
+    try {
+        JsonParser jp(&is);
+        jp.next(JsonParser::begin_array);
+        jp.next(JsonParser::value_number);
+        if (jp.current_value_int() != scan_cache_version) {
+            return;
+        }
+        jp.next(JsonParser::value_string);
+        if (jp.current_value() != GX_VERSION) {
+            return;
+        }
+        jp.next(JsonParser::begin_object);
+        while (jp.peek() != JsonParser::end_object) {
+            jp.next(JsonParser::value_key);
+            Entry *e = new Entry();
+            std::pair<entrymap::iterator, bool> r = entries.insert(entrymap::value_type(jp.current_value(), e));
+            if (!r.second) {
+                delete r.first->second;
+                r.first->second = e;
+            }
+            jp.next(JsonParser::begin_object);
+            while (jp.peek() != JsonParser::end_object) {
+                jp.next(JsonParser::value_key);
+                if (jp.read_kv("stamp", e->stamp) ||
+                    jp.read_kv("crashed", e->crashed)) {
+                } else if (jp.current_value() == "plugins") {
+                    jp.next(JsonParser::begin_array);
+                    while (jp.peek() != JsonParser::end_array) {
+                        e->plugins.push_back(new PluginDesc(jp));
+                    }
+                    jp.next(JsonParser::end_array);
+                } else {
+                    jp.skip_object();
+                }
+            }
+            jp.next(JsonParser::end_object);
+        }
+        jp.next(JsonParser::end_object);
+        jp.next(JsonParser::end_array);
+        jp.close();
+    } catch (JsonException& e) {
+        gx_print_warning(
+            "ladspalist", ustring::compose(_("ignoring damaged plugin scan cache %1"), filename));
+        for (entrymap::iterator i = entries.begin(); i != entries.end(); ++i) {
+            delete i->second;
+        }
+        entries.clear();
+    }
+    is.close();
+}
+
+// "" if the file can't be accessed
+//static
+std::string ScanCache::file_stamp(const std::string& path) {
+    struct stat st;
+    if (stat(path.c_str(), &st) != 0) {
+        return "";
+    }
+    return gx_system::to_string(static_cast<long long>(st.st_mtime)) + ":" +
+        gx_system::to_string(static_cast<long long>(st.st_size));
+}
+
+// transfers ownership of the PluginDesc's to d
+//static
+void ScanCache::insert(std::vector<PluginDesc*>& plugins, pluginmap& d) {
+    for (std::vector<PluginDesc*>::iterator i = plugins.begin(); i != plugins.end(); ++i) {
+        d[(*i)->is_lv2 ? (*i)->path : LadspaPluginList::make_key((*i)->UniqueID)] = *i;
+    }
+}
+
+bool ScanCache::get(const std::string& key, const std::string& stamp, pluginmap& d, bool *crashed) {
+    entrymap::iterator i = entries.find(key);
+    if (i == entries.end() || i->second->stamp != stamp || !i->second->owned) {
+        return false;
+    }
+    Entry *e = i->second;
+    e->seen = true;
+    e->owned = false;
+    insert(e->plugins, d);
+    if (crashed) {
+        *crashed = e->crashed;
+    }
+    return true;
+}
+
+// The PluginDesc's are handed over to d, the cache only keeps
+// references until save() has been called. They must not be
+// modified before that.
+void ScanCache::put(const std::string& key, const std::string& stamp, std::vector<PluginDesc*>& plugins,
+                    bool crashed, pluginmap& d) {
+    Entry *e = new Entry();
+    e->stamp = stamp;
+    e->crashed = crashed;
+    e->owned = false;
+    e->seen = true;
+    e->plugins = plugins;
+    std::pair<entrymap::iterator, bool> r = entries.insert(entrymap::value_type(key, e));
+    if (!r.second) {
+        delete r.first->second;
+        r.first->second = e;
+    }
+    insert(plugins, d);
+    dirty = true;
+}
+
+// writes the entries used in this scan; entries of libraries which
+// have been removed are dropped
+void ScanCache::save() {
+    for (entrymap::iterator i = entries.begin(); i != entries.end(); ++i) {
+        if (!i->second->seen) {
+            dirty = true;
+            break;
+        }
+    }
+    if (!dirty) {
+        return;
+    }
+    std::string tfname = filename + ".tmp";
+    ofstream os(tfname.c_str());
+    JsonWriter jw(&os);
+    jw.begin_array();
+    jw.write(scan_cache_version);
+    jw.write(GX_VERSION);
+    jw.begin_object(true);
+    for (entrymap::iterator i = entries.begin(); i != entries.end(); ++i) {
+        Entry *e = i->second;
+        if (!e->seen) {
+            continue;
+        }
+        jw.write_key(i->first);
+        jw.begin_object();
+        jw.write_kv("stamp", e->stamp);
+        jw.write_kv("crashed", e->crashed);
+        jw.write_key("plugins");
+        jw.begin_array();
+        for (std::vector<PluginDesc*>::iterator j = e->plugins.begin(); j != e->plugins.end(); ++j) {
+            (*j)->serializeJSON(jw);
+        }
+        jw.end_array();
+        jw.end_object(true);
+    }
+    jw.end_object(true);
+    jw.end_array(true);
+    jw.close();
+    os.close();
+    if (os.fail() || rename(tfname.c_str(), filename.c_str()) != 0) {
+        gx_print_warning(
+            "ladspalist", ustring::compose(_("can't write plugin scan cache %1"), filename));
+        unlink(tfname.c_str());
+        return;
+    }
+    dirty = false;
+}
+
+
 /****************************************************************
  ** class LadspaPluginList
  */
@@ -1290,9 +1686,17 @@ LadspaPluginList::LadspaPluginList()
       lv2_AtomPort(lilv_new_uri(world, LV2_ATOM__AtomPort)) {
     LilvNode* false_val = lilv_new_bool(world, false);
     lilv_world_set_option(world,LILV_OPTION_DYN_MANIFEST, false_val);
+    lilv_node_free(false_val);
+}
+
+// loading all bundles is expensive, only done when the scan cache
+// can't be used
+void LadspaPluginList::load_lv2_world() {
+    if (lv2_plugins) {
+        return;
+    }
     lilv_world_load_all(world);
     lv2_plugins = lilv_world_get_all_plugins(world);
-    lilv_node_free(false_val);
 }
 
 static bool in_1_based_range(unsigned long uid) {
@@ -1488,6 +1892,11 @@ bool LadspaPluginList::feature_is_supported(const char* uri)
             return true;
         }
     }
+    for (const char*const* f = gx_engine::LV2Features::getInstance().gx_instance_features; *f; ++f) {
+        if (!strcmp(uri, *f)) {
+            return true;
+        }
+    }
     return false;
 }
 void LadspaPluginList::add_plugin(const LilvPlugin* plugin, pluginmap& d, gx_system::CmdlineOptions& options) {
@@ -1639,6 +2048,7 @@ void LadspaPluginList::add_plugin(const LilvPlugin* plugin, pluginmap& d, gx_sys
 }
 
 void LadspaPluginList::lv2_load(pluginmap& d, gx_system::CmdlineOptions& options) {
+    load_lv2_world();
     for (LilvIter* it = lilv_plugins_begin(lv2_plugins);
             !lilv_plugins_is_end(lv2_plugins, it);
             it = lilv_plugins_next(lv2_plugins, it)) {
@@ -1662,13 +2072,86 @@ void LadspaPluginList::lv2_load(pluginmap& d, gx_system::CmdlineOptions& options
     options.reload_lv2_presets = false;
 }
 
+// Changes of a bundle (installed, removed, updated) show up in the
+// mtime of the bundle directory or in mtime / size of its .ttl files
+// (files edited in place don't change the directory mtime).
+//static
+std::string LadspaPluginList::lv2_fingerprint() {
+    gx_system::PathList pl("LV2_PATH");
+    if (!pl.size()) {
+        pl.add(Glib::build_filename(Glib::get_home_dir(), ".lv2"));
+        pl.add("/usr/local/lib/lv2");
+        pl.add("/usr/lib/lv2");
+        pl.add("/usr/local/lib64/lv2");
+        pl.add("/usr/lib64/lv2");
+    }
+    std::string s;
+    for (gx_system::PathList::iterator it = pl.begin(); it != pl.end(); ++it) {
+        Glib::RefPtr<Gio::File> file = *it;
+        std::string dir = file->get_path();
+        std::string st = ScanCache::file_stamp(dir);
+        if (st.empty()) {
+            continue;
+        }
+        s += dir + "=" + st + "\n";
+        Glib::Dir bundles(dir);
+        std::vector<std::string> names(bundles.begin(), bundles.end());
+        std::sort(names.begin(), names.end());
+        for (std::vector<std::string>::iterator i = names.begin(); i != names.end(); ++i) {
+            std::string bundle = Glib::build_filename(dir, *i);
+            s += *i + "=" + ScanCache::file_stamp(bundle);
+            if (Glib::file_test(bundle, Glib::FILE_TEST_IS_DIR)) {
+                Glib::Dir files(bundle);
+                std::vector<std::string> ttl;
+                for (Glib::DirIterator f = files.begin(); f != files.end(); ++f) {
+                    if (Glib::str_has_suffix(*f, ".ttl")) {
+                        ttl.push_back(*f);
+                    }
+                }
+                std::sort(ttl.begin(), ttl.end());
+                for (std::vector<std::string>::iterator f = ttl.begin(); f != ttl.end(); ++f) {
+                    s += "," + *f + ":" + ScanCache::file_stamp(Glib::build_filename(bundle, *f));
+                }
+            }
+            s += "\n";
+        }
+    }
+    return Glib::Checksum::compute_checksum(Glib::Checksum::CHECKSUM_SHA1, s);
+}
+
+void LadspaPluginList::lv2_load_cached(ScanCache& cache, pluginmap& d, gx_system::CmdlineOptions& options) {
+    std::string fp;
+    try {
+        fp = lv2_fingerprint();
+    } catch (Glib::FileError& e) {
+        fp = "";
+    }
+    // regenerating the preset files needs the lilv world
+    if (!fp.empty() && !options.reload_lv2_presets && cache.get("lv2:", fp, d)) {
+        return;
+    }
+    pluginmap ld;
+    lv2_load(ld, options);
+    std::vector<PluginDesc*> plugins;
+    for (pluginmap::iterator i = ld.begin(); i != ld.end(); ++i) {
+        plugins.push_back(i->second);
+    }
+    if (fp.empty()) {
+        ScanCache::insert(plugins, d);
+    } else {
+        cache.put("lv2:", fp, plugins, false, d);
+    }
+}
+
 static bool cmp_plugins(const PluginDesc *a, const PluginDesc *b) {
     return ustring(a->Name) < ustring(b->Name);
 }
 
 void LadspaPluginList::load(gx_system::CmdlineOptions& options, std::vector<std::string>& old_not_found) {
     pluginmap d;
+    ScanCache cache(options.get_user_filepath("plugin_scan_cache.js"));
 #ifndef GUITARIX_AS_PLUGIN
+    std::vector<std::string> libs;
     gx_system::PathList pl("LADSPA_PATH");
     if (!pl.size()) {
         pl.add("/usr/lib/ladspa");
@@ -1693,11 +2176,16 @@ void LadspaPluginList::load(gx_system::CmdlineOptions& options, std::vector<std:
                 if (lib_is_blacklisted(nm)) {
                     continue;
                 }
-                //printf("opening %s/%s\n", file->get_path().c_str(), nm.c_str());
-                load_defs(Glib::build_filename(file->get_path(), nm), d);
+                libs.push_back(Glib::build_filename(file->get_path(), nm));
             }
         }
     }
+    scan_libraries(libs, cache, d);
+#endif
+    lv2_load_cached(cache, d, options);
+    // before the entries in d get modified
+    cache.save();
+#ifndef GUITARIX_AS_PLUGIN
     gx_system::PathList rpl("LADSPA_RDF_PATH");
     if (!rpl.size()) {
         rpl.add("/usr/share/ladspa/rdf");
@@ -1737,7 +2225,6 @@ void LadspaPluginList::load(gx_system::CmdlineOptions& options, std::vector<std:
     freelocale(loc);
     lrdf_cleanup();
 #endif
-    lv2_load(d, options);
 
     ifstream is(options.get_ladspa_config_filename().c_str());
     if (!is.fail()) {
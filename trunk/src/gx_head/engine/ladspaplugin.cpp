@@ -51,7 +51,10 @@ private:
     Glib::ustring dest_str;
     const plugdesc *pd;
     bool is_activated;
+    unsigned int samplerate;
     void connect(int tp, int i, float *v);
+    bool instantiate();
+    inline void release_instance();
     inline void cleanup();
     void set_shortname();
     float dry_wet;
@@ -143,7 +146,8 @@ LadspaDsp *LadspaDsp::create(const plugdesc *plug) {
 
 LadspaDsp::LadspaDsp(const plugdesc *plug, void *handle_, const LADSPA_Descriptor *desc_, bool mono, bool to_mono)
     : PluginDef(), desc(desc_), handle(handle_), instance(),
-      ports(new LADSPA_Data[desc->PortCount]), name_str(), dest_str(), pd(plug), is_activated(false) {
+      ports(new LADSPA_Data[desc->PortCount]), name_str(), dest_str(), pd(plug), is_activated(false),
+      samplerate(0) {
     version = PLUGINDEF_VERSION;
     id = pd->id_str.c_str();
     category = pd->category.c_str();
@@ -167,16 +171,22 @@ LadspaDsp::LadspaDsp(const plugdesc *plug, void *handle_, const LADSPA_Descripto
     delete_instance = del_instance;
 }
 
+inline void LadspaDsp::release_instance() {
+    if (!(pd->quirks & no_cleanup)) {
+        desc->cleanup(instance);
+    }
+    instance = 0;
+}
+
 inline void LadspaDsp::cleanup() {
     if (instance) {
         if (pd->quirks & need_activate) {
             activate(true, this);
         }
         activate(false, this);
-        if (!(pd->quirks & no_cleanup)) {
-            desc->cleanup(instance);
+        if (instance) {
+            release_instance();
         }
-        instance = 0;
     }
 }
 
@@ -302,20 +312,32 @@ LadspaDsp::~LadspaDsp() {
     delete[] ports;
 }
 
+// The plugin instance only exists while the plugin is in a
+// processing chain: it is created when the chain activates the
+// plugin and freed again when the plugin is taken out.
 int LadspaDsp::activate(bool start, PluginDef *plugin) {
     LadspaDsp& self = *static_cast<LadspaDsp*>(plugin);
     if (start == self.is_activated) {
         return 0;
     }
-    self.is_activated = start;
     if (start) {
+        if (!self.instantiate()) {
+            return 1;
+        }
+        self.is_activated = true;
         if (self.desc->activate) {
             self.desc->activate(self.instance);
         }
     } else {
+        self.is_activated = false;
         if (self.desc->deactivate) {
             self.desc->deactivate(self.instance);
         }
+        if (!(self.pd->quirks & no_cleanup)) {
+            // with no_cleanup the instance would leak on every
+            // remove, so keep it until the samplerate changes
+            self.release_instance();
+        }
     }
     return 0;
 }
@@ -355,17 +377,29 @@ void LadspaDsp::set_shortname() {
     }
 }
 
+// only remember the samplerate, the instance is created on demand
 void LadspaDsp::init(unsigned int samplingFreq, PluginDef *plugin) {
     LadspaDsp& self = *static_cast<LadspaDsp*>(plugin);
     self.cleanup();
-    if (samplingFreq == 0) {
-        return;
+    self.samplerate = samplingFreq;
+}
+
+bool LadspaDsp::instantiate() {
+    if (instance) {
+        return true;
     }
-    self.instance = self.desc->instantiate(self.desc, samplingFreq);
-    int n = 0;
-    for (std::vector<paradesc*>::const_iterator it = self.pd->names.begin(); it != self.pd->names.end(); ++it, ++n) {
-        self.desc->connect_port(self.instance, (*it)->index, &self.ports[(*it)->index]);
+    if (samplerate == 0) {
+        return false;
     }
+    instance = desc->instantiate(desc, samplerate);
+    if (!instance) {
+        gx_print_error("ladspaloader", ustring::compose(_("cant init plugin: %1"), name));
+        return false;
+    }
+    for (std::vector<paradesc*>::const_iterator it = pd->names.begin(); it != pd->names.end(); ++it) {
+        desc->connect_port(instance, (*it)->index, &ports[(*it)->index]);
+    }
+    return true;
 }
 
 inline void LadspaDsp::mono_dry_wet(int count, float *input0, float *input1, float *output0)
@@ -752,6 +786,7 @@ static std::vector<std::string> gx_uri_mapping = {
     LV2_ATOM__Double,
     LV2_BUF_SIZE__maxBlockLength,
     LV2_BUF_SIZE__minBlockLength,
+    LV2_BUF_SIZE__nominalBlockLength,
 };
 
 
@@ -825,14 +860,369 @@ LV2_Feature LV2Features::gx_urid_unmap_feature = {
     LV2_URID__unmap, &gx_urid_unmap
 };
 
+LV2_Feature LV2Features::gx_bounded_block_feature = {
+    LV2_BUF_SIZE__boundedBlockLength, nullptr
+};
+
+LV2_Feature LV2Features::gx_fixed_block_feature = {
+    LV2_BUF_SIZE__fixedBlockLength, nullptr
+};
+
 LV2_Feature* LV2Features::gx_features[] = {
     &gx_urid_map_feature,
     &gx_uri_map_feature,
     &gx_urid_unmap_feature,
     &gx_options_feature,
+    &gx_bounded_block_feature,
+    &gx_fixed_block_feature,
+    nullptr
+};
+
+const char* LV2Features::gx_instance_features[] = {
+    LV2_WORKER__schedule,
     nullptr
 };
 
+/****************************************************************
+ ** class LV2MsgRing
+ ** single reader / single writer message queue, lock free
+ ** (written by the rt thread, read by a worker thread or vice versa)
+ */
+
+class LV2MsgRing: boost::noncopyable {
+private:
+    char *buf;
+    unsigned int size;  // power of 2
+    volatile unsigned int write_pos;
+    volatile unsigned int read_pos;
+    inline unsigned int used() { return gx_system::atomic_get(write_pos) - gx_system::atomic_get(read_pos); }
+    void copy_in(unsigned int pos, const void *data, unsigned int len);
+    void copy_out(unsigned int pos, void *data, unsigned int len);
+public:
+    LV2MsgRing(unsigned int size_);
+    ~LV2MsgRing() { delete[] buf; }
+    bool push(uint32_t len, const void *data);
+    uint32_t peek_size();
+    void pop(uint32_t len, void *data);
+    void reset() { write_pos = read_pos = 0; }
+};
+
+LV2MsgRing::LV2MsgRing(unsigned int size_)
+    : buf(new char[size_]), size(size_), write_pos(0), read_pos(0) {
+    assert((size & (size-1)) == 0);
+}
+
+void LV2MsgRing::copy_in(unsigned int pos, const void *data, unsigned int len) {
+    pos &= size - 1;
+    unsigned int n = min(len, size - pos);
+    memcpy(buf + pos, data, n);
+    memcpy(buf, static_cast<const char*>(data) + n, len - n);
+}
+
+void LV2MsgRing::copy_out(unsigned int pos, void *data, unsigned int len) {
+    pos &= size - 1;
+    unsigned int n = min(len, size - pos);
+    memcpy(data, buf + pos, n);
+    memcpy(static_cast<char*>(data) + n, buf, len - n);
+}
+
+bool LV2MsgRing::push(uint32_t len, const void *data) {
+    if (size - used() < sizeof(len) + len) {
+        return false;
+    }
+    unsigned int wp = write_pos;
+    copy_in(wp, &len, sizeof(len));
+    copy_in(wp + sizeof(len), data, len);
+    gx_system::atomic_set(&write_pos, wp + sizeof(len) + len);
+    return true;
+}
+
+uint32_t LV2MsgRing::peek_size() {
+    if (used() < sizeof(uint32_t)) {
+        return 0;
+    }
+    uint32_t len;
+    copy_out(read_pos, &len, sizeof(len));
+    return len;
+}
+
+void LV2MsgRing::pop(uint32_t len, void *data) {
+    unsigned int rp = read_pos;
+    copy_out(rp + sizeof(len), data, len);
+    gx_system::atomic_set(&read_pos, rp + sizeof(len) + len);
+}
+
+/****************************************************************
+ ** class LV2Worker, class LV2WorkerPool
+ ** LV2 worker extension: the plugin schedules non-rt work from
+ ** run(), a pool thread executes it and the responses are handed
+ ** back in the next run cycle
+ ** During save() / restore() (non-rt) the plugin gets a different
+ ** schedule feature which calls work() synchronously, so the
+ ** request ring keeps the rt thread as its only producer
+ */
+
+class LV2Worker: boost::noncopyable {
+private:
+    enum { ring_size = 1 << 15 };
+    LilvInstance *instance;
+    const LV2_Worker_Interface *iface;
+    LV2MsgRing requests;
+    LV2MsgRing responses;
+    boost::mutex work_mutex;  // work() is not reentrant for one instance
+    char *workbuf;   // used by the worker thread
+    char *respbuf;   // used by the rt thread
+    LV2_Worker_Schedule schedule;
+    LV2_Feature schedule_feature;
+    LV2_Worker_Schedule sync_schedule;
+    LV2_Feature sync_schedule_feature;
+    static LV2_Worker_Status schedule_work(LV2_Worker_Schedule_Handle handle, uint32_t size, const void* data);
+    static LV2_Worker_Status schedule_work_sync(LV2_Worker_Schedule_Handle handle, uint32_t size, const void* data);
+    static LV2_Worker_Status respond(LV2_Worker_Respond_Handle handle, uint32_t size, const void* data);
+    friend class LV2WorkerPool;
+    bool pending() { return requests.peek_size() != 0; }
+    void do_work();
+public:
+    LV2Worker();
+    ~LV2Worker();
+    const LV2_Feature *get_feature() const { return &schedule_feature; }
+    const LV2_Feature *get_sync_feature() const { return &sync_schedule_feature; }
+    void set_instance(LilvInstance *inst);
+    inline void run_responses();
+};
+
+class LV2WorkerPool: boost::noncopyable {
+private:
+    enum { num_threads = 2 };
+    std::vector<pthread_t> threads;
+    sem_t sem;
+    volatile int stop;
+    boost::mutex list_mutex;
+    std::list<LV2Worker*> workers;
+    static void *run_thread(void *p);
+    LV2Worker *next_pending();
+    void start_threads();
+    LV2WorkerPool();
+    ~LV2WorkerPool();
+public:
+    static LV2WorkerPool& getInstance() {
+        static LV2WorkerPool instance;
+        return instance;
+    }
+    void add(LV2Worker *w);
+    void remove(LV2Worker *w);
+    inline void notify() { sem_post(&sem); } // RT
+};
+
+LV2WorkerPool::LV2WorkerPool()
+    : threads(), sem(), stop(false), list_mutex(), workers() {
+    sem_init(&sem, 0, 0);
+}
+
+LV2WorkerPool::~LV2WorkerPool() {
+    gx_system::atomic_set(&stop, true);
+    for (unsigned int i = 0; i < threads.size(); ++i) {
+        sem_post(&sem);
+    }
+    for (std::vector<pthread_t>::iterator i = threads.begin(); i != threads.end(); ++i) {
+        pthread_join(*i, NULL);
+    }
+    sem_destroy(&sem);
+}
+
+void LV2WorkerPool::start_threads() {
+    // started on first use: most racks don't contain a plugin
+    // with work:schedule
+    for (int i = 0; i < num_threads; ++i) {
+        pthread_t pthr;
+        if (pthread_create(&pthr, NULL, run_thread, this)) {
+            gx_print_error("lv2worker", _("can't create worker thread"));
+            break;
+        }
+        threads.push_back(pthr);
+    }
+}
+
+void LV2WorkerPool::add(LV2Worker *w) {
+    boost::mutex::scoped_lock lock(list_mutex);
+    if (threads.empty()) {
+        start_threads();
+    }
+    workers.push_back(w);
+}
+
+void LV2WorkerPool::remove(LV2Worker *w) {
+    {
+        boost::mutex::scoped_lock lock(list_mutex);
+        workers.remove(w);
+    }
+    // wait for a running work() call
+    boost::mutex::scoped_lock lock(w->work_mutex);
+}
+
+// returns a worker with pending requests, work_mutex locked
+LV2Worker *LV2WorkerPool::next_pending() {
+    boost::mutex::scoped_lock lock(list_mutex);
+    for (std::list<LV2Worker*>::iterator i = workers.begin(); i != workers.end(); ++i) {
+        if ((*i)->pending() && (*i)->work_mutex.try_lock()) {
+            return *i;
+        }
+    }
+    return 0;
+}
+
+void *LV2WorkerPool::run_thread(void *p) {
+    LV2WorkerPool& self = *static_cast<LV2WorkerPool*>(p);
+    while (true) {
+        sem_wait(&self.sem);
+        if (gx_system::atomic_get(self.stop)) {
+            break;
+        }
+        LV2Worker *w = self.next_pending();
+        if (!w) {
+            continue; // handled by another thread
+        }
+        w->do_work();
+        bool more = w->pending();
+        w->work_mutex.unlock();
+        if (more) {
+            // scheduled while we were busy and another thread
+            // couldn't get the lock
+            self.notify();
+        }
+    }
+    return NULL;
+}
+
+LV2Worker::LV2Worker()
+    : instance(), iface(), requests(ring_size), responses(ring_size), work_mutex(),
+      workbuf(new char[ring_size]), respbuf(new char[ring_size]), schedule(), schedule_feature(),
+      sync_schedule(), sync_schedule_feature() {
+    schedule.handle = this;
+    schedule.schedule_work = schedule_work;
+    schedule_feature.URI = LV2_WORKER__schedule;
+    schedule_feature.data = &schedule;
+    sync_schedule.handle = this;
+    sync_schedule.schedule_work = schedule_work_sync;
+    sync_schedule_feature.URI = LV2_WORKER__schedule;
+    sync_schedule_feature.data = &sync_schedule;
+}
+
+LV2Worker::~LV2Worker() {
+    set_instance(0);
+    delete[] workbuf;
+    delete[] respbuf;
+}
+
+void LV2Worker::set_instance(LilvInstance *inst) {
+    if (iface) {
+        LV2WorkerPool::getInstance().remove(this);
+    }
+    instance = inst;
+    iface = 0;
+    requests.reset();
+    responses.reset();
+    if (inst) {
+        iface = static_cast<const LV2_Worker_Interface*>(
+            lilv_instance_get_extension_data(inst, LV2_WORKER__interface));
+        if (iface) {
+            LV2WorkerPool::getInstance().add(this);
+        }
+    }
+}
+
+LV2_Worker_Status LV2Worker::schedule_work(LV2_Worker_Schedule_Handle handle, uint32_t size, const void* data) {
+    LV2Worker& self = *static_cast<LV2Worker*>(handle);
+    if (!self.iface) {
+        return LV2_WORKER_ERR_UNKNOWN;
+    }
+    if (!self.requests.push(size, data)) {
+        return LV2_WORKER_ERR_NO_SPACE;
+    }
+    LV2WorkerPool::getInstance().notify();
+    return LV2_WORKER_SUCCESS;
+}
+
+// non-rt (save / restore): work() runs in the calling thread; the
+// responses are handed to the plugin in the next run cycle (work_mutex
+// keeps this and the pool thread from pushing responses at once)
+LV2_Worker_Status LV2Worker::schedule_work_sync(LV2_Worker_Schedule_Handle handle, uint32_t size, const void* data) {
+    LV2Worker& self = *static_cast<LV2Worker*>(handle);
+    if (!self.iface) {
+        return LV2_WORKER_ERR_UNKNOWN;
+    }
+    boost::mutex::scoped_lock lock(self.work_mutex);
+    return self.iface->work(lilv_instance_get_handle(self.instance), respond, &self, size, data);
+}
+
+LV2_Worker_Status LV2Worker::respond(LV2_Worker_Respond_Handle handle, uint32_t size, const void* data) {
+    LV2Worker& self = *static_cast<LV2Worker*>(handle);
+    if (!self.responses.push(size, data)) {
+        return LV2_WORKER_ERR_NO_SPACE;
+    }
+    return LV2_WORKER_SUCCESS;
+}
+
+void LV2Worker::do_work() {
+    uint32_t n;
+    while ((n = requests.peek_size())) {
+        requests.pop(n, workbuf);
+        iface->work(lilv_instance_get_handle(instance), respond, this, n, workbuf);
+    }
+}
+
+// called in the rt thread after run()
+inline void LV2Worker::run_responses() {
+    if (!iface) {
+        return;
+    }
+    uint32_t n;
+    while ((n = responses.peek_size())) {
+        responses.pop(n, respbuf);
+        iface->work_response(lilv_instance_get_handle(instance), n, respbuf);
+    }
+    if (iface->end_run) {
+        iface->end_run(lilv_instance_get_handle(instance));
+    }
+}
+
+/****************************************************************
+ ** class Lv2StateParameter
+ ** plugin state (state:interface) as string parameter, so it gets
+ ** saved and restored with the presets
+ */
+
+class Lv2StateParameter: public StringParameter {
+private:
+    sigc::slot<void> capture;
+    Lv2StateParameter(const string& id, Glib::ustring *v, sigc::slot<void> capture_)
+        : StringParameter(id, "", v, "", true), capture(capture_) {}
+public:
+    static Lv2StateParameter *insert_param(ParamMap& pmap, const string& id, Glib::ustring *v,
+                                           sigc::slot<void> capture);
+    virtual void writeJSON(gx_system::JsonWriter& jw) const override;
+    virtual void setJSON_value() override;
+};
+
+Lv2StateParameter *Lv2StateParameter::insert_param(
+        ParamMap& pmap, const string& id, Glib::ustring *v, sigc::slot<void> capture) {
+    Lv2StateParameter *p = new Lv2StateParameter(id, v, capture);
+    pmap.insert(p);
+    return p;
+}
+
+void Lv2StateParameter::writeJSON(gx_system::JsonWriter& jw) const {
+    capture();
+    StringParameter::writeJSON(jw);
+}
+
+// always restore: the plugin state may have changed since the value
+// was captured
+void Lv2StateParameter::setJSON_value() {
+    *value = json_value;
+    changed(*value);
+}
+
 /****************************************************************
  ** class Lv2Dsp
  */
@@ -857,7 +1247,24 @@ private:
     Glib::ustring dest_str;
     const plugdesc *pd;
     bool is_activated;
+    unsigned int samplerate;
+    LV2Worker worker;
+    int32_t block_length;
+    LV2_Options_Option block_options[4];
+    LV2_Feature options_feature;
+    std::vector<const LV2_Feature*> features;
+    std::vector<const LV2_Feature*> state_features; // non-rt worker
+    bool has_state;
+    Glib::ustring state;
+    sigc::connection buffersize_conn;
+    void make_features();
+    void capture_state();
+    void restore_state(const Glib::ustring& st);
+    void do_restore_state();
+    void change_buffersize(unsigned int size);
     void connect(const LilvNode* tp, int i, float *v);
+    bool instantiate();
+    inline void release_instance();
     inline void cleanup();
     void set_shortname();
     float dry_wet;
@@ -925,7 +1332,9 @@ Lv2Dsp *Lv2Dsp::create(const plugdesc *plug, const LadspaLoader& loader) {
 
 Lv2Dsp::Lv2Dsp(const plugdesc *plug, const LilvPlugin* plugin_, const LadspaLoader& loader_, bool mono, bool to_mono)
     : PluginDef(), loader(loader_), plugin(plugin_), name_node(lilv_plugin_get_name(plugin_)), instance(),
-      ports(new LADSPA_Data[lilv_plugin_get_num_ports(plugin_)]), name_str(), dest_str(), pd(plug), is_activated(false) {
+      ports(new LADSPA_Data[lilv_plugin_get_num_ports(plugin_)]), name_str(), dest_str(), pd(plug), is_activated(false),
+      samplerate(0), worker(), block_length(), block_options(), options_feature(), features(), state_features(), has_state(false), state(),
+      buffersize_conn() {
     version = PLUGINDEF_VERSION;
     id = pd->id_str.c_str();
     category = pd->category.c_str();
@@ -954,6 +1363,51 @@ Lv2Dsp::Lv2Dsp(const plugdesc *plug, const LilvPlugin* plugin_, const LadspaLoad
     register_params = registerparam;
     load_ui = uiloader;
     delete_instance = del_instance;
+    make_features();
+    buffersize_conn = loader.engine.signal_buffersize_change().connect(
+        sigc::mem_fun(*this, &Lv2Dsp::change_buffersize));
+}
+
+// per instance feature list: the shared features from LV2Features,
+// options with the actual block length and the worker; the same with
+// the synchronous worker for save() and restore()
+void Lv2Dsp::make_features() {
+    LV2_URID atom_int = LV2Features::gx_urid_map.map(0, LV2_ATOM__Int);
+    const char *opts[] = { LV2_BUF_SIZE__minBlockLength, LV2_BUF_SIZE__maxBlockLength,
+                           LV2_BUF_SIZE__nominalBlockLength };
+    for (unsigned int i = 0; i < 3; ++i) {
+        LV2_Options_Option& o = block_options[i];
+        o.context = LV2_OPTIONS_INSTANCE;
+        o.subject = 0;
+        o.key = LV2Features::gx_urid_map.map(0, opts[i]);
+        o.size = sizeof(int32_t);
+        o.type = atom_int;
+        o.value = &block_length;
+    }
+    block_options[3] = LV2_Options_Option(); // terminator
+    options_feature.URI = LV2_OPTIONS__options;
+    options_feature.data = block_options;
+    features.clear();
+    for (LV2_Feature** f = LV2Features::getInstance().gx_features; *f; ++f) {
+        if (!strcmp((*f)->URI, LV2_OPTIONS__options)) {
+            features.push_back(&options_feature);
+        } else {
+            features.push_back(*f);
+        }
+    }
+    state_features = features;
+    features.push_back(worker.get_feature());
+    features.push_back(nullptr);
+    state_features.push_back(worker.get_sync_feature());
+    state_features.push_back(nullptr);
+}
+
+inline void Lv2Dsp::release_instance() {
+    worker.set_instance(0);
+    if (!(pd->quirks & no_cleanup)) {
+        lilv_instance_free(instance);
+    }
+    instance = 0;
 }
 
 inline void Lv2Dsp::cleanup() {
@@ -962,33 +1416,41 @@ inline void Lv2Dsp::cleanup() {
             activate(true, this);
         }
         activate(false, this);
-        if (!(pd->quirks & no_cleanup)) {
-            lilv_instance_free(instance);
+        if (instance) {
+            release_instance();
         }
-        instance = 0;
     }
 }
 
 Lv2Dsp::~Lv2Dsp() {
+    buffersize_conn.disconnect();
     cleanup();
     delete[] ports;
     lilv_node_free(name_node);
 }
 
+// like LadspaDsp: the instance is created when the plugin is put
+// into a processing chain and freed when it is taken out; the
+// plugin state is carried over in the state string
 int Lv2Dsp::activate(bool start, PluginDef *plugin) {
     Lv2Dsp& self = *static_cast<Lv2Dsp*>(plugin);
     if (start == self.is_activated) {
         return 0;
     }
-    if (!self.instance) { 
-        gx_print_warning("Lv2Dsp", ustring::compose("cant activate plugin %1", self.name));
-        return 1;
-    }
-    self.is_activated = start;
     if (start) {
+        if (!self.instantiate()) {
+            gx_print_warning("Lv2Dsp", ustring::compose("cant activate plugin %1", self.name));
+            return 1;
+        }
+        self.is_activated = true;
         lilv_instance_activate(self.instance);
     } else {
+        self.is_activated = false;
         lilv_instance_deactivate(self.instance);
+        if (!(self.pd->quirks & no_cleanup)) {
+            self.capture_state();
+            self.release_instance();
+        }
     }
     return 0;
 }
@@ -1031,20 +1493,122 @@ void Lv2Dsp::set_shortname() {
 }
 
 
+// only remember the samplerate, the instance is created on demand
 void Lv2Dsp::init(unsigned int samplingFreq, PluginDef *pldef) {
     Lv2Dsp& self = *static_cast<Lv2Dsp*>(pldef);
+    self.capture_state(); // carry over into the new instance
     self.cleanup();
-    if (samplingFreq == 0) {
+    self.samplerate = samplingFreq;
+}
+
+bool Lv2Dsp::instantiate() {
+    if (instance) {
+        return true;
+    }
+    if (samplerate == 0) {
+        return false;
+    }
+    // the engine always runs with the jack period size, so
+    // min == max == nominal (fixedBlockLength)
+    block_length = loader.engine.get_buffersize();
+    if (!block_length) {
+        block_length = max_block_length;
+    }
+    instance = lilv_plugin_instantiate(plugin, samplerate, &features[0]);
+    if (!instance) { 
+        gx_print_error("Lv2Dsp", ustring::compose("cant init plugin: %1 \n uri: %2", name, pd->path));
+        return false;
+    }
+    for (std::vector<paradesc*>::const_iterator it = pd->names.begin(); it != pd->names.end(); ++it) {
+        lilv_instance_connect_port(instance, (*it)->index, &ports[(*it)->index]);
+    }
+    worker.set_instance(instance);
+    has_state = (lilv_instance_get_extension_data(instance, LV2_STATE__interface) != 0);
+    do_restore_state();
+    return true;
+}
+
+// buffersize_change is emitted with the engine stopped, from the
+// main loop (jack) or activate() (ladspa), never in the rt thread
+void Lv2Dsp::change_buffersize(unsigned int size) {
+    if (!instance || static_cast<int32_t>(size) == block_length) {
         return;
     }
-    self.instance = lilv_plugin_instantiate(self.plugin, samplingFreq, LV2Features::getInstance().gx_features);
-    if (!self.instance) { 
-        gx_print_error("Lv2Dsp", ustring::compose("cant init plugin: %1 \n uri: %2", self.name, self.pd->path));
+    bool was_active = is_activated;
+    init(loader.engine.get_samplerate(), this);
+    if (was_active) {
+        activate(true, this);
+    }
+}
+
+static const void *no_port_values(const char*, void*, uint32_t *size, uint32_t *type) {
+    // control ports are saved as guitarix parameters
+    *size = *type = 0;
+    return NULL;
+}
+
+void Lv2Dsp::capture_state() {
+    if (!instance || !has_state) {
         return;
     }
-    int n = 0;
-    for (std::vector<paradesc*>::const_iterator it = self.pd->names.begin(); it != self.pd->names.end(); ++it, ++n) {
-        lilv_instance_connect_port(self.instance, (*it)->index, &self.ports[(*it)->index]);
+    LV2Features& f = LV2Features::getInstance();
+    // like most hosts we call save() from the gui thread
+    // concurrently with run(); the state extension requires plugins
+    // to handle that
+    LilvState *st = lilv_state_new_from_instance(
+        plugin, instance, &f.gx_urid_map, NULL, NULL, NULL, NULL,
+        no_port_values, NULL, LV2_STATE_IS_POD|LV2_STATE_IS_PORTABLE, &state_features[0]);
+    if (!st) {
+        return;
+    }
+    char *s = lilv_state_to_string(loader.world, &f.gx_urid_map, &f.gx_urid_unmap,
+                                   st, "urn:guitarix:lv2state", NULL);
+    if (s) {
+        state = s;
+        lilv_free(s);
+    }
+    lilv_state_free(st);
+}
+
+void Lv2Dsp::do_restore_state() {
+    if (!instance || !has_state || state.empty()) {
+        return;
+    }
+    LilvState *st = lilv_state_new_from_string(
+        loader.world, &LV2Features::getInstance().gx_urid_map, state.c_str());
+    if (!st) {
+        gx_print_error("Lv2Dsp", ustring::compose(_("can't parse state of plugin %1"), name));
+        return;
+    }
+    lilv_state_restore(st, instance, NULL, NULL, 0, &state_features[0]);
+    lilv_state_free(st);
+}
+
+void Lv2Dsp::restore_state(const Glib::ustring& st) {
+    state = st;
+    if (!is_activated) {
+        do_restore_state();
+        return;
+    }
+    // restore() must not run concurrently with run() unless the
+    // plugin declares state:threadSafeRestore
+    LilvNode *ts = lilv_new_uri(loader.world, LV2_STATE__threadSafeRestore);
+    bool thread_safe = lilv_plugin_has_feature(plugin, ts);
+    lilv_node_free(ts);
+    if (thread_safe) {
+        do_restore_state();
+        return;
+    }
+    // when loading a preset the chains are already held down and
+    // the caller ramps up after the commit
+    bool held = loader.engine.is_ramped_down();
+    if (!held) {
+        loader.engine.start_ramp_down();
+    }
+    loader.engine.wait_ramp_down_finished();
+    do_restore_state();
+    if (!held) {
+        loader.engine.start_ramp_up();
     }
 }
 
@@ -1065,11 +1629,13 @@ void Lv2Dsp::mono_process(int count, float *input, float *output, PluginDef *plu
         self.connect(self.loader.lv2_InputPort, 0, input);
         self.connect(self.loader.lv2_OutputPort, 0, wet_out);
         lilv_instance_run(self.instance, count);
+        self.worker.run_responses();
         self.mono_dry_wet(count, input, wet_out, output);
     } else {
         self.connect(self.loader.lv2_InputPort, 0, input);
         self.connect(self.loader.lv2_OutputPort, 0, output);
         lilv_instance_run(self.instance, count);
+        self.worker.run_responses();
     }
 }
 
@@ -1099,6 +1665,7 @@ void Lv2Dsp::to_mono_process(int count, float *input, float *output, PluginDef *
         self.connect(self.loader.lv2_OutputPort, 0, outputs);
         self.connect(self.loader.lv2_OutputPort, 1, outputs1);
         lilv_instance_run(self.instance, count);
+        self.worker.run_responses();
         self.down_to_mono(count,outputs,outputs1,wet_out);
         self.mono_dry_wet(count, input, wet_out, output);
     } else {
@@ -1112,6 +1679,7 @@ void Lv2Dsp::to_mono_process(int count, float *input, float *output, PluginDef *
         self.connect(self.loader.lv2_OutputPort, 0, outputs);
         self.connect(self.loader.lv2_OutputPort, 1, outputs1);
         lilv_instance_run(self.instance, count);
+        self.worker.run_responses();
         self.down_to_mono(count,outputs,outputs1,output);
     }
 }
@@ -1137,6 +1705,7 @@ void Lv2Dsp::stereo_process(int count, float *input1, float *input2, float *outp
         self.connect(self.loader.lv2_OutputPort, 0, wet_out1);
         self.connect(self.loader.lv2_OutputPort, 1, wet_out2);
         lilv_instance_run(self.instance, count);
+        self.worker.run_responses();
         self.stereo_dry_wet(count, input1, input2, wet_out1, wet_out2, output1, output2);
     } else {
         self.connect(self.loader.lv2_InputPort, 0, input1);
@@ -1144,6 +1713,7 @@ void Lv2Dsp::stereo_process(int count, float *input1, float *input2, float *outp
         self.connect(self.loader.lv2_OutputPort, 0, output1);
         self.connect(self.loader.lv2_OutputPort, 1, output2);
         lilv_instance_run(self.instance, count);
+        self.worker.run_responses();
     }
 }
 
@@ -1219,6 +1789,14 @@ int Lv2Dsp::registerparam(const ParamReg& reg) {
     }
     self.idd = self.pd->id_str + ".dry_wet";
     reg.registerFloatVar(self.idd.c_str(),"","S","dry/wet",&self.dry_wet, 100, 0, 100, 1, 0);
+    LilvNode *si = lilv_new_uri(self.loader.world, LV2_STATE__interface);
+    if (lilv_plugin_has_extension_data(self.plugin, si)) {
+        Lv2StateParameter::insert_param(
+            self.loader.get_parameter_map(), self.pd->id_str + ".state", &self.state,
+            sigc::mem_fun(self, &Lv2Dsp::capture_state))->signal_changed().connect(
+                sigc::mem_fun(self, &Lv2Dsp::restore_state));
+    }
+    lilv_node_free(si);
     return 0;
 }
 
@@ -1391,10 +1969,32 @@ PluginDef *LadspaLoader::create(const plugdesc *p) {
     }
 }
 
-LadspaLoader::LadspaLoader(const gx_system::CmdlineOptions& options_,ParamMap& param_)
+// all engines of the process share one world: loading the lv2
+// bundles is the most expensive part of the engine setup, and the
+// world is only used from the main thread
+LilvWorld* LadspaLoader::shared_world = 0;
+int LadspaLoader::world_refcount = 0;
+
+LilvWorld* LadspaLoader::acquire_world() {
+    if (world_refcount++ == 0) {
+        shared_world = lilv_world_new();
+        lilv_world_load_all(shared_world);
+    }
+    return shared_world;
+}
+
+void LadspaLoader::release_world() {
+    if (--world_refcount == 0) {
+        lilv_world_free(shared_world);
+        shared_world = 0;
+    }
+}
+
+LadspaLoader::LadspaLoader(const gx_system::CmdlineOptions& options_, EngineControl& engine_, ParamMap& param_)
     : options(options_),
+      engine(engine_),
       plugins(),
-      world(lilv_world_new()),
+      world(acquire_world()),
       param(param_),
       lv2_plugins(),
       lv2_AudioPort(lilv_new_uri(world, LV2_CORE__AudioPort)),
@@ -1402,7 +2002,6 @@ LadspaLoader::LadspaLoader(const gx_system::CmdlineOptions& options_,ParamMap& p
       lv2_InputPort(lilv_new_uri(world, LV2_CORE__InputPort)),
       lv2_OutputPort(lilv_new_uri(world, LV2_CORE__OutputPort)),
       lv2_AtomPort(lilv_new_uri(world, LV2_ATOM__AtomPort)) {
-    lilv_world_load_all(world);
     lv2_plugins = lilv_world_get_all_plugins(world);
     load(plugins);
 }
@@ -1421,7 +2020,7 @@ LadspaLoader::~LadspaLoader() {
     lilv_node_free(lv2_ControlPort);
     lilv_node_free(lv2_AudioPort);
     lilv_node_free(lv2_AtomPort);
-    lilv_world_free(world);
+    release_world();
 }
 
 bool LadspaLoader::load(pluginarray& ml) {
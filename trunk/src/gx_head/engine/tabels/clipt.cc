@@ -1,5 +1,5 @@
 
-static table1dc_imp<100> clippingtable[2] __rt_data = {{
+static nltable_imp<100> clippingtable[2] __rt_data = {{
 	0.005,0.542511530324,101.97,100, {
 	0.00548195523019,0.0164458656904,0.0274097761501,0.0383736866088,0.0493375970657,
 	0.0603015075192,0.071265417967,0.082229328405,0.0931932388259,0.104157149217,
@@ -1,5 +1,5 @@
 
-static table1dc_imp<100> clippingtable2[2] __rt_data = {{
+static nltable_imp<100> clippingtable2[2] __rt_data = {{
 
 	0.006,0.801341155829,101.97,100, {
 	0.00603015075336,0.01809045226,0.0301507537665,0.0422110552725,0.054271356778,
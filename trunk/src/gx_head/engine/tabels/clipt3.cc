@@ -1,5 +1,5 @@
 
-static table1dc_imp<100> clippingtable3[2] __rt_data = {
+static nltable_imp<100> clippingtable3[2] __rt_data = {
 
 		{	0,0.970874,101.97,100, {
 	0.0,-0.0297094517538,-0.0600106764386,-0.0909157810379,-0.122426702394,
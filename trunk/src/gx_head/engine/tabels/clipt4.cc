@@ -1,5 +1,5 @@
 
-static table1dc_imp<100> clippingtable4[2] __rt_data = {{
+static nltable_imp<100> clippingtable4[2] __rt_data = {{
 	0,0.970874,101.97,100, {
 	0.0,-0.0297117955828,-0.0600180054016,-0.0909366474689,-0.122486475452,
 	-0.154687016603,-0.187558612066,-0.221122459724,-0.255400659785,-0.290416263311,
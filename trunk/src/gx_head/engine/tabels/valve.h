@@ -30,31 +30,12 @@
 #define SRC_HEADERS_VALVE_H_
 
 /****************************************************************
- * 1-dimensional function tables for linear interpolation
- *
- * table1d and table1d_imp<size> must only differ in the last
- * element, so that the typecast for tubetab below will work.
- * Can't use inheritance because then C initializers will not
- * work and initialization will be more awkward or less efficient.
+ * 1-dimensional function tables, see gx_nltable.h
+ * (the tables are generated for cubic interpolation, see
+ * gen_tube_tables)
  */
 
-struct table1d { // 1-dimensional function table
-    float low;
-    float high;
-    float istep;
-    int size;
-    float data[];
-};
-
-template <int tab_size>
-struct table1d_imp {
-    float low;
-    float high;
-    float istep;
-    int size;
-    float data[tab_size];
-    operator table1d&() const { return *(table1d*)this; }
-};
+#include "gx_nltable.h"
 
 /*
  * data tables generated by tools/tube_transfer.py
@@ -82,34 +63,34 @@ enum {
     TUBE_TABLE_SIZE
 };
 
-table1d *tubetab[TUBE_TABLE_SIZE] = {
-    &static_cast<table1d&>(tubetable_12AX7[0]),
-    &static_cast<table1d&>(tubetable_12AX7[1]),
-    &static_cast<table1d&>(tubetable_6V6[0]),
-    &static_cast<table1d&>(tubetable_6V6[1]),
-    &static_cast<table1d&>(tubetable_12AU7[0]),
-    &static_cast<table1d&>(tubetable_12AU7[1]),
-    &static_cast<table1d&>(tubetable_6DJ8[0]),
-    &static_cast<table1d&>(tubetable_6DJ8[1]),
-    &static_cast<table1d&>(tubetable_12AT7[0]),
-    &static_cast<table1d&>(tubetable_12AT7[1]),
-    &static_cast<table1d&>(tubetable_6C16[0]),
-    &static_cast<table1d&>(tubetable_6C16[1]),
+nltable *tubetab[TUBE_TABLE_SIZE] = {
+    &static_cast<nltable&>(tubetable_12AX7[0]),
+    &static_cast<nltable&>(tubetable_12AX7[1]),
+    &static_cast<nltable&>(tubetable_6V6[0]),
+    &static_cast<nltable&>(tubetable_6V6[1]),
+    &static_cast<nltable&>(tubetable_12AU7[0]),
+    &static_cast<nltable&>(tubetable_12AU7[1]),
+    &static_cast<nltable&>(tubetable_6DJ8[0]),
+    &static_cast<nltable&>(tubetable_6DJ8[1]),
+    &static_cast<nltable&>(tubetable_12AT7[0]),
+    &static_cast<nltable&>(tubetable_12AT7[1]),
+    &static_cast<nltable&>(tubetable_6C16[0]),
+    &static_cast<nltable&>(tubetable_6C16[1]),
 };
 
-table1d *tubetab2[TUBE_TABLE_SIZE] = {
-    &static_cast<table1d&>(tubetable2_12AX7[0]),
-    &static_cast<table1d&>(tubetable2_12AX7[1]),
-    &static_cast<table1d&>(tubetable2_6V6[0]),
-    &static_cast<table1d&>(tubetable2_6V6[1]),
-    &static_cast<table1d&>(tubetable2_12AU7[0]),
-    &static_cast<table1d&>(tubetable2_12AU7[1]),
-    &static_cast<table1d&>(tubetable2_6DJ8[0]),
-    &static_cast<table1d&>(tubetable2_6DJ8[1]),
-    &static_cast<table1d&>(tubetable2_12AT7[0]),
-    &static_cast<table1d&>(tubetable2_12AT7[1]),
-    &static_cast<table1d&>(tubetable2_6C16[0]),
-    &static_cast<table1d&>(tubetable2_6C16[1]),
+nltable *tubetab2[TUBE_TABLE_SIZE] = {
+    &static_cast<nltable&>(tubetable2_12AX7[0]),
+    &static_cast<nltable&>(tubetable2_12AX7[1]),
+    &static_cast<nltable&>(tubetable2_6V6[0]),
+    &static_cast<nltable&>(tubetable2_6V6[1]),
+    &static_cast<nltable&>(tubetable2_12AU7[0]),
+    &static_cast<nltable&>(tubetable2_12AU7[1]),
+    &static_cast<nltable&>(tubetable2_6DJ8[0]),
+    &static_cast<nltable&>(tubetable2_6DJ8[1]),
+    &static_cast<nltable&>(tubetable2_12AT7[0]),
+    &static_cast<nltable&>(tubetable2_12AT7[1]),
+    &static_cast<nltable&>(tubetable2_6C16[0]),
+    &static_cast<nltable&>(tubetable2_6C16[1]),
 };
 
 /*
@@ -118,27 +99,11 @@ table1d *tubetab2[TUBE_TABLE_SIZE] = {
  */
 
 static inline double Ftube(int table, double Vgk) {
-    const table1d& tab = *tubetab[table];
-    double f = (Vgk - tab.low) * tab.istep;
-    int i = static_cast<int>(f);
-    if (i < 0)
-        return tab.data[0];
-    if (i >= tab.size-1)
-        return tab.data[tab.size-1];
-    f -= i;
-    return tab.data[i]*(1-f) + tab.data[i+1]*f;
+    return nltable_lookup<3>(*tubetab[table], Vgk);
 }
 
 static inline double Ranode(int table, double Vgk) {
-    const table1d& tab = *tubetab2[table];
-    double f = (Vgk - tab.low) * tab.istep;
-    int i = static_cast<int>(f);
-    if (i < 0)
-        return tab.data[0];
-    if (i >= tab.size-1)
-        return tab.data[tab.size-1];
-    f -= i;
-    return tab.data[i]*(1-f) + tab.data[i+1]*f;
+    return nltable_lookup<3>(*tubetab2[table], Vgk);
 }
 
 #endif  // SRC_HEADERS_VALVE_H_
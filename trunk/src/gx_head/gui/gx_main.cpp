@@ -33,6 +33,9 @@
 #include <thread>
 
 #include "jsonrpc.h"
+#ifndef GUITARIX_AS_PLUGIN
+#include "gx_offline_render.h"
+#endif
 
 #ifdef HAVE_AVAHI
 #include "avahi_discover.h"
@@ -199,11 +202,7 @@ int GxNsmHandler::_nsm_open (const char *name, const char *display_name,
 }
  
 int GxNsmHandler::_nsm_save ( char **out_msg) {
-    if (gx_preset::GxSettings::instance && nsm) {
-        bool cur_state = gx_preset::GxSettings::instance->get_auto_save_state();
-        gx_preset::GxSettings::instance->disable_autosave(false);
-        gx_preset::GxSettings::instance->auto_save_state();
-        gx_preset::GxSettings::instance->disable_autosave(cur_state);
+    if (nsm && gx_preset::GxSettings::save_all_states()) {
         nsmsig->trigger_nsm_save_gui();
     }    
     return ERR_OK;
@@ -435,12 +434,7 @@ void PosixSignals::quit_slot() {
 void PosixSignals::gx_ladi_handler() {
     gx_print_warning(
         _("signal_handler"), _("signal USR1 received, save settings"));
-    if (gx_preset::GxSettings::instance) {
-        bool cur_state = gx_preset::GxSettings::instance->get_auto_save_state();
-        gx_preset::GxSettings::instance->disable_autosave(false);
-        gx_preset::GxSettings::instance->auto_save_state();
-        gx_preset::GxSettings::instance->disable_autosave(cur_state);
-    }
+    gx_preset::GxSettings::save_all_states();
 }
 
 void PosixSignals::relay_sigchld(int) {
@@ -715,41 +709,112 @@ static void mainHeadless(int argc, char *argv[]) {
         return;
     }
 
-    gx_engine::GxMachine machine(options);
-
+    // with --rigs every rig is a complete engine with its own jack
+    // client, parameters, state file, preset banks and rpc port; the
+    // lv2 world, the static plugin tables and the main loop are shared
     gx_jack::GxJack::rt_watchdog_set_limit(options.get_idle_thread_timeout());
-    machine.loadstate();
-    //if (!in_session) {
-    //    gx_settings.disable_autosave(options.get_opt_auto_save());
-    //}
-
-    if (! machine.get_jack()->gx_jack_connection(true, true, 0, options)) {
-        cerr << "can't connect to jack\n";
-        return;
-    }
-    if (need_new_preset) {
-        machine.create_default_scratch_preset();
-    }
-    // when midiout is requested we need to reload state in order to send midi feedback
-    if (options.system_midiout) machine.loadstate();
-    if (options.system_tuner_midiout) machine.set_parameter_value("system.midiout_tuner", true);
-    // ----------------------- Run Glib main loop ----------------------
-    cout << "Ctrl-C to quit\n";
     Glib::RefPtr<Glib::MainLoop> loop = Glib::MainLoop::create();
-    machine.get_jack()->shutdown.connect(sigc::mem_fun(loop.operator->(),&Glib::MainLoop::quit));
+    Glib::ustring instancename = options.get_jack_instancename();
+    std::string basename = instancename;
+    if (basename.empty()) {
+        basename = gx_jack::GxJack::get_default_instancename();
+    }
     int port = options.get_rpcport();
     if (port == RPCPORT_DEFAULT) {
         port = 7000;
     }
-    if (port != RPCPORT_NONE) {
-        machine.start_socket(sigc::mem_fun(loop.operator->(),&Glib::MainLoop::quit), options.get_rpcaddress(), port);
-        loop->run();
-    } else {
+    std::string preset_dir = options.get_preset_dir();
+    std::vector<gx_engine::GxMachine*> rigs;
+    for (int k = 0; k < options.get_rigs(); ++k) {
+        if (k > 0) {
+            options.set_jack_instancename(
+                (boost::format("%1%_%2%") % basename % (k+1)).str());
+            // PresetBanks doesn't synchronize with other instances
+            // working on the same files, so each rig gets its own
+            // bank directory (banks_2, banks_3, ...)
+            options.set_preset_dir(
+                Glib::build_filename(options.get_user_dir(),
+                                     (boost::format("banks_%1%") % (k+1)).str()) + "/");
+            gx_preset::GxSettings::check_settings_dir(options, &need_new_preset);
+        }
+        gx_engine::GxMachine *machine = new gx_engine::GxMachine(options);
+        rigs.push_back(machine);
+        machine->loadstate();
+        //if (!in_session) {
+        //    gx_settings.disable_autosave(options.get_opt_auto_save());
+        //}
+
+        if (! machine->get_jack()->gx_jack_connection(true, true, 0, options)) {
+            cerr << "can't connect to jack\n";
+            break;
+        }
+        if (need_new_preset) {
+            machine->create_default_scratch_preset();
+        }
+        // when midiout is requested we need to reload state in order to send midi feedback
+        if (options.system_midiout) machine->loadstate();
+        if (options.system_tuner_midiout) machine->set_parameter_value("system.midiout_tuner", true);
+        machine->get_jack()->shutdown.connect(sigc::mem_fun(loop.operator->(),&Glib::MainLoop::quit));
+        if (port != RPCPORT_NONE) {
+            machine->start_socket(sigc::mem_fun(loop.operator->(),&Glib::MainLoop::quit), options.get_rpcaddress(), port + k);
+        }
+    }
+    options.set_jack_instancename(instancename);
+    options.set_preset_dir(preset_dir);
+    // ----------------------- Run Glib main loop ----------------------
+    if (rigs.back()->get_jack()->client) {
+        cout << "Ctrl-C to quit\n";
         loop->run();
     }
+    for (std::vector<gx_engine::GxMachine*>::reverse_iterator i = rigs.rbegin(); i != rigs.rend(); ++i) {
+        delete *i;
+    }
     gx_child_process::childprocs.killall();
 }
 
+static int mainRender(int argc, char *argv[]) {
+    Glib::init();
+    Gio::init();
+
+    gx_system::CmdlineOptions options;
+    options.parse(argc, argv);
+    options.process(argc, argv);
+    bool need_new_preset;
+    if (gx_preset::GxSettings::check_settings_dir(options, &need_new_preset)) {
+        cerr << _("old config directory found (.gx_head), start guitarix once to convert it\n");
+        return 1;
+    }
+    std::vector<gx_engine::RenderJob> jobs;
+    std::map<std::string, std::string> outputs; // output -> input
+    const std::vector<std::string>& inputs = options.get_render_inputs();
+    for (std::vector<std::string>::const_iterator i = inputs.begin(); i != inputs.end(); ++i) {
+        std::string dir = options.get_render_output_dir();
+        if (dir.empty()) {
+            dir = Glib::path_get_dirname(*i) + "/";
+        }
+        std::string base = Glib::path_get_basename(*i);
+        std::string::size_type n = base.rfind('.');
+        if (n != std::string::npos && n > 0) {
+            base.erase(n);
+        }
+        std::string out = dir + base + "_gx.wav";
+        std::map<std::string, std::string>::iterator o = outputs.find(out);
+        if (o != outputs.end()) {
+            cerr << boost::format(_("%1% and %2% would both be rendered to %3%\n"))
+                % o->second % *i % out;
+            return 1;
+        }
+        outputs[out] = *i;
+        jobs.push_back(gx_engine::RenderJob(*i, out));
+    }
+    int failed = gx_engine::OfflineRenderer::render_jobs(options, jobs);
+    if (failed) {
+        cerr << boost::format(_("%1% of %2% files failed to render\n")) % failed % jobs.size();
+        return 1;
+    }
+    return 0;
+}
+
 static void exception_handler() {
     try {
         throw; // re-throw current exception
@@ -793,6 +858,16 @@ static bool is_headless(int argc, char *argv[]) {
     return false;
 }
 
+static bool is_render(int argc, char *argv[]) {
+    for (int i = 0; i < argc; ++i) {
+        // -R FILE, -RFILE, --render-input FILE, --render-input=FILE
+        if (strncmp(argv[i], "-R", 2) == 0 || strncmp(argv[i], "--render-input", 14) == 0) {
+            return true;
+        }
+    }
+    return false;
+}
+
 static bool is_frontend(int argc, char *argv[]) {
     for (int i = 0; i < argc; ++i) {
         if (strcmp(argv[i], "-G") == 0 || strcmp(argv[i], "--onlygui") == 0) {
@@ -977,7 +1052,9 @@ int main(int argc, char *argv[]) {
         Glib::thread_init();
     }
 #endif
-    if (is_headless(argc, argv)) {
+    if (is_render(argc, argv)) {
+        return mainRender(argc, argv);
+    } else if (is_headless(argc, argv)) {
         mainHeadless(argc, argv);
     } else {
         mainProg(argc, argv);
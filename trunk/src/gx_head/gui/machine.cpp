@@ -54,7 +54,13 @@ void set_memory_allocation() {}
 
 #endif
 
+// locked once for all engine instances (rigs) of the process
+static int rt_memory_lock_count = 0;
+
 void lock_rt_memory() {
+    if (rt_memory_lock_count++ > 0) {
+	return;
+    }
 #ifndef GUITARIX_AS_PLUGIN
 #ifndef __APPLE__
     extern char __rt_text__start[], __rt_text__end[];
@@ -84,6 +90,9 @@ void lock_rt_memory() {
 }
 
 void unlock_rt_memory() {
+    if (--rt_memory_lock_count > 0) {
+	return;
+    }
 #ifndef GUITARIX_AS_PLUGIN
 #ifndef __APPLE__    
     extern char __rt_text__start[], __rt_text__end[];
@@ -694,6 +703,7 @@ void GxMachine::set_statefilename(const std::string& fn) {
 
 void GxMachine::save_to_state(bool preserve_preset) {
     settings.save_to_state(preserve_preset);
+    settings.flush_state();
 }
 
 void GxMachine::plugin_preset_list_load(const PluginDef *pdef, gx_preset::UnitPresetList &presetnames) {
@@ -805,6 +815,10 @@ bank_iterator GxMachine::bank_end() {
     return bank_iterator(settings.banks.end());
 }
 
+void GxMachine::search_presets(const gx_system::PresetQuery& q, std::vector<gx_system::PresetMatch>& result) {
+    settings.banks.search(q, result);
+}
+
 void GxMachine::pf_append(gx_system::PresetFileGui& pf, const Glib::ustring& src, gx_system::PresetFileGui& pftgt, const Glib::ustring& name) {
     settings.append(pf, src, pftgt, name);
 }
@@ -1628,6 +1642,11 @@ gx_system::JsonStringParser *GxMachineRemote::receive() {
     bool error = false;
     gx_system::JsonStringParser *jp_ret = 0;
     gx_system::JsonStringParser *jp = new gx_system::JsonStringParser;
+    bool msg_start = true;
+    bool in_frame = false;
+    std::string frame;
+    unsigned int frame_len = 0;
+    attachments.clear();
     try {
 	while (true) {
 	    int n;
@@ -1642,9 +1661,41 @@ gx_system::JsonStringParser *GxMachineRemote::receive() {
 		return 0;
 	    }
 	    char *p = buf;
-	    while (n-- > 0) {
+	    while (n > 0) {
+		if (in_frame) {
+		    // binary attachment (see JsonAttachment)
+		    if (frame.size() < gx_system::JsonAttachment::header_size) {
+			frame += *p++;
+			n--;
+			if (frame.size() == gx_system::JsonAttachment::header_size) {
+			    frame_len = gx_system::JsonAttachment::header_size
+				+ gx_system::JsonAttachment::payload_length(frame);
+			}
+		    } else {
+			unsigned int k = min<unsigned int>(n, frame_len - frame.size());
+			frame.append(p, k);
+			p += k;
+			n -= k;
+		    }
+		    if (frame.size() == frame_len) {
+			attachments.push_back(frame.substr(gx_system::JsonAttachment::header_size));
+			frame.clear();
+			in_frame = false;
+		    }
+		    continue;
+		}
+		if (msg_start && *p == gx_system::JsonAttachment::frame_marker) {
+		    frame.assign(1, *p++);
+		    n--;
+		    frame_len = gx_system::JsonAttachment::header_size;
+		    in_frame = true;
+		    continue;
+		}
+		msg_start = false;
+		n--;
 		jp->put(*p);
 		if (*p == '\n') {
+		    msg_start = true;
 		    jp->start_parser();
 		    jp->next(gx_system::JsonParser::begin_object);
 		    jp->next(gx_system::JsonParser::value_key); // "jsonrpc"
@@ -2467,6 +2518,27 @@ bank_iterator GxMachineRemote::bank_end() {
     return banks.end();
 }
 
+void GxMachineRemote::search_presets(const gx_system::PresetQuery& q, std::vector<gx_system::PresetMatch>& result) {
+    START_CALL(preset_search);
+    jw->write(q.name);
+    jw->write(q.plugin);
+    jw->write(q.irfile);
+    jw->write(q.param);
+    jw->write(q.value);
+    START_RECEIVE();
+    jp->next(gx_system::JsonParser::begin_array);
+    while (jp->peek() != gx_system::JsonParser::end_array) {
+	jp->next(gx_system::JsonParser::begin_array);
+	jp->next(gx_system::JsonParser::value_string);
+	Glib::ustring bank = jp->current_value();
+	jp->next(gx_system::JsonParser::value_string);
+	result.push_back(gx_system::PresetMatch(bank, jp->current_value()));
+	jp->next(gx_system::JsonParser::end_array);
+    }
+    jp->next(gx_system::JsonParser::end_array);
+    END_RECEIVE();
+}
+
 void GxMachineRemote::pf_append(gx_system::PresetFileGui& pf, const Glib::ustring& src, gx_system::PresetFileGui& pftgt, const Glib::ustring& name) {
     START_NOTIFY(pf_append);
     jw->write(pf.get_name());
@@ -2983,6 +3055,7 @@ bool GxMachineRemote::read_audio(const std::string& filename, unsigned int *audi
 				 int *audio_type, int *audio_form, int *audio_rate, float **buffer) {
     START_CALL(read_audio);
     jw->write(filename);
+    jw->write(gx_system::JsonAttachment::accept_f32|gx_system::JsonAttachment::accept_deflate);
     START_RECEIVE(false);
     if (jp->peek() != gx_system::JsonParser::begin_array) {
 	*audio_size = 0;
@@ -3001,6 +3074,21 @@ bool GxMachineRemote::read_audio(const std::string& filename, unsigned int *audi
     *audio_form = jp->current_value_int();
     jp->next(gx_system::JsonParser::value_number);
     *audio_rate = jp->current_value_int();
+    if (jp->peek() == gx_system::JsonParser::begin_object) {
+	if (attachments.empty()) {
+	    throw gx_system::JsonException("read_audio: attachment missing");
+	}
+	unsigned int count;
+	*buffer = gx_system::JsonAttachment::read(*jp, attachments.front(), &count);
+	attachments.pop_front();
+	if (count != *audio_size * *audio_chan) {
+	    delete[] *buffer;
+	    *buffer = 0;
+	    throw gx_system::JsonException("read_audio: bad sample count");
+	}
+	jp->next(gx_system::JsonParser::end_array);
+	return true;
+    }
     jp->next(gx_system::JsonParser::begin_array);
     *buffer = new float[*audio_size * *audio_chan];
     float *p = *buffer;
@@ -128,7 +128,9 @@ void PluginUI::activate(bool animate, const string& before) {
     }
     active = true;
     hidden = plugin_dict.get_plugins_hidden();
-    toolitem->hide();
+    if (toolitem) {
+        toolitem->hide();
+    }
     bool plug = plugin->get_plug_visible();
     if (rackbox) {
         rackbox->swtch(plug);
@@ -152,7 +154,9 @@ void PluginUI::deactivate(bool animate) {
     }
     active = false;
     plugin->set_box_visible(false);
-    toolitem->show();
+    if (toolitem) {
+        toolitem->show();
+    }
     hide(animate);
     set_active(false);
 }
@@ -298,6 +302,9 @@ void PluginUI::add_toolitem(Gtk::ToolItemGroup *gw) {
     }
     tb->add(*manage(img));
     tb->show_all();
+    if (active && has_gui()) {
+        tb->hide(); // already in the rack
+    }
     toolitem = tb;
     gw->add(*manage(tb));
     group = gw;
@@ -533,6 +540,7 @@ void PluginDict::remove(PluginUI *p) {
 }
 
 void PluginDict::cleanup() {
+    palette_pending.clear();
     for (std::map<std::string, PluginUI*>::iterator i = begin(); i != end(); ++i) {
         delete i->second;
     }
@@ -658,9 +666,13 @@ void PluginDict::on_plugin_changed(gx_engine::Plugin *pl, gx_engine::PluginChang
         uimanager.get_action_group()->remove(actname);
         machine.remove_rack_unit(pui->get_id(), pui->get_type());
         std::string group_id = pui->get_category();
+        drop_palette_entry(pui);
         remove(pui);
         delete pui;
         Gtk::ToolItemGroup * group = groupmap[group_id];
+        if (group->get_n_items() == 0) {
+            populate_group(group);
+        }
         if (group->get_n_items() == 0) {
             // removal is optional since empty toolitem groups and
             // menus are already hidden.
@@ -676,9 +688,18 @@ void PluginDict::on_plugin_changed(gx_engine::Plugin *pl, gx_engine::PluginChang
         pui->update_rackbox();
         pui->plugin->set_on_off(state);
         if (c == gx_engine::PluginChange::update_category) {
-            pui->group = add_plugin_category(pui->get_category());
-            // if the toolitem group becomes empty, it will be hidden automatically
-            pui->toolitem->reparent(*pui->group);
+            Gtk::ToolItemGroup *old_group = pui->group;
+            if (pui->toolitem) {
+                pui->group = add_plugin_category(pui->get_category());
+                // if the toolitem group becomes empty, it will be hidden automatically
+                pui->toolitem->reparent(*pui->group);
+                if (old_group->get_n_items() == 0) {
+                    populate_group(old_group);
+                }
+            } else {
+                drop_palette_entry(pui);
+                add_palette_entry(pui, add_plugin_category(pui->get_category()));
+            }
             remove_plugin_menu_entry(pui);
             add_plugin_menu_entry(pui);
         }
@@ -715,6 +736,8 @@ Gtk::ToolItemGroup *PluginDict::add_plugin_category(const char *group, bool coll
     Gtk::ToolItemGroup *gw = new Gtk::ToolItemGroup(gettext(group));
     groupmap[group] = gw;
     gw->set_collapsed(collapse);
+    gw->property_collapsed().signal_changed().connect(
+        sigc::bind(sigc::mem_fun(*this, &PluginDict::on_group_collapsed_changed), gw));
     toolpalette.add(*manage(gw));
     toolpalette.set_exclusive(*gw, true);
     toolpalette.set_expand(*gw, true);
@@ -743,11 +766,63 @@ void PluginDict::remove_plugin_menu_entry(PluginUI *pui) {
     }
 }
 
+/*
+** The tool palette entries of a collapsed category are only
+** created when the category is expanded the first time, so the
+** startup cost doesn't grow with the number of installed LADSPA /
+** LV2 plugins. One entry is always created: the palette hides
+** groups without items.
+*/
+void PluginDict::add_palette_entry(PluginUI *pui, Gtk::ToolItemGroup *gw) {
+    pui->group = gw;
+    if (gw->get_collapsed() && gw->get_n_items() > 0) {
+        palette_pending[gw].push_back(pui);
+    } else {
+        pui->add_toolitem(gw);
+    }
+}
+
+void PluginDict::drop_palette_entry(PluginUI *pui) {
+    if (pui->toolitem) {
+        return;
+    }
+    std::map<Gtk::ToolItemGroup*, std::vector<PluginUI*> >::iterator i = palette_pending.find(pui->group);
+    if (i == palette_pending.end()) {
+        return;
+    }
+    std::vector<PluginUI*>::iterator j = std::find(i->second.begin(), i->second.end(), pui);
+    if (j != i->second.end()) {
+        i->second.erase(j);
+    }
+    if (i->second.empty()) {
+        palette_pending.erase(i);
+    }
+}
+
+void PluginDict::populate_group(Gtk::ToolItemGroup *gw) {
+    std::map<Gtk::ToolItemGroup*, std::vector<PluginUI*> >::iterator i = palette_pending.find(gw);
+    if (i == palette_pending.end()) {
+        return;
+    }
+    std::vector<PluginUI*> v;
+    v.swap(i->second);
+    palette_pending.erase(i);
+    for (std::vector<PluginUI*>::iterator p = v.begin(); p != v.end(); ++p) {
+        (*p)->add_toolitem(gw);
+    }
+}
+
+void PluginDict::on_group_collapsed_changed(Gtk::ToolItemGroup *gw) {
+    if (!gw->get_collapsed()) {
+        populate_group(gw);
+    }
+}
+
 void PluginDict::register_plugin(PluginUI *pui) {
     add(pui);
     Gtk::ToolItemGroup *gw = add_plugin_category(pui->get_category());
     Glib::ustring actionname = add_plugin_menu_entry(pui);
-    pui->add_toolitem(gw);
+    add_palette_entry(pui, gw);
     Glib::RefPtr<ToggleAction> act = uimanager.add_toggle_action(
                                          actionname, pui->plugin->get_box_visible());
     pui->set_action(act);
@@ -69,6 +69,7 @@
 #include <lv2/lv2plug.in/ns/ext/buf-size/buf-size.h>
 #include <lv2/lv2plug.in/ns/ext/options/options.h>
 #include <lv2/lv2plug.in/ns/ext/uri-map/uri-map.h>
+#include <lv2/lv2plug.in/ns/ext/worker/worker.h>
 #include <lv2/lv2plug.in/ns/ext/port-props/port-props.h>
 
 #ifndef GUITARIX_AS_PLUGIN
@@ -104,13 +105,19 @@ using namespace std;
 #include "gx_logging.h"
 #include "gx_system.h"
 #include "gx_parameter.h"
+#include "gx_rtmemory.h"
 
 #include "gx_resampler.h"
+#include "gx_fftplan.h"
 #include "gx_convolver.h"
+#include "gx_convtune.h"
 #include "gx_pitch_tracker.h"
 #include "gx_pluginloader.h"
+#include "gx_rttrace.h"
+#include "gx_tempo.h"
 #include "gx_modulesequencer.h"
 #include "gx_json.h"
+#include "gx_dkcircuit.h"
 
 #ifndef GUITARIX_AS_PLUGIN
 #include "gx_jack.h"
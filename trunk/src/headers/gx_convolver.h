@@ -99,6 +99,16 @@ private:
 bool read_audio(const std::string& filename, unsigned int *audio_size, int *audio_chan,
 		int *audio_type, int *audio_form, int *audio_rate, float **buffer);
 
+/*
+** any_count mode: the compute functions accept any sample count
+** without added latency. The first Convproc::MINPART samples of the
+** impulse response (the "head") are convolved directly, the rest is
+** fed to Convproc shifted by the head size, so that the delay needed
+** for collecting the input of Convproc is hidden. Convproc then runs
+** with a quantum of MINPART, i.e. process() is called several times
+** per engine cycle. Only diagonal (inp == out) impulse responses are
+** supported.
+*/
 class GxConvolverBase: protected Convproc {
 protected:
     volatile bool ready;
@@ -108,10 +118,32 @@ protected:
                        unsigned int& size, unsigned int& bufsize);
     unsigned int buffersize;
     unsigned int samplerate;
-    GxConvolverBase(): ready(false), sync(false), buffersize(), samplerate() {}
+    bool any_count;
+    unsigned int part;     // any_count: head size (quantum of Convproc)
+    unsigned int nchan;
+    unsigned int fill;     // any_count: samples in current partition
+    float *head[2];        // any_count: first partition, reversed
+    float *hist[2];        // any_count: input of last 2 partitions
+    int configure_proc(unsigned int ninp, unsigned int nout, unsigned int size,
+                       unsigned int quantum, unsigned int minpart, unsigned int maxpart);
+    int cleanup();
+    int impdata_create(unsigned int inp, unsigned int out, unsigned int step,
+                       float *data, int ind0, int ind1);
+    int impdata_update(unsigned int inp, unsigned int out, unsigned int step,
+                       float *data, int ind0, int ind1);
+    int impdata_copy(unsigned int inp1, unsigned int out1, unsigned int inp2, unsigned int out2);
+#if ZITA_CONVOLVER_VERSION == 4
+    int impdata_clear(unsigned int inp, unsigned int out);
+#endif
+    int process_any(int count, float **input, float **output);
+    GxConvolverBase()
+        : ready(false), sync(false), buffersize(), samplerate(), any_count(false),
+          part(), nchan(), fill(), head(), hist() {}
     ~GxConvolverBase();
 public:
     inline void set_buffersize(unsigned int sz) { buffersize = sz; }
+    inline void set_any_count(bool v) { any_count = v; }
+    inline bool get_any_count() { return any_count; }
     inline unsigned int get_buffersize() { return buffersize; }
     inline void set_samplerate(unsigned int sr) { samplerate = sr; }
     inline unsigned int get_samplerate() { return samplerate; }
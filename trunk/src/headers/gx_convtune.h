@@ -0,0 +1,107 @@
+/*
+ * Copyright (C) 2009, 2010 Hermann Meyer, James Warden, Andreas Degert
+ * Copyright (C) 2011 Pete Shorthose
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ * --------------------------------------------------------------------------
+ */
+
+/* ------- per machine partition layout of the convolvers ------- */
+
+#pragma once
+
+#ifndef SRC_HEADERS_GX_CONVTUNE_H_
+#define SRC_HEADERS_GX_CONVTUNE_H_
+
+namespace gx_engine {
+
+/****************************************************************
+ ** class ConvolverTuner
+ **
+ ** Chooses the largest partition size (maxpart) of Convproc.
+ ** maxpart == minpart is a uniform layout, larger values let
+ ** Convproc double the partition size along the impulse response
+ ** (non-uniform layout); which is cheaper depends on the CPU.
+ **
+ ** get_maxpart() looks up the layout for the channel count, the
+ ** impulse response length (rounded up to a power of 2), quantum
+ ** and minpart in the profile. Unknown layouts get the default
+ ** maxpart of the caller and are queued for the background job,
+ ** which runs Convproc with each candidate maxpart and stores the
+ ** one with the cheapest rt side (see tune()) in the profile file
+ ** (user config directory). The file is only used on the CPU it
+ ** was made on (see cpu_signature()).
+ **
+ ** The profile is plain text so that the convolver copy of the
+ ** LV2 plugins (LV2/DSP/gx_convolver.cc) can read it, keep the
+ ** format in sync with that file:
+ **
+ **   guitarix-convolver-profile 1
+ **   cpu <signature>
+ **   <nchan> <quantum> <minpart> <size> <maxpart>
+ **   ...
+ */
+
+class ConvolverTuner: boost::noncopyable {
+private:
+    struct Layout {
+	unsigned int nchan;
+	unsigned int quantum;
+	unsigned int minpart;
+	unsigned int size;     // power of 2
+	Layout(unsigned int nchan_, unsigned int quantum_, unsigned int minpart_, unsigned int size_)
+	    : nchan(nchan_), quantum(quantum_), minpart(minpart_), size(size_) {}
+	bool operator<(const Layout& l) const;
+	bool operator==(const Layout& l) const { return !(*this < l) && !(l < *this); }
+    };
+    struct Cost {
+	double rt;     // first level, in the caller of process()
+	double total;  // all levels
+	bool late;     // background levels didn't keep up
+    };
+    typedef std::map<Layout, unsigned int> ProfileMap;  // 0: use default
+    boost::mutex mutex;        // profile, pending
+    ProfileMap profile;
+    std::list<Layout> pending;  // to be measured, front is in work
+    std::string profile_file;
+    std::string cpu;
+    bool profile_changed;
+    pthread_t pthr;
+    sem_t sem;
+    volatile int stop;
+    bool thread_started;
+    void load();
+    void save();
+    bool run(Convproc& proc, const Layout& l, unsigned int maxpart, bool paced, Cost& cost);
+    bool benchmark(const Layout& l, unsigned int maxpart, Cost& cost);
+    unsigned int tune(const Layout& l);
+    static void *run_thread(void *p);
+    ConvolverTuner();
+    ~ConvolverTuner();
+public:
+    static ConvolverTuner& getInstance() {
+	static ConvolverTuner instance;
+	return instance;
+    }
+    static std::string cpu_signature();
+    static unsigned int size_class(unsigned int size);
+    void init(const std::string& profile_file_);
+    unsigned int get_maxpart(unsigned int nchan, unsigned int size, unsigned int quantum,
+			     unsigned int minpart, unsigned int maxpart);
+};
+
+} /* end of gx_engine namespace */
+
+#endif  // SRC_HEADERS_GX_CONVTUNE_H_
@@ -0,0 +1,335 @@
+/*
+ * Copyright (C) 2009, 2010 Hermann Meyer, James Warden, Andreas Degert
+ * Copyright (C) 2011 Pete Shorthose
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ * --------------------------------------------------------------------------
+ */
+
+/* ------- runtime DK-method circuit simulation ------- */
+
+#pragma once
+
+#ifndef SRC_HEADERS_GX_DKCIRCUIT_H_
+#define SRC_HEADERS_GX_DKCIRCUIT_H_
+
+namespace gx_engine {
+
+/****************************************************************
+ ** DK-method kernels
+ **
+ ** Shared by all circuits. Matrices are stored column-major, so
+ ** that the inner loops run over the rows of one column and are
+ ** vectorized. A template dimension of 0 means "use the runtime
+ ** dimension"; with a fixed dimension the compiler unrolls the
+ ** loops for the specialized kernels of hot models.
+ */
+
+// out = m * v (m: rows x cols)
+template <int R, int C>
+static inline void dk_matvec(int rows, int cols, const double *__restrict m,
+			     const double *__restrict v, double *__restrict out) {
+    const int nr = R ? R : rows;
+    const int nc = C ? C : cols;
+    for (int i = 0; i < nr; i++) {
+	out[i] = 0;
+    }
+    for (int j = 0; j < nc; j++) {
+	const double s = v[j];
+	const double *col = m + j * nr;
+	for (int i = 0; i < nr; i++) {
+	    out[i] += col[i] * s;
+	}
+    }
+}
+
+// solve a * x = b in place (a: n x n, destroyed; b: becomes x);
+// gaussian elimination with partial pivoting, false if singular
+template <int N>
+static inline bool dk_solve(int n, double *a, double *b) {
+    const int nn = N ? N : n;
+    for (int k = 0; k < nn; k++) {
+	int p = k;
+	for (int i = k+1; i < nn; i++) {
+	    if (fabs(a[k*nn+i]) > fabs(a[k*nn+p])) {
+		p = i;
+	    }
+	}
+	if (a[k*nn+p] == 0) {
+	    return false;
+	}
+	if (p != k) {
+	    for (int j = k; j < nn; j++) {
+		std::swap(a[j*nn+k], a[j*nn+p]);
+	    }
+	    std::swap(b[k], b[p]);
+	}
+	const double d = 1.0 / a[k*nn+k];
+	for (int i = k+1; i < nn; i++) {
+	    const double f = a[k*nn+i] * d;
+	    for (int j = k+1; j < nn; j++) {
+		a[j*nn+i] -= f * a[j*nn+k];
+	    }
+	    b[i] -= f * b[k];
+	}
+    }
+    for (int k = nn-1; k >= 0; k--) {
+	double s = b[k];
+	for (int j = k+1; j < nn; j++) {
+	    s -= a[j*nn+k] * b[j];
+	}
+	b[k] = s / a[k*nn+k];
+    }
+    return true;
+}
+
+/****************************************************************
+ ** B-spline basis (de Boor / Cox recursion, like fpbspl of
+ ** FITPACK) with derivative
+ **
+ ** t: knots, n: number of coefficients, k: order (degree+1,
+ ** k <= DKSpline::max_order). x must be inside [t[k-1], t[n]].
+ ** h[j], dh[j] are value and derivative of the basis function of
+ ** coefficient l-k+1+j, l (the knot interval) is returned.
+ */
+
+static inline int dk_bspline_basis(const double *t, int n, int k, double x,
+				   double *h, double *dh) {
+    int lo = k - 1;
+    int hi = n - 1;
+    while (lo < hi) {  // last l with t[l] <= x, at most n-1
+	int m = (lo + hi + 1) >> 1;
+	if (t[m] <= x) {
+	    lo = m;
+	} else {
+	    hi = m - 1;
+	}
+    }
+    const int l = lo;
+    double hh[8];
+    h[0] = 1;
+    for (int j = 1; j < k; j++) {
+	if (j == k - 1) {
+	    // h holds the basis of degree k-2: derivative of degree k-1
+	    for (int i = 0; i < k; i++) {
+		double d = 0;
+		if (i >= 1) {
+		    double w = t[l+i] - t[l+i-j];
+		    if (w != 0) {
+			d += h[i-1] / w;
+		    }
+		}
+		if (i < j) {
+		    double w = t[l+i+1] - t[l+i+1-j];
+		    if (w != 0) {
+			d -= h[i] / w;
+		    }
+		}
+		dh[i] = j * d;
+	    }
+	}
+	for (int i = 0; i < j; i++) {
+	    hh[i] = h[i];
+	}
+	h[0] = 0;
+	for (int i = 1; i <= j; i++) {
+	    const double li = t[l+i];
+	    const double lj = t[l+i-j];
+	    const double f = (li != lj) ? hh[i-1] / (li - lj) : 0;
+	    h[i-1] += f * (li - x);
+	    h[i] = f * (x - lj);
+	}
+    }
+    if (k == 1) {
+	dh[0] = 0;
+    }
+    return l;
+}
+
+/****************************************************************
+ ** struct DKSpline
+ **
+ ** nonlinear function i[out] = f(v[inp[0]] (, v[inp[1]])) of the
+ ** circuit as tensor product B-spline (scipy splrep / bisplrep
+ ** representation: knots, coefficients row-major n0 x n1).
+ ** Outside of the knot range the spline is continued linearly.
+ */
+
+struct DKSpline {
+    enum { max_order = 6 };
+    int ninp;
+    int inp[2];
+    int out;
+    int k[2];          // order (degree + 1)
+    int n[2];          // number of coefficients
+    std::vector<double> t[2];
+    std::vector<double> c;
+    DKSpline(): ninp(0), inp(), out(0), k(), n(), t(), c() {}
+    // value at v, df/dv[inp[j]] in grad[j]
+    inline double eval(const double *v, double *grad) const;
+    void readJSON(gx_system::JsonParser& jp);
+    bool check(int nn) const;
+};
+
+inline double DKSpline::eval(const double *v, double *grad) const {
+    double h[2][max_order], dh[2][max_order], x[2], dx[2];
+    int l[2];
+    for (int d = 0; d < ninp; d++) {
+	const double *td = &t[d][0];
+	const double lo = td[k[d]-1];
+	const double hi = td[n[d]];
+	double xv = v[inp[d]];
+	x[d] = xv < lo ? lo : (xv > hi ? hi : xv);
+	dx[d] = xv - x[d];
+	l[d] = dk_bspline_basis(td, n[d], k[d], x[d], h[d], dh[d]) - k[d] + 1;
+    }
+    if (ninp == 1) {
+	const double *cc = &c[l[0]];
+	double s = 0, ds = 0;
+	for (int i = 0; i < k[0]; i++) {
+	    s += cc[i] * h[0][i];
+	    ds += cc[i] * dh[0][i];
+	}
+	grad[0] = ds;
+	return s + ds * dx[0];
+    }
+    double s = 0, ds0 = 0, ds1 = 0;
+    for (int i = 0; i < k[0]; i++) {
+	const double *cc = &c[(l[0]+i)*n[1]+l[1]];
+	double r = 0, dr = 0;
+	for (int j = 0; j < k[1]; j++) {
+	    r += cc[j] * h[1][j];
+	    dr += cc[j] * dh[1][j];
+	}
+	s += h[0][i] * r;
+	ds0 += dh[0][i] * r;
+	ds1 += h[0][i] * dr;
+    }
+    grad[0] = ds0;
+    grad[1] = ds1;
+    return s + ds0 * dx[0] + ds1 * dx[1];
+}
+
+/****************************************************************
+ ** class DKCircuitDesc
+ **
+ ** compiled circuit description, read from a JSON file written
+ ** by tools/ampsim/DK/dk_runtime.py. The equations per sample
+ ** (z = [x; u; 1; i], nz = nx+ni+1+nn):
+ **
+ **   p  = Mpk[:, 0:nx+ni+1] * z               (input of the nonlinearity)
+ **   K  = Mpk[:, nx+ni+1:nz]
+ **   solve p + K * i(v) - CZ .* v = 0 for v   (Newton iteration)
+ **   o  = Mo * z                              (output)
+ **   x' = Mx * z                              (next state)
+ **
+ ** The variable resistors of the potentiometers change the
+ ** matrices with the Woodbury identity:
+ ** T = (Q + diag(R_j * taper_j(pot value)))^-1 * UR, then
+ ** Mx - Uxl * T, Mo - Uo * T, Mpk - Unl * T.
+ */
+
+struct DKPot {       // user parameter
+    std::string id;
+    std::string name;
+    float value;     // default
+    DKPot(): id(), name(), value(0.5) {}
+};
+
+struct DKResistor {  // variable resistor controlled by a pot
+    int pot;
+    double R;        // nominal resistance
+    std::vector<double> taper;  // factor at equidistant pot values 0..1
+    DKResistor(): pot(-1), R(0), taper() {}
+    inline double value(double a) const;
+};
+
+inline double DKResistor::value(double a) const {
+    const int n = taper.size() - 1;
+    double f = a * n;
+    int i = static_cast<int>(f);
+    i = i < 0 ? 0 : (i >= n ? n - 1 : i);
+    f -= i;
+    return R * (taper[i] + f * (taper[i+1] - taper[i]));
+}
+
+class DKCircuitDesc {
+public:
+    std::string id;
+    std::string name;
+    std::string category;
+    std::string description;
+    std::string shortname;
+    int samplerate;
+    int nx, ni, no, nn;
+    int maxiter;       // Newton iterations per sample
+    double tol;        // convergence: max |dv|
+    std::vector<double> Mx, Mo, Mpk;  // column-major, nz columns
+    std::vector<double> CZ, x0, v0;
+    std::vector<DKSpline> nonlin;
+    std::vector<DKPot> pots;
+    std::vector<DKResistor> resistors;
+    std::vector<double> Q, Uxl, Uo, Unl, UR;  // Woodbury update
+private:
+    std::map<std::string, std::pair<int, int> > shape;  // of the matrices read
+    void read_matrix(gx_system::JsonParser& jp, const std::string& key, std::vector<double>& m);
+    bool check_shape(const std::string& key, const std::vector<double>& m, int rows, int cols);
+public:
+    DKCircuitDesc();
+    int nz() const { return nx + ni + 1 + nn; }
+    void readJSON(gx_system::JsonParser& jp);
+    bool check();
+    static DKCircuitDesc *load(const std::string& fname);
+};
+
+/****************************************************************
+ ** class DKCircuit
+ **
+ ** mono plugin running a DKCircuitDesc (ni == no == 1), at the
+ ** samplerate of the description (resampled if needed)
+ */
+
+class DKCircuit: public PluginDef {
+public:
+    typedef void (*kernel)(DKCircuit& self, int count, float *buf);
+private:
+    DKCircuitDesc *desc;
+    std::vector<std::string> param_ids;
+    std::vector<float> pots;
+    std::vector<float> pots_last;
+    std::vector<double> mx, mo, mpk;  // matrices for current pot values
+    std::vector<double> z, xn, v, p, r, df, jac, tmp;
+    kernel process_kernel;
+    int failed;                       // samples without convergence
+    bool resamp;
+    gx_resample::FixedRateResampler smp;
+    template <int NX, int NN> static void process_block(DKCircuit& self, int count, float *buf);
+    template <int NX, int NN> inline bool solve();
+    void update_matrices();
+    void reset();
+    static void init(unsigned int samplingFreq, PluginDef *plugin);
+    static void process(int count, float *input, float *output, PluginDef *plugin);
+    static int registerparam(const ParamReg& reg);
+    static int uiloader(const UiBuilder& builder, int form);
+    static void del_instance(PluginDef *plugin);
+    explicit DKCircuit(DKCircuitDesc *desc_);
+public:
+    ~DKCircuit();
+    static DKCircuit *create(const std::string& fname);
+};
+
+} /* end of gx_engine namespace */
+
+#endif  // SRC_HEADERS_GX_DKCIRCUIT_H_
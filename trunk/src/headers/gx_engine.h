@@ -31,20 +31,36 @@ namespace gx_engine {
 
 /****************************************************************
  ** class ModuleSelectorFromList
+ **
+ ** The selector is the audio module in the chain and calls the
+ ** selected alternative module. All alternatives are kept
+ ** initialized, changing the selection does not rebuild the
+ ** chain: the rt thread crossfades from the old to the new module.
  */
 
 class ModuleSelectorFromList: public ModuleSelector, private PluginDef {
 private:
+    enum { xfade_chunk = 128 };
     int selector;
     const char* select_id;
     const char* select_name;
-    Plugin* current_plugin;
-    PluginDef **modules;
+    PluginDef **modules;    // only used for id and name
+    PluginDef **instances;  // the modules in the plugin list
     unsigned int size;
     value_pair *values;
+    bool activated;
+    int active;             // RT
+    int fade_from;          // RT
+    int fade_pos;           // RT
+    int fade_len;
+    float xfade_buf[xfade_chunk];  // RT
 
     static int static_register(const ParamReg& reg);
     int register_parameter(const ParamReg& reg);
+    static void init(unsigned int samplingFreq, PluginDef *plugin);
+    static int activate(bool start, PluginDef *plugin);
+    static void process(int count, float *input, float *output, PluginDef *plugin);
+    inline void process_fade(int count, float *input, float *output);
 public:
     Plugin plugin;
     ModuleSelectorFromList(
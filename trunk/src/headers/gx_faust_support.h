@@ -1,6 +1,7 @@
 #include <cmath>
 #include <algorithm>
 #include "gx_resampler.h"
+#include "gx_nltable.h"
 
 using std::signbit;
 
@@ -0,0 +1,106 @@
+/*
+ * Copyright (C) 2009, 2010 Hermann Meyer, James Warden, Andreas Degert
+ * Copyright (C) 2011 Pete Shorthose
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ * --------------------------------------------------------------------------
+ */
+
+/* ------- shared FFTW plans and persistent wisdom ------- */
+
+#pragma once
+
+#ifndef SRC_HEADERS_GX_FFTPLAN_H_
+#define SRC_HEADERS_GX_FFTPLAN_H_
+
+#include <fftw3.h>
+
+namespace gx_engine {
+
+/****************************************************************
+ ** class FFTPlanner
+ **
+ ** Process wide service for the FFTW plans of the engine (the
+ ** FFTW planner itself is global and not thread-safe, so all
+ ** planner calls of the engine go through the mutex of this class;
+ ** init() also makes the planner thread-safe for plugins loaded
+ ** into the process, which don't know that mutex).
+ **
+ ** plan() returns a shared plan for a problem (kind, size, in-place
+ ** and array alignment), to be executed with the new-array
+ ** interface (fftwf_execute_dft_r2c() etc.). It never measures:
+ ** the plan is made from the wisdom (FFTW_WISDOM_ONLY), or else
+ ** with FFTW_ESTIMATE, and the problem is queued for the background
+ ** job, which measures it (FFTW_MEASURE) and saves the wisdom in
+ ** the user config directory. Later calls of plan() get the
+ ** measured plan. So the measuring is done once per machine and
+ ** plan creation is only a wisdom lookup afterwards.
+ **
+ ** plan() and release() must not be called from the rt thread
+ ** (they lock the planner mutex, which is held while the job
+ ** measures a plan). Module buffersize_change handlers are safe:
+ ** GxJack runs them in the main loop, not in the jack callback.
+ */
+
+class FFTPlanner: boost::noncopyable {
+public:
+    enum Kind { r2c, c2r, r2hc, hc2r };
+private:
+    struct Problem {
+	int kind;
+	int n;
+	int ialign;  // fftwf_alignment_of() of the arrays
+	int oalign;
+	bool inplace;
+	Problem(Kind kind_, int n_, const void *in, const void *out);
+	bool operator<(const Problem& p) const;
+	bool operator==(const Problem& p) const { return !(*this < p) && !(p < *this); }
+    };
+    typedef std::map<Problem, fftwf_plan> PlanMap;
+    typedef std::map<fftwf_plan, std::pair<Problem, int> > RefMap;
+    boost::mutex mutex;        // fftw planner, cache and queue
+    PlanMap cache;             // current plan of a problem
+    RefMap refs;               // problem and users of a plan
+    std::list<Problem> pending;     // to be measured
+    std::set<Problem> measured;     // measured by the job (this process)
+    std::string wisdom_file;
+    bool wisdom_changed;
+    volatile int conv_measured;  // zita-convolver sizes are in the wisdom
+    pthread_t pthr;
+    sem_t sem;
+    volatile int stop;
+    bool thread_started;
+    fftwf_plan make_plan(const Problem& p, unsigned int flags);
+    void measure(const Problem& p);
+    void save_wisdom();
+    static void *run_thread(void *p);
+    FFTPlanner();
+    ~FFTPlanner();
+public:
+    static FFTPlanner& getInstance() {
+	static FFTPlanner instance;
+	return instance;
+    }
+    void init(const std::string& wisdom_file_);
+    fftwf_plan plan(Kind kind, int n, void *in, void *out);
+    void release(fftwf_plan p);
+    // for code calling the fftw planner directly (zita-convolver)
+    boost::mutex& get_planner_mutex() { return mutex; }
+    bool convolver_measured() { return gx_system::atomic_get(conv_measured); }
+};
+
+} /* end of gx_engine namespace */
+
+#endif  // SRC_HEADERS_GX_FFTPLAN_H_
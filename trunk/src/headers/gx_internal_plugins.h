@@ -143,15 +143,32 @@ public:
 
 /****************************************************************
  ** class OscilloscopeAdapter
+ **
+ ** The rt thread triggers on the signal (edge and level), decimates
+ ** the captured window to min/max pairs for the requested number of
+ ** columns and hands the complete frame over lock-free (3 frames:
+ ** one written by the rt thread, one last complete, one read by the
+ ** UI thread). update() fetches the newest frame into buffer, so
+ ** clients (waveview, remote) always get 2 * width values, whatever
+ ** the length of the window.
  */
 
 class OscilloscopeInfo {
 private:
+    enum { frame_new = 4 };
     gx_jack::GxJack *jack;
     sigc::signal<void(unsigned int, float*)> size_change;
-    float *buffer;
+    float *buffer;                 // UI; newest frame
     unsigned int buffer_size;
+    float *frame[3];               // local engine only
+    unsigned int frame_size[3];
+    volatile int ready;            // last complete frame | frame_new
+    int back;                      // RT; frame being written
+    int front;                     // UI; frame last fetched
     friend class OscilloscopeAdapter;
+    void alloc_frames(unsigned int size);
+    void publish();                // RT
+    bool fetch();                  // UI
 public:
     int load;
     int frames;
@@ -161,7 +178,9 @@ public:
  public:
     OscilloscopeInfo():
         jack(nullptr), size_change(), buffer(nullptr), buffer_size(0),
+        frame(), frame_size(), ready(1), back(0), front(2),
         load(0), frames(0), is_rt(false), bsize(0) {}
+    ~OscilloscopeInfo();
     void readJSON(gx_system::JsonParser& jp);
     void writeJSON(gx_system::JsonWriter& w) const;
     void update();
@@ -199,18 +218,33 @@ typedef ParameterV<OscilloscopeInfo> OscParameter;
 class OscilloscopeAdapter: PluginDef {
 public:
     OscilloscopeInfo info;
+    enum { trig_free, trig_rising, trig_falling };
+    enum { min_width = 32, max_width = 1024 };
 private:
     ParamMap &pmap;
     static void fill_buffer(int count, float *input0, float *output0, PluginDef*);
     static int osc_register(const ParamReg& reg);
     static int osc_load_ui(const UiBuilder& builder, int format);
     void change_buffersize(unsigned int);
+    inline void capture(int count, const float *buf);
     int mul_buffer;
+    volatile int window;  // samples per frame
+    int trigger;          // parameter values
+    float level;
+    int width;
+    // rt state
+    bool capturing;
+    int pos;              // samples since trigger (capturing) or since armed
+    int win;              // window and width of the current frame
+    int cols;
+    int col;              // current column, first sample of the next one
+    int next;
+    float cmin;           // range of the current column
+    float cmax;
+    float last;           // previous sample
 public:
     Plugin plugin;
     void clear_buffer();
-    unsigned int get_size() const { return info.buffer_size; }
-    inline float *get_buffer() const { return info.buffer; }
     int get_mul_buffer() { return mul_buffer; }
     void set_mul_buffer(int a, unsigned int b) { mul_buffer = a; change_buffersize(b); }
     OscilloscopeAdapter(ModuleSequencer& engine);
@@ -694,6 +728,11 @@ private:
     
     static const char* lv2_urid_unmap(LV2_URID_Unmap_Handle, const LV2_URID urid);
     static LV2_Feature gx_urid_unmap_feature;
+
+    // the engine runs plugins with its (fixed) jack period size,
+    // see Lv2Dsp::make_options
+    static LV2_Feature gx_bounded_block_feature;
+    static LV2_Feature gx_fixed_block_feature;
     LV2Features() {};
 
 public:
@@ -703,6 +742,7 @@ public:
             return instance;
         }
     static LV2_Feature* gx_features[];
+    static const char* gx_instance_features[]; // provided per plugin instance
     static LV2_URID_Map gx_urid_map;
     static LV2_URID_Unmap gx_urid_unmap;
 
@@ -766,6 +806,7 @@ public:
     typedef std::vector<plugdesc*> pluginarray;
 private:
     const gx_system::CmdlineOptions& options;
+    EngineControl& engine;
     pluginarray plugins;
     LilvWorld* world;
     ParamMap& param;
@@ -775,11 +816,15 @@ private:
     LilvNode* lv2_InputPort;
     LilvNode* lv2_OutputPort;
     LilvNode* lv2_AtomPort;
+    static LilvWorld* shared_world;
+    static int world_refcount;
+    static LilvWorld* acquire_world();
+    static void release_world();
 private:
     void read_module_config(const std::string& filename, plugdesc *p);
     void read_module_list(pluginarray& p);
 public:
-    LadspaLoader(const gx_system::CmdlineOptions& options, ParamMap& param);
+    LadspaLoader(const gx_system::CmdlineOptions& options, EngineControl& engine, ParamMap& param);
     ~LadspaLoader();
     bool load(pluginarray& p);
     unsigned int size() { return plugins.size(); }
@@ -1088,18 +1133,16 @@ public:
 #include "drumseq.h"
 #endif
 
-class Drumout {
+class Drumout: public PluginDef {
 private:
-    static float* set;
-    static bool mb;
-    static float* data;
-    static Plugin input_drum;
+    float* set;
+    bool mb;
+    float* data;
+    Plugin *input_drum;
     static void outputdrum_compute(int count, float *input0, float *input1, float *output0, float *output1, PluginDef*);
 public:
-    static void set_plugin(Plugin p);
-    static void set_data(float* mode, bool ready, float* buf);
-    static Plugin output_drum;
-    static PluginDef outputdrum;
+    void set_plugin(Plugin *p);
+    void set_data(float* mode, bool ready, float* buf);
     Drumout();
 };
 
@@ -1115,6 +1158,7 @@ private:
     drumseq::Dsp drums;
 
     int 	counter;
+    int 	sync_step;  // step in beat when following the engine tempo
     int 	seq_size;
     int 	bsize;
     FAUSTFLOAT 	step;
@@ -1137,6 +1181,7 @@ private:
     std::vector<int> Vechat;
 
     EngineControl&  engine;
+    Drumout        *drumout;
     bool            mem_allocated;
     sigc::slot<void> sync;
     volatile bool ready;
@@ -1176,7 +1221,7 @@ private:
     static int drum_load_ui(const UiBuilder& builder, int format);
 public:
     Plugin plugin;
-    DrumSequencer(EngineControl& engine, sigc::slot<void> sync);
+    DrumSequencer(EngineControl& engine, sigc::slot<void> sync, Drumout *drumout);
     ~DrumSequencer();
 };
 
@@ -1242,14 +1287,14 @@ private:
     int aio;
     int ii;
 	long  gRover ;
-	double magn, phase, tmp, real, imag;
 	double freqPerBin, freqPerBin1, freqPerBin2, expct;
     double fftFrameSize3;
     double fftFrameSize4;
     double osamp1,osamp2;
-	long   i,k, qpd, index, inFifoLatency, stepSize, fftFrameSize2;
+	long   i,k, inFifoLatency, stepSize, fftFrameSize2;
 	
-    fftwf_complex fftw_in[MAX_FRAME_LENGTH], fftw_out[MAX_FRAME_LENGTH];
+    float fftw_real[MAX_FRAME_LENGTH];
+    fftwf_complex fftw_cplx[MAX_FRAME_LENGTH/2+1];
     fftwf_plan ftPlanForward, ftPlanInverse;
     
     inline int load_ui_f(const UiBuilder& b, int form);
@@ -1261,6 +1306,7 @@ private:
     void clear_state();
 	int activate(bool start);
 	bool setParameters( int sampleRate);
+	void process_frame(float pitchShift);
 	void PitchShift(int count, float *indata, float *outdata);
     void change_buffersize(unsigned int size);
     static int  activate_static(bool start, PluginDef*);
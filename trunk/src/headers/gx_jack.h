@@ -144,6 +144,35 @@ inline void MidiCC::fill(unsigned char *midi_send, int i) {
     send_cc[i].store(false, std::memory_order_release);
 }
 
+/****************************************************************
+ ** class PageFaultCount
+ **
+ ** page faults of a jack process thread: update() is called at
+ ** the end of each period in the rt thread, fetch() collects (and
+ ** resets) the counts in the ui thread
+ */
+
+class PageFaultCount {
+private:
+    pthread_t thread;
+    long last_minor;
+    long last_major;
+    volatile int minor;
+    volatile int major;
+    volatile int periods;     // periods with page faults
+    volatile int max_faults;  // max. faults in one period
+    volatile int pending;     // notification sent, not yet fetched
+    int last_dminor;          // faults in the last period (rt thread)
+    int last_dmajor;
+public:
+    PageFaultCount();
+    bool update();
+    int get_last_minor() const { return last_dminor; }
+    int get_last_major() const { return last_dmajor; }
+    void fetch(int& minor_, int& major_, int& periods_, int& max_faults_);
+    void clear_pending() { gx_system::atomic_set(&pending, 0); }
+};
+
 class GxJack: public sigc::trackable {
  private:
     gx_engine::GxEngine& engine;
@@ -174,6 +203,7 @@ class GxJack: public sigc::trackable {
 #endif
     void                cleanup_slot(bool otherthread);
     void                fetch_connection_data();
+    void                buffersize_reconfig();
     PortConnRing        connection_queue;
     sigc::signal<void,string,string,bool> connection_changed;
     Glib::Dispatcher    buffersize_change;
@@ -189,6 +219,14 @@ class GxJack: public sigc::trackable {
     bool                xrun_msg_blocked;
     void report_xrun_clear();
     void report_xrun();
+    PageFaultCount      pagefaults;
+    PageFaultCount      pagefaults_insert;
+    Glib::Dispatcher    pagefault;
+    void report_pagefault_clear();
+    void report_pagefault();
+    volatile unsigned int rt_watchdog_counter; // rt cycles since rt_watchdog_seen
+    volatile unsigned int rt_watchdog_seen;    // last watchdog tick
+    inline bool         rt_watchdog_check_alive(unsigned int bs, unsigned int sr);
     void write_jack_port_connections(
 	gx_system::JsonWriter& w, const char *key, const PortConnection& pc, bool replace=false);
     std::string make_clientvar(const std::string& s);
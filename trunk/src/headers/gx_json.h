@@ -213,6 +213,27 @@ public:
 };
 
 
+/****************************************************************
+ ** class JsonAttachment
+ ** bulk data (audio samples) sent as binary frame in front of the
+ ** JSON-RPC message it belongs to, instead of an array of JSON
+ ** numbers. A frame is a 0 byte (which never starts a JSON message),
+ ** the payload length as 32 bit little endian value and the payload
+ ** (little endian float, optionally deflated). The message itself
+ ** only carries the metadata.
+ */
+
+class JsonAttachment {
+public:
+    enum { accept_f32 = 0x01, accept_deflate = 0x02 };  // client capabilities
+    enum { enc_f32 = 0, enc_f32_deflate = 1 };
+    enum { frame_marker = 0, header_size = 5 };
+    static std::string make_frame(const float *data, unsigned int count, int accept, JsonWriter& jw);
+    static unsigned int payload_length(const std::string& header);
+    static float *read(JsonParser& jp, const std::string& payload, unsigned int *count);
+};
+
+
 /****************************************************************
  ** Setting file handling
  ** class SettingsFileHeader, class StateFile, class PresetFile,
@@ -252,22 +273,118 @@ public:
     void read_major_minor(JsonParser& jp);
 };
 
+class AbstractStateIO;
+
+/****************************************************************
+ ** class StateJournal
+ **
+ ** Incremental saving of the state file. save() serializes the state
+ ** in memory and compares it with the last save, per parameter and
+ ** per section (midi controller, jack connections, ...). Only the
+ ** differences are handed to a background thread, which appends them
+ ** to the journal (<statefile>_journal, one json array per line) and
+ ** from time to time compacts state file and journal into a new state
+ ** file. flush() waits for the thread and compacts, so that the state
+ ** file is complete afterwards.
+ **
+ ** The writing instance holds an exclusive flock() on the journal.
+ ** A journal left over from a crash (not locked) is applied and
+ ** compacted when the file is loaded for writing; a locked journal
+ ** belongs to a running instance and is left alone. Read-only users
+ ** (LADSPA plugin) never write or recover, read() gives them the
+ ** state file with the journal applied in memory. All changes go
+ ** through the journal before they are compacted, so replaying a
+ ** journal which is already in the state file (crash between rename
+ ** and unlink) changes nothing.
+ */
+
+class StateJournal: boost::noncopyable {
+private:
+    struct Entry {
+	char kind;            // 's': section, 'p': parameter, 'd': parameter removed
+	std::string key;
+	std::string value;
+	Entry(char kind_, const std::string& key_, const std::string& value_)
+	    : kind(kind_), key(key_), value(value_) {}
+    };
+    struct State {
+	std::vector<std::string> order;               // sections in file order
+	std::map<std::string, std::string> sections;  // json text
+	std::map<std::string, std::string> settings;  // json text per parameter id
+	void clear() { order.clear(); sections.clear(); settings.clear(); }
+	void read(JsonParser& jp);
+	void write(JsonWriter& jw) const;
+	void apply(const Entry& e);
+    };
+    struct Request {
+	std::string filename;
+	bool full;            // complete state (replaces all parameters)
+	bool preserve_preset; // keep current_preset of the file
+	std::vector<Entry> entries;
+    };
+    enum { max_records = 1000 };  // journal length that triggers compaction
+    // main thread
+    std::string filename;
+    State saved;                  // last state handed to the writer
+    bool full;
+    // writer
+    boost::mutex queue_mutex;
+    std::list<Request*> queue;
+    boost::mutex mutex;           // held while writing
+    State disk;                   // content of state file and journal
+    std::string disk_file;        // file of disk, empty: not loaded
+    bool dirty;                   // disk differs from the state file
+    int records;                  // records in the journal file
+    int fd;                       // journal, open for appending and locked
+    bool read_only;
+    pthread_t pthr;
+    sem_t sem;
+    volatile int stop;
+    bool thread_started;
+    static int lock_journal(const std::string& fn, int flags);
+    static bool read_file(const std::string& fn, State& st);
+    static int replay(istream& js, State& st);
+    void load(const std::string& fn);
+    void apply(const Request& r, std::vector<Entry>& changes);
+    bool append(const std::vector<Entry>& entries);
+    void compact();
+    void process_queue();
+    static void *run_thread(void *p);
+public:
+    StateJournal();
+    ~StateJournal();
+    void set_filename(const string& fn);
+    void set_read_only(bool v) { read_only = v; }
+    void save(AbstractStateIO& io, bool preserve_preset);
+    void flush();
+    void reset();
+    static std::string journal_name(const std::string& fn) { return fn + "_journal"; }
+    static bool read(const std::string& fn, std::string& text);
+};
+
 class StateFile {
 private:
     string filename;
     istream *is;
     time_t mtime;
+    off_t journal_size;    // -1: no journal
+    bool read_only;
     SettingsFileHeader header;
+    StateJournal journal;
     void open();
 public:
     StateFile()
-	: filename(), is(0), mtime(), header() {}
+	: filename(), is(0), mtime(), journal_size(-1), read_only(false), header(), journal() {}
     ~StateFile() { delete is; }
     void set_filename(const string& fn);
+    // only read, never write or recover the journal
+    void set_read_only(bool v) { read_only = v; journal.set_read_only(v); }
     const SettingsFileHeader& get_header() const { return header; }
     string get_filename() const { return filename; }
     JsonParser *create_reader();
     JsonWriter *create_writer(bool *preserve_preset);
+    void save(AbstractStateIO& io, bool preserve_preset);
+    void flush() { journal.flush(); }
     void ensure_is_current();
 };
 
@@ -412,6 +529,75 @@ public:
     virtual void copy_preset(JsonParser&,const SettingsFileHeader&,JsonWriter&) = 0;
 };
 
+/****************************************************************
+ ** class PresetIndex
+ **
+ ** Searchable index of the presets of all banks: name, used plugins
+ ** (on_off set), IR files and the string valued parameters (amp /
+ ** tube / cabinet selection etc.) of each preset. A background
+ ** thread parses the bank files whose mtime changed and saves the
+ ** index, so a restart only parses the files changed in between.
+ ** update() and search() are called by the main thread.
+ */
+
+class PresetQuery {
+public:
+    Glib::ustring name;     // substring of the preset name
+    std::string plugin;     // plugin id, e.g. "jconv"
+    Glib::ustring irfile;   // substring of an IR file name
+    std::string param;      // parameter id, e.g. "cab.select"
+    Glib::ustring value;    // substring of its value
+    PresetQuery(): name(), plugin(), irfile(), param(), value() {}
+};
+
+class PresetMatch {
+public:
+    Glib::ustring bank;
+    Glib::ustring name;
+    PresetMatch(const Glib::ustring& bank_, const Glib::ustring& name_): bank(bank_), name(name_) {}
+};
+
+class PresetIndex: boost::noncopyable {
+public:
+    typedef std::vector<std::pair<std::string, Glib::ustring> > FileList;  // filename, bank
+private:
+    struct Preset {
+	Glib::ustring name;
+	std::vector<std::string> plugins;
+	std::vector<Glib::ustring> irfiles;
+	std::map<std::string, Glib::ustring> params;
+	void readJSON(JsonParser& jp);
+	void writeJSON(JsonWriter& jw) const;
+	void read_engine(JsonParser& jp);
+    };
+    struct Bank {
+	time_t mtime;
+	std::vector<Preset> presets;
+	Bank(): mtime(), presets() {}
+    };
+    typedef std::map<std::string, Bank> BankMap;  // key: filename
+    std::string index_file;
+    boost::mutex mutex;   // banks, files
+    BankMap banks;
+    FileList files;       // banks to index, in bank list order
+    bool loaded;          // thread: index file has been read
+    pthread_t pthr;
+    sem_t sem;
+    volatile int stop;
+    bool thread_started;
+    static bool parse_bank(const std::string& fname, Bank& b);
+    void load();
+    void save();
+    void run();
+    static void *run_thread(void *p);
+public:
+    PresetIndex();
+    ~PresetIndex();
+    void set_filename(const std::string& fn) { index_file = fn; }
+    void update(const FileList& l);
+    void search(const PresetQuery& q, std::vector<PresetMatch>& result);
+};
+
 class PresetBanks {
 private:
     typedef std::list<PresetFile*> bl_type;
@@ -419,6 +605,7 @@ private:
     std::string filepath;
     time_t mtime;
     std::string preset_dir;
+    PresetIndex index;
     void parse_factory_list(const std::string& path);
     void parse_bank_list(bl_type::iterator pos);
     void collect_lost_banks(const char* scratchpad_name, const char* scratchpad_file);
@@ -458,6 +645,9 @@ public:
     static std::string add_preset_postfix(const std::string& filename);
     static bool strip_preset_postfix(std::string& name);
     void make_bank_unique(Glib::ustring& name, std::string *file = 0);
+    void start_index(const std::string& index_file);
+    void update_index();
+    void search(const PresetQuery& q, std::vector<PresetMatch>& result);
 };
 
 class GxSettingsBase {
@@ -487,6 +677,7 @@ public:
     const Glib::ustring& get_current_name() { return current_name; }
     void set_statefilename(const std::string& fn) { statefile.set_filename(fn); }
     void save_to_state(bool preserve_preset=false);
+    void flush_state() { statefile.flush(); }
     void set_source_to_state();
     void erase_preset(const Glib::ustring& name);
     bool setting_is_preset() { return !current_bank.empty(); }
@@ -504,6 +504,7 @@ private:
     RackContainer monorackcontainer;
     RackContainer stereorackcontainer;
     std::map<Glib::ustring, Gtk::ToolItemGroup*> groupmap;
+    std::map<Gtk::ToolItemGroup*, std::vector<PluginUI*> > palette_pending; ///< entries of collapsed groups
     std::vector<std::string> monotargets;
     std::vector<std::string> stereotargets;
     gx_gui::StackBoxBuilder& boxbuilder;
@@ -522,6 +523,10 @@ private:
     Glib::ustring add_plugin_menu_entry(PluginUI *pui);
     void remove_plugin_menu_entry(PluginUI *pui);
     void register_plugin(PluginUI *pui);
+    void add_palette_entry(PluginUI *pui, Gtk::ToolItemGroup *gw);
+    void drop_palette_entry(PluginUI *pui);
+    void populate_group(Gtk::ToolItemGroup *gw);
+    void on_group_collapsed_changed(Gtk::ToolItemGroup *gw);
     void fill_pluginlist();
 public:
     typedef std::map<std::string, PluginUI*>::iterator iterator;
@@ -51,7 +51,11 @@ private:
     int ramp_value; // RT
     int ramp_mode; // RT  should be RampMode, but gcc 4.5 doesn't accept it for g_atomic_int_compare_and_exchange
     volatile bool stopped;
+    volatile int fault_pending; // RT
+    Glib::Dispatcher *fault_notify;
 protected:
+    RtTrace *trace;
+
     int steps_up;		// RT; >= 1
     int steps_up_dead;		// RT; >= 0
     int steps_down;		// RT; >= 1
@@ -59,6 +63,16 @@ protected:
     inline void set_ramp_value(int n) { gx_system::atomic_set(&ramp_value, n); } // RT
     inline void set_ramp_mode(RampMode n) { gx_system::atomic_set(&ramp_mode, n); } // RT
     void try_set_ramp_mode(RampMode oldmode, RampMode newmode, int oldrv, int newrv); // RT
+    inline void notify_fault() { // RT
+	// without notify (LADSPA plugin) the pending flag is polled
+	if (gx_system::atomic_compare_and_exchange(&fault_pending, 0, 1) && fault_notify) {
+	    (*fault_notify)();
+	}
+    }
+    inline void report_fault(Plugin *p) { // RT
+	p->set_faulted();
+	notify_fault();
+    }
 public:
     bool next_commit_needs_ramp;
     ProcessingChainBase();
@@ -90,8 +104,16 @@ public:
     void start_ramp_down();
     inline void set_down_dead() { set_ramp_mode(ramp_mode_down_dead); }
     inline bool is_down_dead() { return get_ramp_mode() == ramp_mode_down_dead; }
+    inline bool is_ramped_down() {
+	RampMode rm = get_ramp_mode();
+	return rm == ramp_mode_down_dead || rm == ramp_mode_down;
+    }
     void set_stopped(bool v);
     bool is_stopped() { return stopped; }
+    void set_fault_notify(Glib::Dispatcher *d) { fault_notify = d; }
+    bool has_fault_pending() { return gx_system::atomic_get(fault_pending); }
+    void set_trace(RtTrace *t) { trace = t; }
+    void recover_faults(std::vector<std::pair<std::string,bool> >& recovered);
 #ifndef NDEBUG
     void print_chain_state(const char *title);
 #endif
@@ -111,7 +133,7 @@ private:
     int current_index;
     F *current_pointer;
     void setsize(int n);
-    inline F get_audio(PluginDef *p);
+    inline F get_audio(Plugin *p);
 protected:
     F *processing_pointer; // RT
     inline F* get_rt_chain() { return gx_system::atomic_get(processing_pointer); } // RT
@@ -125,6 +147,7 @@ public:
 	}
     }
     void commit(bool clear, ParamMap& pmap);
+    void get_rt_ids(std::vector<std::string>& ids);
 };
 
 typedef void (*monochainorder)(int count, float *output, float *output1,
@@ -135,27 +158,33 @@ typedef void (*stereochainorder)(int count, float* input, float* input1,
 struct monochain_data {
     monochainorder func;
     PluginDef      *plugin;
-    monochain_data(monochainorder func_, PluginDef *plugin_): func(func_), plugin(plugin_) {}
-    monochain_data(): func(), plugin() {}
+    Plugin         *owner;
+    monochain_data(monochainorder func_, PluginDef *plugin_, Plugin *owner_)
+	: func(func_), plugin(plugin_), owner(owner_) {}
+    monochain_data(): func(), plugin(), owner() {}
 };
 
 struct stereochain_data {
     stereochainorder func;
     PluginDef       *plugin;
-    stereochain_data(stereochainorder func_, PluginDef *plugin_): func(func_), plugin(plugin_) {}
-    stereochain_data(): func(), plugin() {}
+    Plugin          *owner;
+    stereochain_data(stereochainorder func_, PluginDef *plugin_, Plugin *owner_)
+	: func(func_), plugin(plugin_), owner(owner_) {}
+    stereochain_data(): func(), plugin(), owner() {}
 };
 
 template <>
-inline monochain_data ThreadSafeChainPointer<monochain_data>::get_audio(PluginDef *p)
+inline monochain_data ThreadSafeChainPointer<monochain_data>::get_audio(Plugin *p)
 {
-    return monochain_data(p->mono_audio, p);
+    PluginDef *pd = p->get_pdef();
+    return monochain_data(pd->mono_audio, pd, p);
 }
 
 template <>
-inline stereochain_data ThreadSafeChainPointer<stereochain_data>::get_audio(PluginDef *p)
+inline stereochain_data ThreadSafeChainPointer<stereochain_data>::get_audio(Plugin *p)
 {
-    return stereochain_data(p->stereo_audio, p);
+    PluginDef *pd = p->get_pdef();
+    return stereochain_data(pd->stereo_audio, pd, p);
 }
 
 template <class F>
@@ -204,7 +233,7 @@ void ThreadSafeChainPointer<F>::commit(bool clear, ParamMap& pmap) {
 	} else if (pd->clear_state && clear) {
 	    pd->clear_state(pd);
 	}
-	F f = get_audio(pd);
+	F f = get_audio(*p);
 	assert(f.func);
 	current_pointer[active_counter++] = f;
     }
@@ -215,6 +244,15 @@ void ThreadSafeChainPointer<F>::commit(bool clear, ParamMap& pmap) {
     current_pointer = rack_order_ptr[current_index];
 }
 
+// ids of the modules in the rt chain, in processing order
+template <class F>
+void ThreadSafeChainPointer<F>::get_rt_ids(std::vector<std::string>& ids) {
+    ids.clear();
+    for (F *p = processing_pointer; p->func; ++p) {
+	ids.push_back(p->plugin->id);
+    }
+}
+
 /****************************************************************
  ** class MonoModuleChain, class StereoModuleChain
  */
@@ -251,12 +289,15 @@ protected:
     int policy;         // jack realtime policy,
     int priority;       // and priority, for internal modules
     // signal anyone who needs to be synchronously notified
-    // BE CAREFUL: executed by RT thread (though not concurrent with audio
-    // modules, and timing requirements are relaxed)
+    // executed while the engine is stopped (SF_JACK_RECONFIG), by the
+    // main loop for jack, by activate() for ladspa; not concurrent with
+    // audio modules
     sigc::signal<void, unsigned int> buffersize_change;
     sigc::signal<void, unsigned int> samplerate_change;
     unsigned int buffersize;
     unsigned int samplerate;
+    bool any_count;     // rt callbacks may have any sample count,
+			// buffersize is just the preferred partition size
 public:
     enum OverloadType {		// type of overload condition
 	ov_User      = 0x1,	// idle thread probe starved
@@ -265,6 +306,7 @@ public:
     ov_NoWarn    = 0x8	// disable overlaod warning
     };
     PluginList pluginlist;  
+    TempoTracker tempo;  // MIDI clock / transport tempo for synced modules
     EngineControl();
     ~EngineControl();
     void init(unsigned int samplerate, unsigned int buffersize,
@@ -273,11 +315,14 @@ public:
     virtual bool update_module_lists() = 0;
     virtual void start_ramp_up() = 0;
     virtual void start_ramp_down() = 0;
+    virtual bool is_ramped_down() = 0;  // down or going down
     virtual void overload(OverloadType tp, const char *reason) = 0; // RT
     void set_samplerate(unsigned int samplerate_);
     unsigned int get_samplerate() { return samplerate; }
     void set_buffersize(unsigned int buffersize_);
     unsigned int get_buffersize() { return buffersize; }
+    void set_any_count(bool v) { any_count = v; }
+    bool get_any_count() { return any_count; }
     virtual void set_rack_changed() = 0;
     void clear_rack_changed();
     bool get_rack_changed();
@@ -314,13 +359,17 @@ protected:
     const char         *overload_reason;   // name of unit which detected overload
     int                 ov_disabled;	   // bitmask of OverloadType
     static int         sporadic_interval; // seconds; overload if at least 2 events in the timespan
+    Glib::Dispatcher    plugin_fault_detected;
+    sigc::signal<void, const std::string&, bool> plugin_fault;
 #ifdef GUITARIX_AS_PLUGIN
     sigc::signal<bool ()> _signal_timeout;
     sigc::connection clearoverride_conn;
 #endif
 protected:
     void check_overload();
+    void check_plugin_faults();
 public:
+    RtTrace rt_trace;  // per-period telemetry, dumped on overload
     MonoModuleChain mono_chain;  // active modules (amp chain, input to insert output)
     StereoModuleChain stereo_chain;  // active stereo modules (effect chain, after insert input)
     enum StateFlag {  // engine is off if one of these flags is set
@@ -340,6 +389,7 @@ public:
     virtual void start_ramp_up();
     virtual void start_ramp_down();
     virtual void wait_ramp_down_finished();
+    virtual bool is_ramped_down();
     void ramp_down() {
 	start_ramp_down();
 	wait_ramp_down_finished();
@@ -359,6 +409,8 @@ public:
     void set_state(GxEngineState state);
     GxEngineState get_state();
     sigc::signal<void, GxEngineState>& signal_state_change() { return state_change; }
+    // plugin id, plugin switched off
+    sigc::signal<void, const std::string&, bool>& signal_plugin_fault() { return plugin_fault; }
     static void set_overload_interval(int i)  { sporadic_interval = i; }
 #ifdef GUITARIX_AS_PLUGIN
 	sigc::signal<bool ()>& signal_timeout() override { return _signal_timeout; }
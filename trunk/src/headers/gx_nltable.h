@@ -0,0 +1,139 @@
+/*
+ * Copyright (C) 2009, 2010 Hermann Meyer, James Warden, Andreas Degert
+ * Copyright (C) 2011 Pete Shorthose
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ * --------------------------------------------------------------------------
+ */
+
+/* ------- interpolated 1-dimensional function tables ------- */
+
+#pragma once
+
+#ifndef SRC_HEADERS_GX_NLTABLE_H_
+#define SRC_HEADERS_GX_NLTABLE_H_
+
+#include <cmath>
+
+/****************************************************************
+ * nltable: 1-dimensional function table for the nonlinearities
+ * (tube transfer functions, clipping tables, circuit tables),
+ * data generated by tools/nltable.py (used by tools/tube_transfer.py
+ * and tools/ampsim/DK/circ_table_gen.py). The LV2 plugins include
+ * this file too (src/headers is in their include path).
+ *
+ * nltable and nltable_imp<size> must only differ in the last
+ * element, so that the typecast from nltable_imp<size> will work.
+ * Can't use inheritance because then C initializers will not
+ * work and initialization will be more awkward or less efficient.
+ *
+ * The lookup has no branches: the table position is clamped with
+ * compare / select, out of range and NaN input give the end
+ * values, so a loop over nltable_lookup() (see nltable_process())
+ * is vectorized by the compiler. It is computed in the type of the
+ * argument.
+ *
+ * order 1: linear interpolation; callers with double arguments get
+ *          the values of the former per-table lookup code, except
+ *          for input less than one step below low, which gives
+ *          data[0] instead of a value extrapolated from the first
+ *          two points.
+ * order 3: cubic (Catmull-Rom) interpolation, the error falls with
+ *          the 3rd power of the point distance instead of the 2nd,
+ *          so the same accuracy needs much smaller tables (the
+ *          tube tables of the engine: 2001 -> 239..398 points).
+ *          Needs at least 4 points.
+ * The order is a property of the generated data; the generator
+ * writes it into the header comment of the table.
+ */
+
+struct nltable { // 1-dimensional function table
+    float low;
+    float high;
+    float istep;
+    int size;
+    float data[];
+};
+
+template <int tab_size>
+struct nltable_imp {
+    float low;
+    float high;
+    float istep;
+    int size;
+    float data[tab_size];
+    operator nltable&() const { return *(nltable*)this; }
+};
+
+/*
+ * value at table position f (f == 0: data[0], f == size-1:
+ * data[size-1])
+ */
+template <int order = 1, typename T>
+static inline T nltable_interpolate(const nltable& t, T f) {
+    const T last = t.size - 1;
+    f = f > T(0) ? f : T(0);  // also maps NaN to 0
+    f = f < last ? f : last;
+    int i = static_cast<int>(f);
+    i = i < t.size - 2 ? i : t.size - 2;
+    f -= i;
+    if (order == 1) {
+        return t.data[i]*(1-f) + t.data[i+1]*f;
+    }
+    const T y1 = t.data[i];
+    const T y2 = t.data[i+1];
+    // at the table ends the missing neighbour is extrapolated with
+    // the parabola through the 3 nearest points
+    const T ym = t.data[i - (i > 0)];
+    const T yp = t.data[i + 1 + (i < t.size - 2)];
+    const T y0 = i > 0 ? ym : 3*(y1 - y2) + yp;
+    const T y3 = i < t.size - 2 ? yp : 3*(y2 - y1) + ym;
+    const T c1 = T(0.5) * (y2 - y0);
+    const T c2 = y0 - T(2.5) * y1 + 2 * y2 - T(0.5) * y3;
+    const T c3 = T(0.5) * (y3 - y0) + T(1.5) * (y1 - y2);
+    return ((c3 * f + c2) * f + c1) * f + y1;
+}
+
+template <int order = 1, typename T>
+static inline T nltable_lookup(const nltable& t, T x) {
+    return nltable_interpolate<order>(t, (x - t.low) * t.istep);
+}
+
+// table of an odd function, only covering x >= 0
+template <int order = 1, typename T>
+static inline T nltable_lookup_odd(const nltable& t, T x) {
+    return std::copysign(nltable_lookup<order>(t, std::fabs(x)), x);
+}
+
+// batched lookup for non-recursive signal paths (in == out is
+// allowed); the results go through a local buffer, which can't
+// alias the table, else the gathers of the table values would
+// prevent vectorization
+template <int order = 1>
+static inline void nltable_process(const nltable& t, int count, const float *in, float *out) {
+    const int blocksize = 64;
+    float buf[blocksize];
+    for (int i = 0; i < count; i += blocksize) {
+        int n = count - i < blocksize ? count - i : blocksize;
+        for (int j = 0; j < n; j++) {
+            buf[j] = nltable_lookup<order>(t, in[i+j]);
+        }
+        for (int j = 0; j < n; j++) {
+            out[i+j] = buf[j];
+        }
+    }
+}
+
+#endif  // SRC_HEADERS_GX_NLTABLE_H_
@@ -0,0 +1,77 @@
+/*
+ * Copyright (C) 2009, 2010 Hermann Meyer, James Warden, Andreas Degert
+ * Copyright (C) 2011 Pete Shorthose
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ * --------------------------------------------------------------------------
+ */
+
+/* ------- offline (non-realtime) rendering through the guitarix engine ------- */
+
+#pragma once
+
+#ifndef SRC_HEADERS_GX_OFFLINE_RENDER_H_
+#define SRC_HEADERS_GX_OFFLINE_RENDER_H_
+
+#ifndef GUITARIX_AS_PLUGIN
+
+namespace gx_engine {
+
+/****************************************************************
+ ** class OfflineRenderer
+ **
+ ** Drives a GxEngine without a jack connection: audio is read
+ ** from a sound file, run through the mono and the stereo chain
+ ** in blocks of fixed size and written to a stereo float wav
+ ** file as fast as the cpu allows. The convolvers are switched
+ ** to synchronous mode, so the result does not depend on timing.
+ */
+
+struct RenderJob {
+    std::string infile;
+    std::string outfile;
+    RenderJob(const std::string& infile_, const std::string& outfile_)
+	: infile(infile_), outfile(outfile_) {}
+};
+
+class OfflineRenderer: boost::noncopyable {
+private:
+    GxEngine engine;
+    gx_jack::GxJack jack;  // never connected, needed by GxSettings
+    gx_preset::GxSettings settings;
+    unsigned int blocksize;
+    float *monobuf;
+    float *outbuf1;
+    float *outbuf2;
+    void run_pending();
+    void start_engine(unsigned int samplerate);
+    inline void process_block(float *input);
+public:
+    OfflineRenderer(gx_system::CmdlineOptions& options, unsigned int blocksize);
+    ~OfflineRenderer();
+    bool load_preset(const Glib::ustring& bank, const Glib::ustring& name);
+    void load_state() { settings.loadstate(); }
+    bool render(const std::string& infile, const std::string& outfile,
+		unsigned int samplerate = 0);
+    GxEngine& get_engine() { return engine; }
+    // returns number of failed jobs
+    static int render_jobs(gx_system::CmdlineOptions& options,
+			   const std::vector<RenderJob>& jobs);
+};
+
+} /* end of gx_engine namespace */
+
+#endif // !GUITARIX_AS_PLUGIN
+#endif  // SRC_HEADERS_GX_OFFLINE_RENDER_H_
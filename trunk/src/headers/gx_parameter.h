@@ -47,11 +47,13 @@ namespace gx_engine {
 class ParameterGroups {
  private:
     map<string, string> groups;
+    // several engines (rigs) in one process register the same groups
+    map<string, int> refcount;
 
 #ifndef NDEBUG
     map<string, bool> used;
     void group_exists(const string& id);
-    void group_is_new(const string& id);
+    void group_is_new(const string& id, const string& group);
     friend string param_group(const string& group_id, bool nowarn);
 #endif
 
@@ -65,12 +67,15 @@ class ParameterGroups {
 	return groups[id];
     }
     inline void insert(const string& id, const string& group) {
-	debug_check(group_is_new, id);
+	debug_check(group_is_new, id, group);
 	groups.insert(pair<string, string>(id, group));
+	refcount[id] += 1;
     }
     bool group_exist(const string& id);
     inline void erase(const string& id) {
          if (!group_exist(id)) return;
+	 if (--refcount[id] > 0) return;
+	 refcount.erase(id);
 #ifndef NDEBUG // avoid unused variable warning in release mode
 	size_t n = groups.erase(id);
 	assert(n == 1);
@@ -546,6 +551,7 @@ class ParamMap: boost::noncopyable {
 
  public:
     template<class T> friend class ParameterV;
+    friend class Lv2StateParameter;
     ParamMap();
     ~ParamMap();
     void writeJSON(gx_system::JsonWriter& jw);
@@ -736,24 +742,6 @@ typedef list<MidiController> midi_controller_list;
 **/
 
 
-class MidiClockToBpm {
-private:
-    double                 time1;
-    double                 time_diff;
-    int                    collect;
-    int                    collect_;
-    double                 bpm;
-    double                 bpm_new;
-    bool                   ret;
-
-public:
-    MidiClockToBpm();
-    ~MidiClockToBpm() {}
-    unsigned int rounded(float f);
-    bool time_to_bpm(double time, unsigned int* bpm_);
-};
-
-
 class ControllerArray: public vector<midi_controller_list> {
 public:
     enum { array_size = 328 };
@@ -777,10 +765,6 @@ private:
     volatile gint          bank_change; //RT
     int                    bank_changed;
     int                    channel_select;
-    timespec               ts1;
-    double                 time0;
-    unsigned int           bpm_;
-    MidiClockToBpm         mp;
     Glib::Dispatcher       pgm_chg;
     Glib::Dispatcher       mute_chg;
     Glib::Dispatcher       bank_chg;
@@ -823,6 +807,7 @@ public:
     sigc::signal<void,int>& signal_new_bank() { return new_bank; }
     void compute_midi_in(void* midi_input_port_buf, void *arg);  //RT
     void process_trans(int transport_state);  //RT
+    void process_tempo(unsigned int bpm);  //RT
     void update_from_controller(int ctr);
     void update_from_controllers();
     void set_midi_channel(int s);
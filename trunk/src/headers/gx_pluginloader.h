@@ -51,6 +51,9 @@ private:
     IntParameter  *p_position; ///< Position in Rack / Audio Processing Chain
     IntParameter  *p_effect_post_pre; ///< pre/post amp position (post = 0)
     int pos_tmp;
+    volatile int fault;   ///< RT: output not finite, skipped until recovered
+    int fault_repeat;     ///< faults in short succession
+    gint64 last_recovery;
     void set_midi_on_off_blocked(bool v);
 public:
     PluginDef *get_pdef() { return pdef; }
@@ -77,6 +80,10 @@ public:
     inline int position_weight() { return get_effect_post_pre() ? get_position() : get_position() + POST_WEIGHT; }
     void register_vars(ParamMap& param, EngineControl& seq);
     void copy_position(const Plugin& plugin);
+    inline bool is_faulted() { return gx_system::atomic_get(fault); } // RT
+    inline void set_faulted() { gx_system::atomic_set(&fault, 1); } // RT
+    inline void clear_fault() { gx_system::atomic_set(&fault, 0); }
+    bool recover_fault();
     friend class PluginListBase;
     friend class PluginList;
     friend void printlist(const char *title, const list<Plugin*>& modules, bool header);
@@ -163,6 +170,7 @@ public:
     void set_samplerate(int samplerate); // call set_samplerate of all plugins
     int load_from_path(const string& path, PluginPos pos = PLUGIN_POS_RACK);
     int load_library(const string& path, PluginPos pos = PLUGIN_POS_RACK);
+    int load_circuit(const string& path, PluginPos pos = PLUGIN_POS_RACK);
     int add(Plugin *pl, PluginPos pos, int flags);
     Plugin *add(PluginDef *p, PluginPos pos = PLUGIN_POS_RACK, int flags=0);
     int add(PluginDef **p, PluginPos pos = PLUGIN_POS_RACK, int flags=0);
@@ -157,7 +157,8 @@ private:
     string make_state_filename();
     string make_default_state_filename();
     static bool check_create_config_dir(const Glib::ustring& dir);
-    static GxSettings *instance;
+    static std::list<GxSettings*> instances;  // one per engine (rig)
+    static bool save_all_states();
     friend class ::PosixSignals;
 #ifdef HAVE_LIBLO
     friend class ::GxNsmHandler;
@@ -59,7 +59,8 @@ class StreamingResampler: Resampler {
     bool setup(int srcRate, int dstRate, int nchan);
     int get_max_out_size(int i_size) { return (i_size * ratio_b) / ratio_a + 1; }
     int process(int count, float *input, float *output);
-    int flush(float *output); // check source for max. output size
+    int get_max_flush_size() { return get_max_out_size(inpsize()/2); }
+    int flush(float *output); // output size: get_max_flush_size()
 };
 
 class FixedRateResampler {
@@ -0,0 +1,87 @@
+/*
+ * Copyright (C) 2009, 2010 Hermann Meyer, James Warden, Andreas Degert
+ * Copyright (C) 2011 Pete Shorthose
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ * --------------------------------------------------------------------------
+ */
+
+/* ------- locked memory for plugin state used in the rt thread ------- */
+
+#pragma once
+
+#ifndef SRC_HEADERS_GX_RTMEMORY_H_
+#define SRC_HEADERS_GX_RTMEMORY_H_
+
+namespace gx_engine {
+
+/****************************************************************
+ ** class RtArena
+ **
+ ** Memory for plugin state which is touched by the rt thread
+ ** (delay lines, recorder and looper buffers, ...). Plugins get
+ ** it with rt_alloc() / rt_free() from their activate callback
+ ** (never from the rt thread). The arena hands out blocks from
+ ** anonymous mappings which are mlock'ed and prefaulted when they
+ ** are created, so the first access in the process callback can't
+ ** page fault. Returned memory is zeroed.
+ */
+
+class RtArena: boost::noncopyable {
+private:
+    struct Region;
+    struct Header {  // in front of every allocated block
+	size_t size;
+	Region *region;
+    };
+    struct Region {
+	char *base;
+	size_t size;
+	bool locked;
+	Region(char *base_, size_t size_, bool locked_)
+	    : base(base_), size(size_), locked(locked_) {}
+    };
+    std::list<Region> regions;
+    std::map<char*, size_t> free_blocks;  // address -> size
+    size_t used;
+    size_t mapped;
+    bool lock_warned;
+    boost::mutex mutex;
+    static const size_t min_region_size = 4 << 20;
+    static const size_t header_size = 16;
+    RtArena();
+    void add_region(size_t size);
+    void release_free_regions();
+    Region *find_region(char *p);
+public:
+    static RtArena& get_instance();
+    void *alloc(size_t size);  // throws std::bad_alloc
+    void free(void *p);
+    size_t get_used() const { return used; }
+    size_t get_mapped() const { return mapped; }
+};
+
+template <class T>
+inline T *rt_alloc(size_t n) {
+    return static_cast<T*>(RtArena::get_instance().alloc(n * sizeof(T)));
+}
+
+inline void rt_free(void *p) {
+    RtArena::get_instance().free(p);
+}
+
+} /* end of gx_engine namespace */
+
+#endif  // SRC_HEADERS_GX_RTMEMORY_H_
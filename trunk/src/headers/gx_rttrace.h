@@ -0,0 +1,147 @@
+/*
+ * Copyright (C) 2009, 2010 Hermann Meyer, James Warden, Andreas Degert
+ * Copyright (C) 2011 Pete Shorthose
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ * --------------------------------------------------------------------------
+ */
+
+/* ------- per-period telemetry of the rt threads ------- */
+
+#pragma once
+
+#ifndef SRC_HEADERS_GX_RTTRACE_H_
+#define SRC_HEADERS_GX_RTTRACE_H_
+
+namespace gx_engine {
+
+/****************************************************************
+ ** class RtTrace
+ **
+ ** Ring of the last few thousand periods, written by the jack
+ ** callbacks and the module chains (one record per period, no
+ ** locks). An overload or xrun triggers the trace: some more
+ ** periods are recorded so that the aftermath is visible too,
+ ** then the ring is frozen and the ui thread writes it to a JSON
+ ** file and re-arms the trace.
+ */
+
+class RtTrace: boost::noncopyable {
+public:
+    enum { ring_size = 4096, max_plugins = 32, post_periods = 32 };
+    struct Record {
+	gint64 start;        // period start (ns, CLOCK_MONOTONIC)
+	int nframes;
+	int mono_ns;         // mono (amp) callback
+	int stereo_ns;       // stereo (insert) callback
+	int midi_events;
+	int generation;      // module chain commit counter
+	int overload;        // EngineControl::OverloadType bits
+	short mono_ramp;     // ProcessingChainBase::RampMode
+	short stereo_ramp;
+	short minflt;        // page faults of the rt thread(s)
+	short majflt;
+	unsigned char mono_plugins;  // used entries of mono_plugin_ns
+	unsigned char stereo_plugins;
+	int mono_plugin_ns[max_plugins];
+	int stereo_plugin_ns[max_plugins];
+    };
+private:
+    enum { st_running, st_triggered, st_frozen };
+    struct Chains {
+	std::vector<std::string> mono;
+	std::vector<std::string> stereo;
+    };
+    Record *ring;             // RT
+    volatile int write_index; // RT; record of the current period
+    volatile int filled;      // RT; valid records in ring
+    volatile int generation;
+    volatile int state;
+    int post_count;           // RT
+    const char *reason;
+    Glib::Dispatcher frozen;
+    std::map<int, Chains> chains;
+    std::string dump_dir;
+    std::vector<Record> snapshot;
+    std::map<int, Chains> snapshot_chains;
+    std::string snapshot_reason;
+    gint64 snapshot_time;
+    gint64 last_dump;
+    sigc::signal<void, const std::string&> dumped;
+    void on_frozen();
+    void remove_old_dumps();
+public:
+    RtTrace();
+    ~RtTrace();
+    void init(const std::string& dir);
+    static inline gint64 now() { // RT
+	timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return ts.tv_sec * 1000000000LL + ts.tv_nsec;
+    }
+    inline Record *begin_period(int nframes); // RT
+    inline Record *current() { // RT
+	if (!ring || gx_system::atomic_get(state) == st_frozen) {
+	    return 0;
+	}
+	return &ring[gx_system::atomic_get(write_index)];
+    }
+    void trigger(int ov_type, const char *reason_); // RT
+    void commit(const std::vector<std::string>& mono, const std::vector<std::string>& stereo);
+    bool has_snapshot() const { return !snapshot.empty(); }
+    void writeJSON(gx_system::JsonWriter& jw) const;
+    // file name of the written trace
+    sigc::signal<void, const std::string&>& signal_dumped() { return dumped; }
+};
+
+inline RtTrace::Record *RtTrace::begin_period(int nframes) {
+    if (!ring) {
+	return 0;
+    }
+    int st = gx_system::atomic_get(state);
+    if (st == st_frozen) {
+	return 0;
+    }
+    if (st == st_triggered) {
+	if (post_count < 0) {
+	    post_count = post_periods;
+	} else if (--post_count == 0) {
+	    post_count = -1;
+	    gx_system::atomic_set(&state, st_frozen);
+	    frozen();
+	    return 0;
+	}
+    }
+    int idx = (gx_system::atomic_get(write_index) + 1) & (ring_size - 1);
+    Record& r = ring[idx];
+    r.start = now();
+    r.nframes = nframes;
+    r.mono_ns = r.stereo_ns = 0;
+    r.midi_events = 0;
+    r.generation = gx_system::atomic_get(generation);
+    r.overload = 0;
+    r.mono_ramp = r.stereo_ramp = 0;
+    r.minflt = r.majflt = 0;
+    r.mono_plugins = r.stereo_plugins = 0;
+    gx_system::atomic_set(&write_index, idx);
+    if (filled < ring_size) {
+	gx_system::atomic_inc(&filled);
+    }
+    return &r;
+}
+
+} /* end of gx_engine namespace */
+
+#endif  // SRC_HEADERS_GX_RTTRACE_H_
@@ -399,6 +399,7 @@ private:
     Glib::OptionGroup optgroup_jack;
     Glib::OptionGroup optgroup_overload;
     Glib::OptionGroup optgroup_file;
+    Glib::OptionGroup optgroup_render;
     Glib::OptionGroup optgroup_debug;
     std::string path_to_program;
     bool version;
@@ -425,8 +426,10 @@ private:
     std::string loop_dir;
     Glib::ustring rcset;
     bool nogui;
+    int rigs;
     int rpcport;
     Glib::ustring rpcaddress;
+    std::vector<Glib::ustring> rpc_origins;
     bool onlygui;
     bool liveplaygui;
     bool hideonquit;
@@ -444,6 +447,12 @@ private:
     bool lterminal;
     bool a_save;
     bool auto_save;
+    std::vector<std::string> render_inputs;
+    std::string render_output_dir;
+    Glib::ustring render_preset;
+    int render_samplerate;   // -1: not given
+    int render_blocksize;
+    int render_jobs;
     std::string get_opskin();
 
 public:
@@ -517,6 +526,7 @@ public:
     const Glib::ustring& get_rcset() const { return rcset; }
     bool get_clear_rc() const { return clear; }
     bool get_nogui() const { return nogui; }
+    int get_rigs() const { return rigs; }
     bool get_liveplaygui() const { return liveplaygui; }
     bool get_hideonquit() const { return hideonquit; }
     void set_hideonquit(bool set) { hideonquit = set; }
@@ -532,6 +542,7 @@ public:
     void set_rpcport(int port) { rpcport = port; }
     const Glib::ustring& get_rpcaddress() { return rpcaddress; }
     void set_rpcaddress(const Glib::ustring& address) { rpcaddress = address; }
+    const std::vector<Glib::ustring>& get_rpc_origins() const { return rpc_origins; }
     const std::string& get_loadfile() const { return load_file; }
     const Glib::ustring& get_jack_instancename() const { return jack_instance; }
     void set_jack_instancename(std::string name) {  jack_instance = name; }
@@ -553,6 +564,13 @@ public:
     bool get_xrun_watchdog() const { return xrun_watchdog; }
     bool get_convolver_watchdog() const { return convolver_watchdog; }
     bool get_watchdog_warning() const { return watchdog_warning; }
+    bool get_render() const { return !render_inputs.empty(); }
+    const std::vector<std::string>& get_render_inputs() const { return render_inputs; }
+    const std::string& get_render_output_dir() const { return render_output_dir; }
+    const Glib::ustring& get_render_preset() const { return render_preset; }
+    int get_render_samplerate() const { return std::max(render_samplerate, 0); }
+    int get_render_blocksize() const { return render_blocksize; }
+    int get_render_jobs() const { return render_jobs; }
 };
 
 inline BasicOptions& get_options() {
@@ -0,0 +1,87 @@
+/*
+ * Copyright (C) 2009, 2010 Hermann Meyer, James Warden, Andreas Degert
+ * Copyright (C) 2011 Pete Shorthose
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ * --------------------------------------------------------------------------
+ */
+
+/* ------- tempo tracking (MIDI clock / jack transport) ------- */
+
+#pragma once
+
+#ifndef SRC_HEADERS_GX_TEMPO_H_
+#define SRC_HEADERS_GX_TEMPO_H_
+
+#include <atomic>
+
+namespace gx_engine {
+
+/****************************************************************
+ ** class TempoTracker
+ **
+ ** Tempo and beat phase for the tempo-synced modules.
+ **
+ ** MIDI clock ticks are timed with the jack frame time of the
+ ** event (sample accurate, no system clock) and filtered with a
+ ** 2nd order delay locked loop (F. Adriaensen, "Using a DLL to
+ ** filter time"): wide bandwidth while locking, narrow when
+ ** locked. Without a running MIDI clock the BBT tempo of a rolling
+ ** jack transport is used.
+ **
+ ** All methods except the getters are called by the jack process
+ ** thread. At the end of each period update() publishes tempo and
+ ** phase for the start of the next period; the getters can be
+ ** used from any thread (lock-free).
+ */
+
+class TempoTracker: boost::noncopyable {
+public:
+    enum Source {
+	src_none,          // no tempo source
+	src_midi_clock,    // locked to MIDI clock
+	src_transport      // jack transport BBT
+    };
+    enum { ticks_per_beat = 24 };  // MIDI clock
+private:
+    unsigned int sr;       // RT
+    unsigned int base;     // RT; frame origin of t0, t1
+    double t0;             // RT; filtered time of the last tick
+    double t1;             // RT; predicted time of the next tick
+    double period;         // RT; filtered tick period (frames)
+    int ticks;             // RT; ticks since (re)start of locking
+    int beat_tick;         // RT; position of the last tick in the beat
+    int last_bpm;          // RT; last value returned by update()
+    std::atomic<float> bpm;
+    std::atomic<float> phase;
+    std::atomic<int> source;
+    void restart(unsigned int frame);
+public:
+    TempoTracker();
+    void midi_clock(unsigned int frame);  // RT
+    void midi_start();                    // RT
+    void midi_song_position(int pos);     // RT; pos in 16th notes
+    bool update(unsigned int frame, unsigned int nframes, unsigned int sr_,
+		bool transport_valid, double transport_bpm,
+		double transport_phase);   // RT
+    unsigned int get_rounded_bpm() const { return last_bpm; }  // RT
+    float get_bpm() const { return bpm.load(std::memory_order_relaxed); }
+    float get_beat_phase() const { return phase.load(std::memory_order_relaxed); }
+    Source get_source() const { return static_cast<Source>(source.load(std::memory_order_relaxed)); }
+};
+
+} /* end of gx_engine namespace */
+
+#endif  // SRC_HEADERS_GX_TEMPO_H_
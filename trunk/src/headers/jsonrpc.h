@@ -76,17 +76,32 @@ public:
 	f_plugins_changed,
 	f_misc_msg,
 	f_units_changed,
+	f_plugin_fault,
+	f_rt_trace,
 	END_OF_FLAGS
     };
 private:
+    enum Protocol {  // decided by the first bytes received
+	proto_detect,
+	proto_jsonrpc,     // newline delimited JSON-RPC stream
+	proto_handshake,   // HTTP upgrade request in progress
+	proto_websocket,   // one JSON-RPC message per WebSocket message
+    };
     GxService& serv;
     Glib::RefPtr<Gio::SocketConnection> connection;
     std::list<std::string> outgoing;
+    std::list<std::string> frames;  // binary attachments of the current response
     unsigned int current_offset;
     gx_system::JsonStringParser jp;
     bool midi_config_mode;
     std::bitset<END_OF_FLAGS> flags;
     std::map<string,float> maxlevel;
+    Protocol protocol;
+    std::string ws_in;       // handshake / undecoded frame data
+    std::string ws_message;  // fragments of the current message
+    int ws_message_op;
+    bool ws_message_deflated;
+    bool ws_deflate;         // permessage-deflate negotiated
 private:
     bool find_token(const Glib::ustring& token, msg_type *start, msg_type *end);
     void activate(int n, bool v) { flags.set(n, v); }
@@ -103,6 +118,16 @@ private:
     void listen(const Glib::ustring& tp);
     void unlisten(const Glib::ustring& tp);
     void process(gx_system::JsonStringParser& jp);
+    void add_attachment(gx_system::JsonWriter& jw, const float *data, unsigned int count, int accept) {
+	frames.push_back(gx_system::JsonAttachment::make_frame(data, count, accept, jw));
+    }
+    void send(const std::string& s);
+    void send_raw(const std::string& s);
+    void send_attachment(const std::string& frame);
+    bool ws_handshake(const char *p, int n);
+    bool ws_data_in(const char *p, int n);
+    bool ws_message_in();
+    void ws_send(const char *p, size_t n, int opcode);
 
 public:
     CmdConnection(GxService& serv, const Glib::RefPtr<Gio::SocketConnection>& connection_);
@@ -160,6 +185,8 @@ private:
     void on_param_value_changed(gx_engine::Parameter *p);
     void preset_changed();
     void on_engine_state_change(gx_engine::GxEngineState state);
+    void on_plugin_fault(const std::string& id, bool switched_off);
+    void on_rt_trace_dumped(const std::string& fname);
     void on_tuner_freq_changed();
     void display(const Glib::ustring& bank, const Glib::ustring& preset);
     void set_display_state(TunerSwitcher::SwitcherState newstate);
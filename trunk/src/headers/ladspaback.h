@@ -177,6 +177,7 @@ private:
     ~PluginDesc();
     void serializeJSON(gx_system::JsonWriter& jw);
     friend class LadspaPluginList;
+    friend class ScanCache;
 public:
     void set_old();
     void clear_old() { delete old; old = 0; }
@@ -184,6 +185,47 @@ public:
     void output(gx_system::JsonWriter& jw);
 };
 
+/****************************************************************
+ ** class ScanCache
+ **
+ ** Unprocessed scan results, stored in the user config directory.
+ ** A LADSPA library entry is keyed by its path and stays valid as
+ ** long as mtime and size of the file are unchanged; the LV2 entry
+ ** is keyed by a fingerprint of all bundle .ttl files. Libraries
+ ** which crashed the scan are remembered until they change.
+ */
+
+class ScanCache {
+public:
+    typedef std::map<std::string, PluginDesc*> pluginmap;
+private:
+    struct Entry {
+        std::string stamp;
+        bool crashed;
+        bool owned;  // plugins not yet handed over to a pluginmap
+        bool seen;
+        std::vector<PluginDesc*> plugins;
+        Entry(): stamp(), crashed(false), owned(true), seen(false), plugins() {}
+        ~Entry();
+    };
+    typedef std::map<std::string, Entry*> entrymap;
+    std::string filename;
+    entrymap entries;
+    bool dirty;
+    void read();
+public:
+    ScanCache(const std::string& filename);
+    ~ScanCache();
+    static PluginDesc *parse_plugin(gx_system::JsonParser& jp);
+    static void insert(std::vector<PluginDesc*>& plugins, pluginmap& d);
+    static std::string file_stamp(const std::string& path);
+    bool get(const std::string& key, const std::string& stamp, pluginmap& d, bool *crashed = 0);
+    void put(const std::string& key, const std::string& stamp, std::vector<PluginDesc*>& plugins,
+             bool crashed, pluginmap& d);
+    void save();
+};
+
+
 /****************************************************************
  ** class LadspaPluginList
  */
@@ -215,7 +257,8 @@ private:
     static void set_preset_values(Glib::ustring port_symbol, LV2Preset* pdata, Glib::ustring value);
     static inline std::string make_key(unsigned long unique_id) { return "ladspa://" + gx_system::to_string(unique_id); }
     static void add_plugin(const LADSPA_Descriptor& desc, pluginmap& d, const std::string& path, int index);
-    static void load_defs(const std::string& path, pluginmap& d);
+    static bool load_defs(const std::string& path, pluginmap& d, Glib::ustring& error);
+    static void scan_libraries(const std::vector<std::string>& libs, ScanCache& cache, pluginmap& d);
     static void set_instances(const char *uri, pluginmap& d, std::vector<Glib::ustring>& label,
 			      std::vector<unsigned long>& not_found, std::set<unsigned long>& seen);
     static void descend(const char *uri, pluginmap& d,
@@ -223,6 +266,10 @@ private:
 			std::vector<Glib::ustring>& base);
     void add_plugin(const LilvPlugin* plugin, pluginmap& d, gx_system::CmdlineOptions& options);
     void lv2_load(pluginmap& d, gx_system::CmdlineOptions& options);
+    void lv2_load_cached(ScanCache& cache, pluginmap& d, gx_system::CmdlineOptions& options);
+    void load_lv2_world();
+    static std::string lv2_fingerprint();
+    friend class ScanCache;
     void get_presets(LV2Preset *pdata);
 public:
     LadspaPluginList();
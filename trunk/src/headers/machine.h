@@ -147,6 +147,7 @@ public:
     virtual gx_system::PresetFileGui *bank_get_file(const Glib::ustring& bank) const = 0;
     virtual bank_iterator bank_begin() = 0;
     virtual bank_iterator bank_end() = 0;
+    virtual void search_presets(const gx_system::PresetQuery& q, std::vector<gx_system::PresetMatch>& result) = 0;
     virtual void pf_append(gx_system::PresetFileGui& pf, const Glib::ustring& src, gx_system::PresetFileGui& pftgt, const Glib::ustring& name) = 0;
     virtual void pf_insert_before(gx_system::PresetFileGui& pf, const Glib::ustring& src, gx_system::PresetFileGui& pftgt, const Glib::ustring& pos, const Glib::ustring& name) = 0;
     virtual void pf_insert_after(gx_system::PresetFileGui& pf, const Glib::ustring& src, gx_system::PresetFileGui& pftgt, const Glib::ustring& pos, const Glib::ustring& name) = 0;
@@ -348,6 +349,7 @@ public:
     virtual gx_system::PresetFileGui *bank_get_file(const Glib::ustring& bank) const;
     virtual bank_iterator bank_begin();
     virtual bank_iterator bank_end();
+    virtual void search_presets(const gx_system::PresetQuery& q, std::vector<gx_system::PresetMatch>& result);
     virtual void pf_append(gx_system::PresetFileGui& pf, const Glib::ustring& src, gx_system::PresetFileGui& pftgt, const Glib::ustring& name);
     virtual void pf_insert_before(gx_system::PresetFileGui& pf, const Glib::ustring& src, gx_system::PresetFileGui& pftgt, const Glib::ustring& pos, const Glib::ustring& name);
     virtual void pf_insert_after(gx_system::PresetFileGui& pf, const Glib::ustring& src, gx_system::PresetFileGui& pftgt, const Glib::ustring& pos, const Glib::ustring& name);
@@ -421,6 +423,7 @@ private:
 #endif
     gx_system::JsonWriter *jw;
     std::vector<gx_system::JsonStringParser*> notify_list;
+    std::list<std::string> attachments;  // binary frames received for the pending call
     sigc::connection idle_conn;
     gx_preset::UnitRacks rack_units;
     sigc::signal<void> midi_changed;
@@ -538,6 +541,7 @@ public:
     virtual gx_system::PresetFileGui *bank_get_file(const Glib::ustring& bank) const;
     virtual bank_iterator bank_begin();
     virtual bank_iterator bank_end();
+    virtual void search_presets(const gx_system::PresetQuery& q, std::vector<gx_system::PresetMatch>& result);
     virtual void pf_append(gx_system::PresetFileGui& pf, const Glib::ustring& src, gx_system::PresetFileGui& pftgt, const Glib::ustring& name);
     virtual void pf_insert_before(gx_system::PresetFileGui& pf, const Glib::ustring& src, gx_system::PresetFileGui& pftgt, const Glib::ustring& pos, const Glib::ustring& name);
     virtual void pf_insert_after(gx_system::PresetFileGui& pf, const Glib::ustring& src, gx_system::PresetFileGui& pftgt, const Glib::ustring& pos, const Glib::ustring& name);
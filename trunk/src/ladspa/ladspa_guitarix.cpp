@@ -388,6 +388,8 @@ LadspaSettings::LadspaSettings(string sfname, string presname, EngineControl& se
       preset_io(seq.get_param(), stereo_convolver, mono_convolver, cp),
       state_io(seq.get_param(), stereo_convolver, mono_convolver, cp) {
     set_io(&state_io, &preset_io);
+    // the state file of gx_head, which might be running
+    statefile.set_read_only(true);
     set_statefilename(sfname);
     change_preset_file(presname);
 }
@@ -465,6 +467,7 @@ private:
 	static sem_t created_sem;
 	static void run_mainloop();
 	void load_presets();
+	bool check_faults();
 	void add(LadspaGuitarix* i);
 	bool remove(LadspaGuitarix* i);
 	PresetLoader();
@@ -491,13 +494,16 @@ public:
     LADSPA_Data * priority_port;
     LADSPA_Data * latency_port;
     ControlParameter& control_parameter;
+    ProcessingChainBase& chain;
     LadspaSettings settings;
     void check_preset();
+    void check_faults();
     int get_buffersize_from_port();
     void prepare_run();
     unsigned int activate(int *policy, int *prio);
     void load();
-    LadspaGuitarix(EngineControl& engine, ConvolverStereoAdapter* stereo_convolver, ConvolverMonoAdapter* mono_convolver,
+    LadspaGuitarix(EngineControl& engine, ProcessingChainBase& chain_,
+		   ConvolverStereoAdapter* stereo_convolver, ConvolverMonoAdapter* mono_convolver,
 		   ControlParameter& cp, const char *envvar);
     ~LadspaGuitarix();
     static void start_presetloader() { PresetLoader::start_presetloader(); }
@@ -521,7 +527,8 @@ static string get_presetfile(const char *envvar) {
 
 // engine and cp not yet initialized, only use address!
 LadspaGuitarix::LadspaGuitarix(
-    EngineControl& engine, ConvolverStereoAdapter* stereo_convolver, ConvolverMonoAdapter* mono_convolver, ControlParameter& cp, const char *envvar)
+    EngineControl& engine, ProcessingChainBase& chain_, ConvolverStereoAdapter* stereo_convolver,
+    ConvolverMonoAdapter* mono_convolver, ControlParameter& cp, const char *envvar)
     : last_thread_id(),
       jack_bs(),
       jack_prio(),
@@ -534,6 +541,7 @@ LadspaGuitarix::LadspaGuitarix(
       priority_port(),
       latency_port(),
       control_parameter(cp),
+      chain(chain_),
       settings(get_statefile(), get_presetfile(envvar), engine, stereo_convolver, mono_convolver, cp) {
     PresetLoader::add_instance(this);
 }
@@ -554,6 +562,28 @@ void LadspaGuitarix::check_preset() {
     PresetLoader::preset_change();
 }
 
+// non-rt (activate, preset loader thread): reset the plugins the rt
+// thread stopped because of NaN/Inf output; the plugin has no
+// Dispatcher for it like GxEngine, the pending flag is polled
+void LadspaGuitarix::check_faults() {
+    if (!chain.has_fault_pending()) {
+	return;
+    }
+    std::vector<std::pair<std::string,bool> > v;
+    chain.recover_faults(v);
+    for (std::vector<std::pair<std::string,bool> >::iterator i = v.begin(); i != v.end(); ++i) {
+	if (i->second) {
+	    gx_print_error(
+		"sentinel",
+		boost::format(_("%1%: repeated NaN/Inf output, plugin switched off")) % i->first);
+	} else {
+	    gx_print_warning(
+		"sentinel",
+		boost::format(_("%1%: NaN/Inf output, plugin state reset")) % i->first);
+	}
+    }
+}
+
 void LadspaGuitarix::load() {
     int num = gx_system::atomic_get(next_preset_num);
     if (num == preset_num) {
@@ -597,37 +627,38 @@ unsigned int LadspaGuitarix::activate(int *policy, int *prio) {
 	    *prio = round(*priority_port);
 	}
     }
-    int bufsize;
-    if (no_buffer_port && *no_buffer_port > 0) {
-	bufsize = 0;
-	*latency_port = 0;
-    } else {
-	bufsize = get_buffersize_from_port();
-	if (jack_bs == 0) {
-	    jack_status_t jackstat;
-	    jack_client_t *client = jack_client_open("guitarix-test", JackNoStartServer, &jackstat);
-	    if (client) {
-		jack_bs = jack_get_buffer_size(client);
-		jack_prio = jack_client_real_time_priority(client);
-		jack_client_close(client);
-	    } else {
-		jack_bs = jack_prio = -1;
-	    }
-	}
-	if (jack_bs > 0 && (!bufsize || bufsize > jack_bs)) {
-	    bufsize = jack_bs;
-	}
-	if (!bufsize) {
-	    bufsize = 64;
-	}
-	if (!*prio && jack_prio > 0) {
-	    *prio = jack_prio;
+    // the engine processes any sample count without rebuffering,
+    // bufsize is only the partition size of the convolvers (and the
+    // no_buffer port is kept for compatibility)
+    int bufsize = get_buffersize_from_port();
+    if (jack_bs == 0) {
+	jack_status_t jackstat;
+	jack_client_t *client = jack_client_open("guitarix-test", JackNoStartServer, &jackstat);
+	if (client) {
+	    jack_bs = jack_get_buffer_size(client);
+	    jack_prio = jack_client_real_time_priority(client);
+	    jack_client_close(client);
+	} else {
+	    jack_bs = jack_prio = -1;
 	}
- 	*latency_port = bufsize-1;
+    }
+    if (jack_bs > 0 && (!bufsize || bufsize > jack_bs)) {
+	bufsize = jack_bs;
+    }
+    if (bufsize < static_cast<int>(Convproc::MINPART)) {
+	bufsize = Convproc::MINPART;
+    }
+    if (!*prio && jack_prio > 0) {
+	*prio = jack_prio;
+    }
+    if (latency_port) {
+	*latency_port = 0;
     }
     return bufsize;
 }
 
+static const unsigned int fault_poll_ms = 200;
+
 sem_t LadspaGuitarix::PresetLoader::created_sem;
 Glib::Thread *LadspaGuitarix::PresetLoader::thread = 0;
 LadspaGuitarix::PresetLoader *LadspaGuitarix::PresetLoader::instance = 0;
@@ -669,6 +700,9 @@ void LadspaGuitarix::PresetLoader::run_mainloop() {
     init_logger();
     instance = new PresetLoader();
     instance->new_preset.connect(sigc::mem_fun(*instance, &PresetLoader::load_presets));
+    Glib::RefPtr<Glib::TimeoutSource> faults = Glib::TimeoutSource::create(fault_poll_ms);
+    faults->connect(sigc::mem_fun(*instance, &PresetLoader::check_faults));
+    faults->attach(instance->mainloop->get_context());
     sem_post(&instance->created_sem);
     instance->mainloop->run();
     delete instance;
@@ -683,6 +717,14 @@ void LadspaGuitarix::PresetLoader::load_presets() {
     }
 }
 
+bool LadspaGuitarix::PresetLoader::check_faults() {
+    boost::mutex::scoped_lock lock(instance_mutex);
+    for (list<LadspaGuitarix*>::iterator i = ladspa_instances.begin(); i != ladspa_instances.end(); ++i) {
+	(*i)->check_faults();
+    }
+    return true;
+}
+
 void LadspaGuitarix::PresetLoader::create() {
     assert(instance == 0);
     sem_init(&created_sem, 0, 0);
@@ -758,6 +800,7 @@ public:
     virtual bool update_module_lists();
     virtual void start_ramp_up();
     virtual void start_ramp_down();
+    virtual bool is_ramped_down();
     virtual void set_samplerate(unsigned int samplerate);
     bool prepare_module_lists();
     void commit_module_lists();
@@ -818,6 +861,10 @@ void MonoEngine::start_ramp_down() {
     mono_chain.start_ramp_down();
 }
 
+bool MonoEngine::is_ramped_down() {
+    return mono_chain.is_ramped_down();
+}
+
 void MonoEngine::set_samplerate(unsigned int samplerate) {
     mono_chain.set_samplerate(samplerate);
     EngineControl::set_samplerate(samplerate);
@@ -944,6 +991,7 @@ MonoEngine::MonoEngine(const string& plugin_dir, const string& loop_dir, Paramet
       loop(get_param(), sigc::mem_fun(mono_chain, &MonoModuleChain::sync), loop_dir),
       record(*this, 1), detune(*this, sigc::mem_fun(mono_chain, &MonoModuleChain::sync)) {
 
+    set_any_count(true);
     mono_convolver.set_sync(true);
     cabinet.set_sync(true);
     preamp.set_sync(true);
@@ -1106,39 +1154,9 @@ private:
 	~LADSPA();
     };
 
-    class ReBuffer {
-    private:
-	// data for compute
-	int buffer_size;
-	int in_buffer_index;
-	int out_buffer_index;
-	LADSPA_Data *in_buffer;
-	LADSPA_Data *out_buffer;
-	// input data for run()
-	int block_size;
-	int in_block_index;
-	int out_block_index;
-	LADSPA_Data *in_block;
-	LADSPA_Data *out_block;
-	static inline void copy(LADSPA_Data *dst, LADSPA_Data *src, int cnt) {
-	    memcpy(dst, src, cnt * sizeof(dst[0]));
-	}
-    public:
-	ReBuffer();
-	~ReBuffer();
-	int get_count() { return buffer_size; }
-	LADSPA_Data *get_input() { return in_buffer; }
-	LADSPA_Data *get_output() { return out_buffer; }
-	bool put();
-	void set_bufsize(int bufsize);
-	int get_bufsize() { return buffer_size; }
-	void set(int cnt, LADSPA_Data *input_buffer, LADSPA_Data *output_buffer);
-    };
-
     MonoEngine engine;
     ControlParameter control_parameter;
     LadspaGuitarix ladspa_guitarix;
-    ReBuffer rebuffer;
     LADSPA_Data * volume_port;
     FloatParameter& volume_param;
     LADSPA_Data * input_buffer;
@@ -1160,8 +1178,7 @@ LadspaGuitarixMono::LadspaGuitarixMono(unsigned long sr)
     : engine(Glib::build_filename(Glib::get_user_config_dir(), "guitarix/plugins/"),
        Glib::build_filename(Glib::get_user_config_dir(), "guitarix/pluginpresets/loops/"), get_group_table()),
       control_parameter(GUITARIX_PARAM_COUNT),
-      ladspa_guitarix(engine, 0, &engine.mono_convolver, control_parameter, "LADSPA_GUITARIX_MONO_PRESET"),
-      rebuffer(),
+      ladspa_guitarix(engine, engine.mono_chain, 0, &engine.mono_convolver, control_parameter, "LADSPA_GUITARIX_MONO_PRESET"),
       volume_port(),
       volume_param(engine.get_param()["amp.out_ladspa"].getFloat()),
       input_buffer(),
@@ -1182,7 +1199,6 @@ void LadspaGuitarixMono::activateGuitarix(LADSPA_Handle Instance) {
     LadspaGuitarixMono& self = *static_cast<LadspaGuitarixMono*>(Instance);
     int policy, prio, bufsize;
     bufsize = self.ladspa_guitarix.activate(&policy, &prio);
-    self.rebuffer.set_bufsize(bufsize);
     self.engine.set_buffersize(bufsize);
     gx_print_info(
 	"amp activate",
@@ -1191,6 +1207,7 @@ void LadspaGuitarixMono::activateGuitarix(LADSPA_Handle Instance) {
     self.engine.init(self.engine.get_samplerate(), bufsize, policy, prio);
     self.engine.mono_chain.set_stopped(true);
     self.ladspa_guitarix.load();
+    self.ladspa_guitarix.check_faults();
     self.engine.mono_chain.set_stopped(false);
     self.engine.mono_chain.start_ramp_up();
 }
@@ -1199,17 +1216,8 @@ void LadspaGuitarixMono::runGuitarix(LADSPA_Handle Instance, unsigned long Sampl
     LadspaGuitarixMono& self = *static_cast<LadspaGuitarixMono*>(Instance);
     self.ladspa_guitarix.prepare_run();
     self.volume_param.set(*self.volume_port);
-    if (self.rebuffer.get_bufsize()) {
-	self.rebuffer.set(SampleCount, self.input_buffer, self.output_buffer);
-	while (self.rebuffer.put()) {
-	    self.engine.mono_chain.process(
-		self.rebuffer.get_count(), self.rebuffer.get_input(),
-		self.rebuffer.get_output());
-	}
-    } else {
-	self.engine.mono_chain.process(
-	    SampleCount, self.input_buffer, self.output_buffer);
-    }
+    self.engine.mono_chain.process(
+	SampleCount, self.input_buffer, self.output_buffer);
     self.engine.mono_chain.post_rt_finished();
 }
 
@@ -1261,79 +1269,6 @@ void LadspaGuitarixMono::cleanupGuitarix(LADSPA_Handle Instance) {
     delete static_cast<LadspaGuitarixMono*>(Instance);
 }
 
-LadspaGuitarixMono::ReBuffer::ReBuffer()
-    : buffer_size(0),
-      in_buffer_index(0),
-      out_buffer_index(0),
-      in_buffer(0),
-      out_buffer(0),
-      block_size(0),
-      in_block_index(0),
-      out_block_index(0),
-      in_block(0),
-      out_block(0) {
-}
-
-LadspaGuitarixMono::ReBuffer::~ReBuffer() {
-    delete[] in_buffer;
-    delete[] out_buffer;
-}
-
-void LadspaGuitarixMono::ReBuffer::set_bufsize(int bufsize) {
-    if (bufsize) {
-	if (bufsize != buffer_size) {
-	    delete[] in_buffer;
-	    in_buffer = new LADSPA_Data[bufsize];
-	    delete[] out_buffer;
-	    out_buffer = new LADSPA_Data[bufsize];
-	    buffer_size = bufsize;
-	    memset(out_buffer, 0, bufsize * sizeof(out_buffer[0]));
-	    in_buffer_index = 0;
-	    out_buffer_index = 1;
-	}
-    } else if (buffer_size) {
-	delete[] in_buffer;
-	in_buffer = 0;
-	delete[] out_buffer;
-	out_buffer = 0;
-	buffer_size = 0;
-    }
-}
-
-void LadspaGuitarixMono::ReBuffer::set(
-    int cnt, LADSPA_Data *input_buffer, LADSPA_Data *output_buffer) {
-    in_block_index = 0;
-    out_block_index = 0;
-    block_size = cnt;
-    in_block = input_buffer;
-    out_block = output_buffer;
-}
-
-bool LadspaGuitarixMono::ReBuffer::put() {
-    int n = min(buffer_size - in_buffer_index, block_size - in_block_index);
-    if (n) {
-	// copy values to in buffer
-	copy(in_buffer+in_buffer_index, in_block+in_block_index, n);
-	in_buffer_index += n;
-	in_block_index += n;
-    }
-    n = min(buffer_size-out_buffer_index, block_size-out_block_index);
-    if (n) {
-	// copy values from out buffer
-	copy(out_block+out_block_index, out_buffer+out_buffer_index, n);
-	out_block_index += n;
-	out_buffer_index += n;
-    }
-    if (in_buffer_index == buffer_size) {
-	// had enough input data left to fill buffer -> process
-	in_buffer_index = 0;
-	out_buffer_index = 0;
-	return true;
-    }
-    return false;
-}
-
-
 /****************************************************************
  ** class LadspaGuitarixMono::LADSPA
  */
@@ -1456,6 +1391,7 @@ public:
     virtual bool update_module_lists();
     virtual void start_ramp_up();
     virtual void start_ramp_down();
+    virtual bool is_ramped_down();
     virtual void set_samplerate(unsigned int samplerate);
     bool prepare_module_lists();
     void commit_module_lists();
@@ -1520,6 +1456,10 @@ void StereoEngine::start_ramp_down() {
     stereo_chain.start_ramp_down();
 }
 
+bool StereoEngine::is_ramped_down() {
+    return stereo_chain.is_ramped_down();
+}
+
 void StereoEngine::set_samplerate(unsigned int samplerate) {
     stereo_chain.set_samplerate(samplerate);
     EngineControl::set_samplerate(samplerate);
@@ -1531,6 +1471,7 @@ StereoEngine::StereoEngine(const string& plugin_dir, ParameterGroups& groups)
       stereo_convolver(*this, sigc::mem_fun(stereo_chain, &StereoModuleChain::sync)),
       record_st(*this, 2) {
 
+    set_any_count(true);
     stereo_convolver.set_sync(true);
 
     load_static_plugins();
@@ -1623,48 +1564,9 @@ private:
 	~LADSPA();
     };
 
-    class ReBuffer {
-    private:
-	// data for compute
-	int buffer_size;
-	int in_buffer_index;
-	int out_buffer_index;
-	LADSPA_Data *in_buffer1;
-	LADSPA_Data *in_buffer2;
-	LADSPA_Data *out_buffer1;
-	LADSPA_Data *out_buffer2;
-	// input data for run()
-	int block_size;
-	int in_block_index;
-	int out_block_index;
-	LADSPA_Data *in_block1;
-	LADSPA_Data *in_block2;
-	LADSPA_Data *out_block1;
-	LADSPA_Data *out_block2;
-	static inline void copy(LADSPA_Data *dst1, LADSPA_Data *dst2,
-				LADSPA_Data *src1, LADSPA_Data *src2, int cnt) {
-	    memcpy(dst1, src1, cnt * sizeof(dst1[0]));
-	    memcpy(dst2, src2, cnt * sizeof(dst2[0]));
-	}
-    public:
-	ReBuffer();
-	~ReBuffer();
-	int get_count() { return buffer_size; }
-	LADSPA_Data *get_input1() { return in_buffer1; }
-	LADSPA_Data *get_input2() { return in_buffer2; }
-	LADSPA_Data *get_output1() { return out_buffer1; }
-	LADSPA_Data *get_output2() { return out_buffer2; }
-	bool put();
-	void set_bufsize(int bufsize);
-	int get_bufsize() { return buffer_size; }
-	void set(int cnt, LADSPA_Data *input_buffer1, LADSPA_Data *input_buffer2,
-		 LADSPA_Data *output_buffer1, LADSPA_Data *output_buffer2);
-    };
-
     StereoEngine engine;
     ControlParameter control_parameter;
     LadspaGuitarix ladspa_guitarix;
-    ReBuffer rebuffer;
     LADSPA_Data * volume_port;
     FloatParameter& volume_param;
     LADSPA_Data * input_buffer1;
@@ -1687,8 +1589,7 @@ public:
 LadspaGuitarixStereo::LadspaGuitarixStereo(unsigned long sr)
     : engine(Glib::build_filename(Glib::get_user_config_dir(), "guitarix/plugins/"), get_group_table()),
       control_parameter(GUITARIX_PARAM_COUNT),
-      ladspa_guitarix(engine, &engine.stereo_convolver, 0, control_parameter, "LADSPA_GUITARIX_STEREO_PRESET"),
-      rebuffer(),
+      ladspa_guitarix(engine, engine.stereo_chain, &engine.stereo_convolver, 0, control_parameter, "LADSPA_GUITARIX_STEREO_PRESET"),
       volume_port(),
       volume_param(engine.get_param()["amp.out_master_ladspa"].getFloat()),
       input_buffer1(),
@@ -1711,7 +1612,6 @@ void LadspaGuitarixStereo::activateGuitarix(LADSPA_Handle Instance) {
     LadspaGuitarixStereo& self = *static_cast<LadspaGuitarixStereo*>(Instance);
     int policy, prio, bufsize;
     bufsize = self.ladspa_guitarix.activate(&policy, &prio);
-    self.rebuffer.set_bufsize(bufsize);
     self.engine.set_buffersize(bufsize);
     gx_print_info(
 	"fx activate",
@@ -1720,6 +1620,7 @@ void LadspaGuitarixStereo::activateGuitarix(LADSPA_Handle Instance) {
     self.engine.init(self.engine.get_samplerate(), bufsize, policy, prio);
     self.engine.stereo_chain.set_stopped(true);
     self.ladspa_guitarix.load();
+    self.ladspa_guitarix.check_faults();
     self.engine.stereo_chain.set_stopped(false);
     self.engine.stereo_chain.start_ramp_up();
 }
@@ -1728,19 +1629,9 @@ void LadspaGuitarixStereo::runGuitarix(LADSPA_Handle Instance, unsigned long Sam
     LadspaGuitarixStereo& self = *static_cast<LadspaGuitarixStereo*>(Instance);
     self.ladspa_guitarix.prepare_run();
     self.volume_param.set(*self.volume_port);
-    if (self.rebuffer.get_bufsize()) {
-	self.rebuffer.set(SampleCount, self.input_buffer1, self.input_buffer2,
-			  self.output_buffer1, self.output_buffer2);
-	while (self.rebuffer.put()) {
-	    self.engine.stereo_chain.process(
-		self.rebuffer.get_count(), self.rebuffer.get_input1(), self.rebuffer.get_input2(),
-		self.rebuffer.get_output1(), self.rebuffer.get_output2());
-	}
-    } else {
-	self.engine.stereo_chain.process(
-	    SampleCount, self.input_buffer1, self.input_buffer2,
-	    self.output_buffer1, self.output_buffer2);
-    }
+    self.engine.stereo_chain.process(
+	SampleCount, self.input_buffer1, self.input_buffer2,
+	self.output_buffer1, self.output_buffer2);
     self.engine.stereo_chain.post_rt_finished();
 }
 
@@ -1798,99 +1689,6 @@ void LadspaGuitarixStereo::cleanupGuitarix(LADSPA_Handle Instance) {
     delete static_cast<LadspaGuitarixStereo*>(Instance);
 }
 
-LadspaGuitarixStereo::ReBuffer::ReBuffer()
-    : buffer_size(0),
-      in_buffer_index(0),
-      out_buffer_index(0),
-      in_buffer1(0),
-      in_buffer2(0),
-      out_buffer1(0),
-      out_buffer2(0),
-      block_size(0),
-      in_block_index(0),
-      out_block_index(0),
-      in_block1(0),
-      in_block2(0),
-      out_block1(0),
-      out_block2(0) {
-}
-
-LadspaGuitarixStereo::ReBuffer::~ReBuffer() {
-    delete[] in_buffer1;
-    delete[] in_buffer2;
-    delete[] out_buffer1;
-    delete[] out_buffer2;
-}
-
-void LadspaGuitarixStereo::ReBuffer::set_bufsize(int bufsize) {
-    if (bufsize) {
-	if (bufsize != buffer_size) {
-	    delete[] in_buffer1;
-	    in_buffer1 = new LADSPA_Data[bufsize];
-	    delete[] in_buffer2;
-	    in_buffer2 = new LADSPA_Data[bufsize];
-	    delete[] out_buffer1;
-	    out_buffer1 = new LADSPA_Data[bufsize];
-	    delete[] out_buffer2;
-	    out_buffer2 = new LADSPA_Data[bufsize];
-	    buffer_size = bufsize;
-	    memset(out_buffer1, 0, bufsize * sizeof(out_buffer1[0]));
-	    memset(out_buffer2, 0, bufsize * sizeof(out_buffer2[0]));
-	    in_buffer_index = 0;
-	    out_buffer_index = 1;
-	}
-    } else if (buffer_size) {
-	delete[] in_buffer1;
-	in_buffer1 = 0;
-	delete[] in_buffer1;
-	in_buffer2 = 0;
-	delete[] out_buffer1;
-	out_buffer1 = 0;
-	delete[] out_buffer2;
-	out_buffer2 = 0;
-	buffer_size = 0;
-    }
-}
-
-void LadspaGuitarixStereo::ReBuffer::set(
-    int cnt, LADSPA_Data *input_buffer1, LADSPA_Data *input_buffer2,
-    LADSPA_Data *output_buffer1, LADSPA_Data *output_buffer2) {
-    in_block_index = 0;
-    out_block_index = 0;
-    block_size = cnt;
-    in_block1 = input_buffer1;
-    in_block2 = input_buffer2;
-    out_block1 = output_buffer1;
-    out_block2 = output_buffer2;
-}
-
-bool LadspaGuitarixStereo::ReBuffer::put() {
-    int n = min(buffer_size - in_buffer_index, block_size - in_block_index);
-    if (n) {
-	// copy values to in buffer
-	copy(in_buffer1+in_buffer_index, in_buffer2+in_buffer_index,
-	     in_block1+in_block_index, in_block2+in_block_index, n);
-	in_buffer_index += n;
-	in_block_index += n;
-    }
-    n = min(buffer_size-out_buffer_index, block_size-out_block_index);
-    if (n) {
-	// copy values from out buffer
-	copy(out_block1+out_block_index, out_block2+out_block_index,
-	     out_buffer1+out_buffer_index, out_buffer2+out_buffer_index, n);
-	out_block_index += n;
-	out_buffer_index += n;
-    }
-    if (in_buffer_index == buffer_size) {
-	// had enough input data left to fill buffer -> process
-	in_buffer_index = 0;
-	out_buffer_index = 0;
-	return true;
-    }
-    return false;
-}
-
-
 /****************************************************************
  ** class LadspaGuitarixStereo::LADSPA
  */
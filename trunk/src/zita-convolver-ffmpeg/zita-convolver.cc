@@ -27,6 +27,9 @@ extern "C" {
 #define __STDC_CONSTANT_MACROS  // needed for UINT64_C (libavutil 0.8.6)
 #include <libavutil/common.h>
 }
+#ifdef __SSE__
+#include <xmmintrin.h>
+#endif
 #include "zita-convolver.h"
 #include "gx_compiler.h"
 
@@ -697,6 +700,10 @@ void *Convlevel::static_main (void *arg)
 
 void __rt_func Convlevel::main (void)
 {
+#ifdef __SSE__
+    // flush denormals to zero, like the jack thread
+    _mm_setcsr (_mm_getcsr () | 0x8040);
+#endif
     _stat = ST_PROC;
     while (true)
     {
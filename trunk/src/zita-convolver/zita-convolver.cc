@@ -22,6 +22,9 @@
 #include <stdlib.h>
 #include <string.h>
 #include <stdio.h>
+#ifdef __SSE__
+#include <xmmintrin.h>
+#endif
 #include "zita-convolver.h"
 
 #ifdef _WIN32
@@ -718,6 +721,10 @@ void *Convlevel::static_main (void *arg)
 
 void Convlevel::main (void)
 {
+#ifdef __SSE__
+    // flush denormals to zero, like the jack thread
+    _mm_setcsr (_mm_getcsr () | 0x8040);
+#endif
     _stat = ST_PROC;
     while (true)
     {
@@ -4,10 +4,12 @@ from __future__ import division
 import math
 import copy
 import pylab as pl
-import sys
+import sys, os
 import numpy as np
 from models import *
 import dk_simulator, dk_lib
+sys.path.insert(0, os.path.join(os.path.dirname(os.path.abspath(__file__)), '../..'))
+import nltable
 
 class gen(object):
     FS = 96000
@@ -79,40 +81,15 @@ class Circ_table(gen):
         if (D) :
             self.divider = D
 
-    table_define = """
-struct table1d { // 1-dimensional function table
-    float low;
-    float high;
-    float istep;
-    int size;
-    float data[];
-};
+    order = 1 # interpolation order of the table (see nltable.orders)
 
-template <int tab_size>
-struct table1d_imp {
-    float low;
-    float high;
-    float istep;
-    int size;
-    float data[tab_size];
-    operator table1d&() const { return *(table1d*)this; }
-};
+    table_define = """
+#include "gx_nltable.h"
 """
 
     table_use = """
 double always_inline circclip(double x) {
-    double f = fabs(x);
-    f = f * circ_table.istep;
-    int i = static_cast<int>(f);
-    if (i < 0) {
-        f = circ_table.data[0];
-    } else if (i >= circ_table.size-1) {
-        f = circ_table.data[circ_table.size-1];
-    } else {
-    f -= i;
-    f = circ_table.data[i]*(1-f) + circ_table.data[i+1]*f;
-    }
-    return copysign(f, x);
+    return nltable_lookup_odd<%d>(circ_table, x);
 }
 """
 
@@ -210,32 +187,23 @@ double always_inline circclip(double x) {
         t1 = ("\n // --sig_max  %f") % self.max_sig
         t2 = ("\n // --table_div  %f") % self.divider
         t3 = ("\n // --table_op  %f\n") % self.set_operator
-        table_define_tmp = self.table_define.replace('table1d', 'table%s' % self.model)
-        table_use_tmp = self.table_use.replace('circ', '%s' % self.model)
+        table_use_tmp = self.table_use.replace('circ', '%s' % self.model) % self.order
         sys.stdout = open(n, 'w')
         sys.stdout.write("\n")
         sys.stdout.write("// %s_table generated by DK/circ_table_gen.py -- do not modify manually\n"  % self.model)
+        sys.stdout.write("// interpolation order: %d\n" % self.order)
         sys.stdout.write("\n // variables used")
         sys.stdout.write(t1)
         sys.stdout.write(t2)
         sys.stdout.write(t3)
-        sys.stdout.write(table_define_tmp)
+        sys.stdout.write(self.table_define)
         sys.stdout.write("\n ")
-        sys.stdout.write("static table%s_imp<%d> %s_table __rt_data = {\n" % (self.model, len(self.sig), self.model))
-        for i in range(len(y)):
-            c += 1
-            if c == 2:
-                aj = y[0] # dc offset to be removed
-                sys.stdout.write('\t%g,%g,%g,%d, {' % ((y[0] -aj), (y[len(self.sig)-1] -aj )/self.divider, (len(self.sig)-1)*self.operator, len(self.sig)))
-                for item in y:
-                    if z % 5 == 0:
-                        sys.stdout.write(s+"\n\t" )
-                        s = ""
-                        z = 0
-                    sys.stdout.write(s+"%s" % ("{:.12f}".format(float((item-aj)/self.divider))))
-                    s = ","
-                    z +=1
-                sys.stdout.write("\n\t}\n};")
+        sys.stdout.write("static nltable_imp<%d> %s_table __rt_data = {\n" % (len(self.sig), self.model))
+        aj = y[0] # dc offset to be removed
+        values = [float((item-aj)/self.divider) for item in y]
+        nltable.write_data(0, (y[len(self.sig)-1] -aj )/self.divider, (len(self.sig)-1)*self.operator,
+                           values, fmt="{:.12f}".format)
+        sys.stdout.write("\n};")
         sys.stdout.write("\n")
         sys.stdout.write(table_use_tmp)
         sys.stdout.write("\n")
@@ -0,0 +1,141 @@
+# -*- coding: utf-8 -*-
+#
+# write a circuit description (.dkc file) for the runtime DK engine
+# of guitarix (src/headers/gx_dkcircuit.h)
+#
+# The description contains the state space matrices of the discretized
+# circuit, the nonlinear functions as B-splines and the data for the
+# potentiometer update. Copy the file to the guitarix plugin directory
+# (~/.config/guitarix/plugins/): it's loaded as a mono plugin, no C++
+# code is generated and nothing needs to be compiled.
+#
+# Usage (sim is a dk_simulator.SimulatePy instance, e.g. from
+# analog.Circuit):
+#
+#   ranges = dk_runtime.estimate_ranges(sim, test_signal)
+#   dk_runtime.write_circuit(sim, "mycircuit.dkc", ranges, plugindef)
+#
+# Only circuits with one input, one output and an unpartitioned
+# nonlinear equation system (the default transform options) are
+# supported by the runtime engine.
+#
+
+from __future__ import division, print_function
+import json
+import numpy as np
+import sympy as sp
+from scipy import interpolate
+
+import dk_simulator
+
+taper_points = 101
+
+
+def _rows(m):
+    return np.asarray(m, dtype=np.float64).tolist()
+
+def estimate_ranges(sim, signal, margin=0.2):
+    """range of the nonlinear function inputs v while sim processes
+    signal (array of input samples), extended by margin"""
+    signal = np.asarray(signal, dtype=np.float64).reshape(-1, sim.eq.ni)
+    lo = np.array(sim.v0, dtype=np.float64)
+    hi = lo.copy()
+    for u in signal:
+        sim(u.reshape(1, -1))
+        lo = np.minimum(lo, sim.v0)
+        hi = np.maximum(hi, sim.v0)
+    d = (hi - lo) * margin + 1e-3
+    return list(zip(lo - d, hi + d))
+
+def fit_nonlin(eq, ranges, points=(200, 60), degree=3):
+    """B-spline fits of the nonlinear functions of eq over ranges
+    (points per dimension for 1- and 2-dimensional functions)"""
+    nonlin = []
+    for j, (expr, vl, base) in enumerate(eq.f):
+        f = np.vectorize(sp.lambdify(vl, expr, modules=["math"]))
+        base = [int(b) for b in base]
+        if len(base) == 1:
+            x = np.linspace(ranges[base[0]][0], ranges[base[0]][1], points[0])
+            t, c, k = interpolate.splrep(x, f(x), k=degree, s=0)
+            knots = [t]
+        elif len(base) == 2:
+            n = points[1]
+            x = np.linspace(ranges[base[0]][0], ranges[base[0]][1], n)
+            y = np.linspace(ranges[base[1]][0], ranges[base[1]][1], n)
+            X, Y = np.meshgrid(x, y, indexing='ij')
+            s = interpolate.RectBivariateSpline(x, y, f(X, Y), kx=degree, ky=degree, s=0)
+            tx, ty, c = s.tck
+            knots = [tx, ty]
+        else:
+            raise ValueError("nonlinear function %d: %d inputs, only 1 or 2 are supported"
+                             % (j, len(base)))
+        nonlin.append(dict(
+            inputs = base,
+            output = j,
+            degree = [degree] * len(base),
+            knots = [list(map(float, t)) for t in knots],
+            coeffs = list(map(float, c)),
+            ))
+    return nonlin
+
+def write_circuit(sim, fname, ranges, plugindef=None, samplerate=None,
+                  maxiter=10, tol=1e-6, points=(200, 60)):
+    eq = sim.eq
+    parser = eq.get_parser()
+    if eq.nn and type(eq.nonlin) is not dk_simulator.NonlinEquations:
+        raise ValueError("partitioned or chained nonlinear equations are not supported")
+    if eq.np:
+        # base matrices, pots are applied with the Woodbury identity
+        A, B, Bc, C, D, E, Ec, F, G, H, Hc, K = (
+            eq.A, eq.B, eq.Bc, eq.C, eq.D, eq.E, eq.Ec, eq.F,
+            eq.G, eq.H, eq.Hc, eq.K)
+    else:
+        A, B, Bc, C, D, E, Ec, F, G, H, Hc, K = sim.calc_matrixes()
+    if eq.nn:
+        # same as SimulatePy.nonlin_py
+        U, Mi = eq.nonlin.U, eq.nonlin.Mi
+        G, H, Hc = U * G, U * H, eq.nonlin.Hc
+        C, F = C * Mi, F * Mi
+        CZ = eq.CZ
+    else:
+        G, H, Hc, K = [np.zeros((0, n)) for n in (eq.nx, eq.ni, 1, 0)]
+        C, F = np.zeros((eq.nx, 0)), np.zeros((eq.no, 0))
+        CZ = []
+    d = dict(
+        samplerate = int(samplerate or parser.fs),
+        nx = eq.nx, ni = eq.ni, no = eq.no, nn = eq.nn,
+        maxiter = maxiter,
+        tol = tol,
+        Mx = _rows(np.concatenate((A, B, Bc, C), axis=1)),
+        Mo = _rows(np.concatenate((D, E, Ec, F), axis=1)),
+        Mpk = _rows(np.concatenate((G, H, Hc, K), axis=1)),
+        CZ = list(map(float, CZ)),
+        x0 = list(map(float, sim.x0)),
+        v0 = list(map(float, sim.v00)) if eq.nn else [],
+        nonlin = fit_nonlin(eq, ranges, points) if eq.nn else [],
+        )
+    if plugindef is not None:
+        d.update(id = plugindef.id, name = plugindef.name,
+                 category = plugindef.category,
+                 description = plugindef.description,
+                 shortname = plugindef.shortname)
+    else:
+        d["id"] = d["name"] = "circuit"
+    if eq.np:
+        pots = parser.get_pot_attr()
+        pot_vars = [p[0] for p in pots]
+        defaults = parser.get_variable_defaults()
+        d["pots"] = [dict(id = var, name = name, value = float(defaults.get(sp.Symbol(var), 0.5)))
+                     for var, name, loga, inv, expr in pots]
+        x = np.linspace(0, 1, taper_points)
+        d["resistors"] = [dict(pot = pot_vars.index(str(a)), R = float(pv),
+                               taper = [float(f.subs({a: v})) for v in x])
+                          for (a, f), pv in zip(parser.get_pot_funcs(), parser.Pv)]
+        d["Q"] = _rows(eq.Q)
+        d["Uxl"] = _rows(eq.Uxl)
+        d["Uo"] = _rows(eq.Uo)
+        d["Unl"] = _rows(eq.Unl)
+        # like get_UR(), with the column for the constant voltages
+        d["UR"] = _rows(np.concatenate((eq.Uxr.T, eq.Uu.T, eq.Ucv.T, eq.Unr.T), axis=1))
+    with open(fname, "w") as f:
+        json.dump(d, f, indent=1)
@@ -0,0 +1,150 @@
+# -*- coding: utf-8 -*-
+#
+# sample circuit description (.dkc) for the runtime DK engine of
+# guitarix (src/headers/gx_dkcircuit.h), with a check of its output
+#
+# The circuit is Diode_clipper of circ.py (input source, R(1) = 0.1
+# Ohm to node 2, two antiparallel diodes from node 2 to GND, output
+# V(2)). Its DK equations are small enough to be written down here,
+# so that the description can be made without the DK toolchain:
+#
+#   i(v) = -2 * Is * sinh(v / mUt)   (diode current, sign as in models.D2)
+#   v    = u + R(1) * i(v)           (node 2)
+#
+# i.e. p = u, K = R(1), CZ = 1 and o = u + R(1) * i. The nonlinear
+# function is fitted like dk_runtime.fit_nonlin() does it.
+#
+# The output of the description, computed with the equations of
+# DKCircuit::process_block(), is compared with Diode_clipper.result,
+# the output of the module generated by the DK toolchain for this
+# circuit (python simu.py -> Diode_clipper).
+#
+# Usage: python dkc_diode_clipper.py [output.dkc]
+#        (default: diode_clipper.dkc in this directory)
+#
+
+from __future__ import division, print_function
+import sys, os, json
+import numpy as np
+from scipy import interpolate
+
+# circ.Diode_clipper
+R1 = 0.1
+Is = 10e-12
+mUt = 30e-3
+FS = 96000
+
+def signal():
+    return np.linspace(-1.2, 1.2, 200)
+
+def sample_index(n, count=10):
+    # Test.get_samples()
+    return np.array(np.linspace(0, n-1, count).round(), dtype=int)
+
+# column V(2) of circ.Diode_clipper.result
+reference = np.array([
+    -8.01341156e-01, -7.74066721e-01, -6.65097827e-01, -4.04019395e-01,
+    -1.38693467e-01, 1.38693467e-01, 4.04019395e-01, 6.65097827e-01,
+    7.74066721e-01, 8.01341156e-01])
+
+def diode(v):
+    return -2 * Is * np.sinh(v / mUt)
+
+def exact_v(u):
+    """solution of v = u + R1 * i(v) (bisection, i is monotonic)"""
+    lo, hi = min(u, 0), max(u, 0)
+    for _ in range(200):
+        m = (lo + hi) / 2
+        if m - u - R1 * diode(m) > 0:
+            hi = m
+        else:
+            lo = m
+    return (lo + hi) / 2
+
+def estimate_range(sig, margin=0.2):
+    # like dk_runtime.estimate_ranges()
+    v = [exact_v(u) for u in sig]
+    lo, hi = min(v), max(v)
+    d = (hi - lo) * margin + 1e-3
+    return lo - d, hi + d
+
+def make_description(points=200, degree=3):
+    lo, hi = estimate_range(signal())
+    x = np.linspace(lo, hi, points)
+    t, c, k = interpolate.splrep(x, diode(x), k=degree, s=0)
+    return dict(
+        id = "dk_diode_clipper",
+        name = "DK Diode Clipper",
+        category = "Distortion",
+        description = "diode clipper (runtime DK engine sample)",
+        shortname = "Clipper",
+        samplerate = FS,
+        nx = 0, ni = 1, no = 1, nn = 1,
+        maxiter = 50,
+        tol = 1e-9,
+        # columns: u, 1, i
+        Mx = [],
+        Mo = [[1.0, 0.0, R1]],
+        Mpk = [[1.0, 0.0, R1]],
+        CZ = [1.0],
+        x0 = [],
+        v0 = [0.0],
+        nonlin = [dict(
+            inputs = [0],
+            output = 0,
+            degree = [degree],
+            knots = [list(map(float, t))],
+            coeffs = list(map(float, c)),
+            )],
+        )
+
+def spline_eval(f, v):
+    # DKSpline::eval(): linear continuation outside of the knots
+    t, c, k = f["knots"][0], f["coeffs"], f["degree"][0]
+    n = len(t) - k - 1
+    x = min(max(v, t[k]), t[n])
+    tck = (np.array(t), np.array(c), k)
+    s = float(interpolate.splev(x, tck))
+    ds = float(interpolate.splev(x, tck, der=1))
+    return s + ds * (v - x), ds
+
+def process(d, sig):
+    """DKCircuit::process_block() for nx == 0, nn == 1"""
+    f = d["nonlin"][0]
+    mo = d["Mo"][0]
+    p_u, p_c, K = d["Mpk"][0]
+    cz = d["CZ"][0]
+    v = d["v0"][0]
+    out = []
+    for u in sig:
+        p = p_u * u + p_c
+        for it in range(d["maxiter"]):
+            i, di = spline_eval(f, v)
+            r = cz * v - p - K * i
+            dv = r / (K * di - cz)
+            v += dv
+            if abs(dv) < d["tol"]:
+                break
+        i, di = spline_eval(f, v)
+        out.append(mo[0] * u + mo[1] + mo[2] * i)
+    return np.array(out)
+
+def main():
+    if len(sys.argv) > 1:
+        fname = sys.argv[1]
+    else:
+        fname = os.path.join(os.path.dirname(os.path.abspath(__file__)), "diode_clipper.dkc")
+    d = make_description()
+    with open(fname, "w") as f:
+        json.dump(d, f, indent=1)
+    y = process(d, signal())[sample_index(len(signal()))]
+    err = np.max(abs(y - reference)) / np.max(abs(reference))
+    print("%s written" % fname)
+    for a, b in zip(y, reference):
+        print("%14.9f %14.9f" % (a, b))
+    print("max. relative difference to the generated module: %g" % err)
+    if err > 1e-5:
+        raise SystemExit(1)
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,95 @@
+# -*- coding: utf-8 -*-
+#
+# Copyright (C) 2009, 2010 Hermann Meyer, James Warden, Andreas Degert
+# Copyright (C) 2011 Pete Shorthose
+#
+# This program is free software; you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation; either version 2 of the License, or
+# (at your option) any later version.
+#
+# This program is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# You should have received a copy of the GNU General Public License
+# along with this program; if not, write to the Free Software
+# Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+#----------------------------------------------------------------
+#
+# generator for the function tables of src/headers/gx_nltable.h,
+# used by tube_transfer.py and ampsim/DK/circ_table_gen.py
+#
+
+import sys
+import numpy as np
+
+orders = (1, 3)
+
+def interpolate(data, pos, order=1):
+    """table value at positions pos (array), same as nltable_interpolate()"""
+    data = np.asarray(data, dtype=np.float32)
+    size = len(data)
+    f = np.clip(np.nan_to_num(np.asarray(pos, dtype=np.float64), nan=0.0), 0, size-1)
+    i = np.minimum(f.astype(int), size-2)
+    f -= i
+    y1 = data[i]
+    y2 = data[i+1]
+    if order == 1:
+        return y1*(1-f) + y2*f
+    # at the table ends the missing neighbour is extrapolated
+    # with the parabola through the 3 nearest points
+    ym = data[np.maximum(i-1, 0)]
+    yp = data[np.minimum(i+2, size-1)]
+    y0 = np.where(i > 0, ym, 3*(y1 - y2) + yp)
+    y3 = np.where(i < size-2, yp, 3*(y2 - y1) + ym)
+    c1 = 0.5 * (y2 - y0)
+    c2 = y0 - 2.5 * y1 + 2.0 * y2 - 0.5 * y3
+    c3 = 0.5 * (y3 - y0) + 1.5 * (y1 - y2)
+    return ((c3 * f + c2) * f + c1) * f + y1
+
+def table_error(func, low, high, size, order=1, relative=False, oversample=8):
+    """maximal error of a table with size points for func
+    (func must accept an array)"""
+    x = np.linspace(low, high, size)
+    data = func(x)
+    xf = np.linspace(low, high, (size-1)*oversample+1)
+    ref = func(xf)
+    err = np.abs(interpolate(data, (xf - low) * (size-1) / (high - low), order) - ref)
+    if relative:
+        err /= np.maximum(np.abs(ref), 1e-30)
+    return np.max(err)
+
+def min_size(func, low, high, max_err, order=1, relative=False, oversample=8, max_size=4096):
+    """smallest table size with an error not above max_err"""
+    lo, hi = 4, max_size
+    if table_error(func, low, high, hi, order, relative, oversample) > max_err:
+        return max_size
+    while lo < hi:
+        m = (lo + hi) // 2
+        if table_error(func, low, high, m, order, relative, oversample) > max_err:
+            lo = m + 1
+        else:
+            hi = m
+    return lo
+
+def write_data(low, high, istep, data, fmt=str, out=None):
+    """write the C initializer fields of nltable_imp<>: low, high,
+    istep, size and the data (5 values per line); the enclosing
+    braces are written by the caller"""
+    if out is None:
+        out = sys.stdout
+    out.write('\t%g,%g,%g,%d, {' % (low, high, istep, len(data)))
+    s = ""
+    for i, v in enumerate(data):
+        if i % 5 == 0:
+            out.write(s+"\n\t")
+            s = ""
+        out.write(s+fmt(v))
+        s = ","
+    out.write("\n\t}")
+
+def write_range_data(x, y, fmt=str, out=None):
+    """table over the equidistant input values x"""
+    write_data(x[0], x[-1], (len(x)-1)/(x[-1]-x[0]), y, fmt, out)
@@ -28,6 +28,7 @@ import matplotlib
 import matplotlib.pyplot as plt
 from scipy.optimize import newton
 from numpy import linspace, vectorize, exp, log, sqrt, arctan
+import nltable
 
 #
 #                                 o V+         
@@ -198,8 +199,14 @@ class Circuit(object):
             self.Uin_max   = 5
             self.Vp        = 250
             self.Rp        = 100e3
-        self.table_size = 2001
         self.Ri_values = (68e3, 250e3)
+        self.set_table(self.default_size, 1)
+
+    default_size = 2001  # linear tables
+
+    def set_table(self, size, order):
+        self.table_size = size
+        self.order = order
         self.Vi = linspace(self.Uin_min,self.Uin_max,self.table_size)
         
 
@@ -272,31 +279,11 @@ class Circuit(object):
             return (self.Ftube(-v, Ri)-self.Vp)*(Rk/self.Rp) + v
         return newton(f, v0)
 
-    def write_ftube_table(self, Ri, Vi, Vp):
-        """write C source"""
-        sys.stdout.write("\t{ // Ri = %dk\n" % (Ri/1e3))
-        sys.stdout.write('\t%g,%g,%g,%d, {' % (Vi[0], Vi[-1], (len(Vi)-1)/(Vi[-1]-Vi[0]), self.table_size))
-        s = ""
-        for i, v in enumerate(Vi):
-            if i % 5 == 0:
-                sys.stdout.write(s+"\n\t")
-                s = ""
-            sys.stdout.write(s+str(Vp[i]))
-            s = ","
-        sys.stdout.write("\n\t}}")
-
-    def write_ranode_table(self, Ri, Vi, Rp):
+    def write_table(self, Ri, Vi, V):
         """write C source"""
         sys.stdout.write("\t{ // Ri = %dk\n" % (Ri/1e3))
-        sys.stdout.write('\t%g,%g,%g,%d, {' % (Vi[0], Vi[-1], (len(Vi)-1)/(Vi[-1]-Vi[0]), self.table_size))
-        s = ""
-        for i, v in enumerate(Vi):
-            if i % 5 == 0:
-                sys.stdout.write(s+"\n\t")
-                s = ""
-            sys.stdout.write(s+str(Rp[i]))
-            s = ","
-        sys.stdout.write("\n\t}}")
+        nltable.write_range_data(Vi, V)
+        sys.stdout.write("}")
 
     def write_tables(self, prgname):
         sys.stdout.write("// generated by %s\n" % prgname)
@@ -304,25 +291,26 @@ class Circuit(object):
         sys.stdout.write("// plate current function: %s\n" % self.ipk_func)
         for n in self.used_names:
             sys.stdout.write("// %s: %g\n" % (n, getattr(self, n)))
+        sys.stdout.write("// interpolation order: %d\n" % self.order)
         sys.stdout.write("\n")
-        sys.stdout.write("table1d_imp<%d> tubetable_%s[%d] __rt_data = {\n"
+        sys.stdout.write("nltable_imp<%d> tubetable_%s[%d] __rt_data = {\n"
                          % (self.table_size, self.tube, len(self.Ri_values)))
         s = ""
         for Ri in self.Ri_values:
             sys.stdout.write(s)
             s = ",\n"
             Vp = self.FtubeV(self.Vi, Ri)
-            self.write_ftube_table(Ri, self.Vi, Vp)
+            self.write_table(Ri, self.Vi, Vp)
         sys.stdout.write("\n};\n")
 
-        sys.stdout.write("table1d_imp<%d> tubetable2_%s[%d] __rt_data = {\n"
+        sys.stdout.write("nltable_imp<%d> tubetable2_%s[%d] __rt_data = {\n"
                          % (self.table_size, self.tube, len(self.Ri_values)))
         s = ""
         for Ri in self.Ri_values:
             sys.stdout.write(s)
             s = ",\n"
             Rp = self.RanodeV(self.Vi, Ri)
-            self.write_ranode_table(Ri, self.Vi, Rp)
+            self.write_table(Ri, self.Vi, Rp)
         sys.stdout.write("\n};\n")
 
     def R_name(self, r):
@@ -359,18 +347,40 @@ class Circuit(object):
                 return
         print("%f" % self.Vk0(Ri,Rk))
 
-    def check_table_accuracy(self, Ri):
-        """maximal relative table error at half interval"""
-        def ip(x):
-            return (x[:-1]+x[1:])/2
-        Vp = self.FtubeV(self.Vi, Ri)
-        VpM = self.FtubeV(ip(self.Vi), Ri)
-        VpD = (ip(Vp) - VpM) / VpM
-        return max(VpD)
+    def table_funcs(self):
+        """(name, function) for the tables of write_tables()"""
+        for Ri in self.Ri_values:
+            yield "Ftube Ri=%dk" % (Ri/1e3), lambda v, Ri=Ri: self.FtubeV(v, Ri)
+            yield "Ranode Ri=%dk" % (Ri/1e3), lambda v, Ri=Ri: self.RanodeV(v, Ri)
+
+    @staticmethod
+    def oversample(order):
+        # the error of linear interpolation is largest in the middle
+        # between the points, for cubic it must be searched
+        return 2 if order == 1 else 8
+
+    def check_table_accuracy(self, func, size, order):
+        """maximal relative table error"""
+        return nltable.table_error(
+            func, self.Uin_min, self.Uin_max, size, order,
+            relative=True, oversample=self.oversample(order))
+
+    def auto_size(self, order):
+        """smallest table size for which all tables of the tube are
+        as accurate as the linear tables with default_size points"""
+        size = 0
+        for name, f in self.table_funcs():
+            err = self.check_table_accuracy(f, self.default_size, 1)
+            size = max(size, nltable.min_size(
+                f, self.Uin_min, self.Uin_max, err, order,
+                relative=True, oversample=self.oversample(order)))
+        return size
 
     def display_accuracy(self):
-        for Ri in self.Ri_values:
-            print("Ri=%dk: %g" % (Ri/1e3, self.check_table_accuracy(Ri)))
+        for order in nltable.orders:
+            for name, f in self.table_funcs():
+                print("order %d, %s: %g" % (
+                    order, name, self.check_table_accuracy(f, self.table_size, order)))
     
     def plot_Ftube(self):
         fig, ax = plt.subplots()
@@ -402,7 +412,11 @@ class Circuit(object):
 
 
 def usage():
-    print("usage: %s plot|s_plot|accuracy|table|vk0 tube-name plate-func" % sys.argv[0])
+    print("usage: %s plot|s_plot|vk0 tube-name plate-func" % sys.argv[0])
+    print("       %s accuracy|table tube-name plate-func [size|auto [order]]" % sys.argv[0])
+    print("       (order: %s, default: %d points, linear; auto: smallest size with" % (
+        ", ".join(str(v) for v in nltable.orders), Circuit.default_size))
+    print("       the accuracy of the default linear table)")
     print(Circuit.help())
     raise SystemExit(1)
 
@@ -415,10 +429,20 @@ def main():
         c.plot_Ftube()
     elif cmd == "s_plot":
         c.s_plot_Ftube()
-    elif cmd == "accuracy":
-        c.display_accuracy()
-    elif cmd == "table":
-        c.write_tables(sys.argv[0])
+    elif cmd in ("accuracy", "table"):
+        if len(sys.argv) > 4:
+            order = int(sys.argv[5]) if len(sys.argv) > 5 else 1
+            if order not in nltable.orders:
+                usage()
+            if sys.argv[4] == "auto":
+                size = c.auto_size(order)
+            else:
+                size = int(sys.argv[4])
+            c.set_table(size, order)
+        if cmd == "accuracy":
+            c.display_accuracy()
+        else:
+            c.write_tables(sys.argv[0])
     elif cmd == "vk0":
         c.show_vk0(sys.argv[4:])
     else:
@@ -47,6 +47,7 @@ enyo.kind({
 	    this.ws = newMozWebSocket(this.uri);
 	}
 	if (this.ws) {
+	    this.ws.binaryType = "arraybuffer";
 	    this.ws.onopen = enyo.bind(this, "socketOpened");
 	    this.ws.onclose = enyo.bind(this, "doClose");
 	    this.ws.onmessage = enyo.bind(this, "doMessage");
@@ -103,6 +104,7 @@ enyo.kind({
     	this.inherited(arguments);
 	this.id = 0;
 	this.callbacks = {};
+	this.attachments = [];
     },
 
     handlers: {
@@ -115,6 +117,13 @@ enyo.kind({
     },
 
     receive: function(inSender, inEvent) {
+	if (inEvent.data instanceof ArrayBuffer) {
+	    // binary attachment, sent in front of the response it belongs to
+	    this.attachments.push(inEvent.data);
+	    return;
+	}
+	var attachments = this.attachments;
+	this.attachments = [];
 	var response;
 	try {
 	    response = enyo.json.parse(inEvent.data);
@@ -126,7 +135,7 @@ enyo.kind({
 	    if (this.callbacks[response.id] && 'result' in response) {
 		var f = this.callbacks[response.id];
 		delete this.callbacks[response.id];
-		f(response.result);
+		f(response.result, attachments);
 		return;
 	    }
 	} else {